@@ -18,6 +18,8 @@ See notes at end for glyph nomenclature & other tidbits.
 */
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
 #include <stdint.h>
 #include <ft2build.h>
@@ -50,10 +52,18 @@ void enbit(uint8_t value, Accumulator* acc) {
 
 int main(int argc, char *argv[]) {
 	// Parse command line.  Valid syntaxes are:
-	//   fontconvert filename size range [...range]
+	//   fontconvert [-c] filename size range [...range]
+	// -c compresses the bitmaps, see GlyphStream in ../main/glyph.h
+
+	int compress = argc > 1 && !strcmp(argv[1], "-c");
+	if (compress) {
+      argv[1] = argv[0];
+      ++argv;
+      --argc;
+	}
 
 	if (argc < 3) {
-		fprintf(stderr, "Usage: %s fontfile size [first] [last]\n",
+		fprintf(stderr, "Usage: %s [-c] fontfile size [first] [last]\n",
 		  argv[0]);
 		return 1;
 	}
@@ -106,6 +116,8 @@ int main(int argc, char *argv[]) {
 	// the right symbols, and that's not done yet.
 	// fprintf(stderr, "%ld glyphs\n", face->num_glyphs);
  
+    int *range_first = malloc(argc * sizeof(int));
+    int *range_last = malloc(argc * sizeof(int));
     printf("const UnicodeFont %s[] = {\n", fontName);
     for (int r = 3; r < argc; ++r) {
       int first, last;
@@ -117,6 +129,8 @@ int main(int argc, char *argv[]) {
           last = atoi(hyphen);
       } else
         first = last = atoi(argv[r]);
+      range_first[r - 3] = first;
+      range_last[r - 3] = last;
 
       int page = first & 0xFFFFFF80;
       Accumulator acc = {0, 0, 0x80, 1};
@@ -167,22 +181,56 @@ int main(int argc, char *argv[]) {
 		table[j].xOffset      = g->left;
 		table[j].yOffset      = 1 - g->top;
 
+		// Compressed glyphs keep only the columns between the leftmost
+		// and the rightmost ink and the rows containing any, the height
+		// stays as it is because Typography places glyphs by it
+		int left = 0, right = bitmap->width, bits = 0;
+		uint8_t *ink_rows = calloc(bitmap->rows + 1, 1);
+		if (compress) {
+          left = bitmap->width;
+          right = 0;
+          for (int y = 0; y < bitmap->rows; ++y)
+            for (int x = 0; x < bitmap->width; ++x)
+              if (bitmap->buffer[y * bitmap->pitch + x / 8] &
+                  (0x80 >> (x & 7))) {
+                ink_rows[y] = 1;
+                if (x < left)
+                  left = x;
+                if (x >= right)
+                  right = x + 1;
+              }
+          if (right <= left)
+            left = right = 0;
+          table[j].width = right - left;
+          table[j].xOffset += left;
+          if (table[j].width)
+            for (int y = 0; y < bitmap->rows; y += 8) {
+              for (int b = y; b < y + 8; ++b)
+                enbit(b < bitmap->rows && ink_rows[b], &acc);
+              bits += 8;
+            }
+		}
+
 		for (int y = 0; y < bitmap->rows; ++y) {
-          for (int x = 0; x < bitmap->width; ++x) {
+          if (compress && !ink_rows[y])
+            continue;
+          for (int x = left; x < right; ++x) {
             int byte = x / 8;
             uint8_t bit  = 0x80 >> (x & 7);
             enbit(bitmap->buffer[y * bitmap->pitch + byte] & bit, &acc);
+            ++bits;
           }
 		}
+		free(ink_rows);
 
 		// Pad end of char bitmap to next byte boundary if needed
-		int n = (bitmap->width * bitmap->rows) & 7;
+		int n = bits & 7;
 		if (n) { // Pixel count not an even multiple of 8?
           n = 8 - n; // # bits to next multiple
           while (n--)
             enbit(0, &acc);
 		}
-		bitmapOffset += (bitmap->width * bitmap->rows + 7) / 8;
+		bitmapOffset += (bits + 7) / 8;
 
 		FT_Done_Glyph(glyph);
       }
@@ -212,13 +260,34 @@ int main(int argc, char *argv[]) {
 
       // Size estimate is based on AVR struct and pointer sizes;
       // actual size may vary.
-      printf("    }, 0x%x, 0x%x, 0x%x\n", page, first, last);
+      printf("    }, 0x%x, 0x%x, 0x%x, %s\n", page, first, last,
+             compress ? "true" : "false");
       printf("  },\n");
       printf("  // Approx. %d bytes\n\n",
              bitmapOffset + (last - first + 1) * 7 + 7);
     }
-    printf("};");
-    
+    printf("};\n\n");
+
+    // Index for Typography: the first page which may contain codepoints
+    // of every 256 codepoint block, 0xff when there is none. The last
+    // block stands for everything above U+FEFF. Ranges have to be given
+    // in ascending order.
+    printf("const uint8_t %s_index[256] = {", fontName);
+    for (int block = 0; block < 256; ++block) {
+      int start = block << 8;
+      int end = block == 255 ? 0x7fffffff : start + 0xff;
+      int page = 0xff;
+      for (int i = 0; i < argc - 3; ++i)
+        if (range_last[i] >= start && range_first[i] <= end) {
+          page = i;
+          break;
+        }
+      printf(block % 16 ? " 0x%02x," : "\n  0x%02x,", page);
+    }
+    printf("\n};\n");
+    free(range_first);
+    free(range_last);
+
 	FT_Done_FreeType(library);
 	return 0;
 }
@@ -1,4 +1,6 @@
 #include "ble.h"
+#include "chronos.h"
+#include "notifications.h"
 #include "main_queue.h"
 #include "esp_log.h"
 #include "nimble/ble.h"
@@ -9,7 +11,6 @@
 #include <services/gap/ble_svc_gap.h>
 #include <host/ble_gatt.h>
 #include <services/gatt/ble_svc_gatt.h>
-#include <time.h>
 
 #define BLE_GAP_APPEARANCE_GENERIC_TAG 0x0200
 #define BLE_GAP_URI_PREFIX_HTTPS 0x17
@@ -41,16 +42,6 @@ static uint16_t tx_char_handle;
 static bool subscribed = false;
 static int current_connection_handle = -1;
 
-Notification::Notification(size_t text_size) {
-  text = (char *)malloc(text_size + 1);
-  text[text_size] = 0;
-}
-
-Notification::~Notification() {
-  if (text)
-    free(text);
-}
-
 static const struct ble_gatt_svc_def gatt_svr_svcs[] = {
     {.type = BLE_GATT_SVC_TYPE_PRIMARY,
      .uuid = &svc_uuid.u,
@@ -377,74 +368,17 @@ void dump_mbuf_meta(os_mbuf* mbuf) {
            mbuf->om_omp->omp_pool->mp_num_free);
 }
 
-struct Accumulator {
-  uint16_t length;
-  os_mbuf* data;
-};
-
-Accumulator accumulator = {};
-
-void parse_accumulated() {
-  ESP_LOGI(TAG, "Packet, code: 0x%x", accumulator.data->om_data[4]);
-  if (accumulator.data->om_data[0] == 0xab) {
-    switch (accumulator.data->om_data[4]) {
-    case 0x72: {
-      accumulator.data = os_mbuf_pullup(accumulator.data, 8);
-      int text_len = OS_MBUF_PKTLEN(accumulator.data) - 8;
-      Notification *nt = new Notification(text_len);
-      nt->icon = accumulator.data->om_data[6];
-      nt->state = accumulator.data->om_data[7];
-      os_mbuf_copydata(accumulator.data, 8, text_len, nt->text);
-      struct Message msg = {CLIENT_NOTIFICATION, nt};
-      xQueueSend(main_queue, &msg, 0);
-      break;
-    }
-    case 0x71: {
-      struct Message msg = {CLIENT_FIND, 0};
-      xQueueSend(main_queue, &msg, 0);
-      break;
-    }
-    case 0x73:
-      // alarm
-      break;
-    case 0x93: {
-      accumulator.data = os_mbuf_pullup(accumulator.data, 14);
-      tm* t = new tm();
-      t->tm_year = accumulator.data->om_data[7] * 256 + accumulator.data->om_data[8] - 1900;
-      t->tm_mon = accumulator.data->om_data[9] - 1;
-      t->tm_mday = accumulator.data->om_data[10];
-      t->tm_hour = accumulator.data->om_data[11];
-      t->tm_min = accumulator.data->om_data[12];
-      t->tm_sec = accumulator.data->om_data[13];
-      mktime(t);
-      struct Message msg = {CLIENT_TIME, t};
-      xQueueSend(main_queue, &msg, 0);
-      break;
-    }
-    }
-  }
-}
+static ChronosReceiver receiver(notifications);
 
+// the segments of the write are fed as they are, nothing is duplicated
 void accumulate(os_mbuf* buf) {
-  if ((buf->om_data[0] == 0xab || buf->om_data[0] == 0xea) &&
-      (buf->om_data[3] == 0xfe || buf->om_data[3] == 0xff)) {
-    accumulator.length = buf->om_data[1] * 256 + buf->om_data[2] + 3;
-    accumulator.data = buf;
-    uint16_t received = os_mbuf_len(buf);
-    ESP_LOGI(TAG, "New packet, %u", received);
-    if (accumulator.length <= received) {
-      parse_accumulated();
-      return;
-    }
-    accumulator.data = os_mbuf_dup(buf);
-  } else {
-    ESP_LOGI(TAG, "Packet fragment, %u", os_mbuf_len(buf));
-    os_mbuf_appendfrom(accumulator.data, buf, 1, os_mbuf_len(buf) - 1);
-    if (accumulator.length <= OS_MBUF_PKTLEN(accumulator.data)) {
-      parse_accumulated();
-      os_mbuf_free_chain(accumulator.data);
-    }
-  }
+  uint8_t lead[4];
+  uint16_t lead_len = OS_MBUF_PKTLEN(buf) < sizeof(lead) ?
+    OS_MBUF_PKTLEN(buf) : sizeof(lead);
+  os_mbuf_copydata(buf, 0, lead_len, lead);
+  receiver.BeginWrite(lead, lead_len);
+  for (os_mbuf* m = buf; m; m = SLIST_NEXT(m, om_next))
+    receiver.Feed(m->om_data, m->om_len);
 }
 
 static int characteristic_access(uint16_t conn_handle, uint16_t attr_handle,
@@ -0,0 +1,269 @@
+#include "canvas.h"
+#include "glyph.h"
+#include "trace.h"
+#include <esp_log.h>
+#include <string.h>
+
+static const char* TAG = "canvas";
+
+#define RECT_OP 0x8000
+#define FILL_OP 0x4000
+#define BLIT_OP 0x2000
+
+void Rect::add(const Rect& other) {
+  if (other.empty())
+    return;
+  if (empty()) {
+    *this = other;
+    return;
+  }
+  int16_t x_end = x + w > other.x + other.w ? x + w : other.x + other.w;
+  int16_t y_end = y + h > other.y + other.h ? y + h : other.y + other.h;
+  if (other.x < x)
+    x = other.x;
+  if (other.y < y)
+    y = other.y;
+  w = x_end - x;
+  h = y_end - y;
+}
+
+void Rect::clip(int16_t width, int16_t height) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > width)
+    w = width - x;
+  if (y + h > height)
+    h = height - y;
+}
+
+void Canvas::record(const Rect& box, const void* source, uint16_t code) {
+  if (box.empty())
+    return;
+  if (op_count[current] == DRAW_OP_LIMIT) {
+    overflow[current] = true;
+    return;
+  }
+  ops[current][op_count[current]++] = {box, source, code};
+}
+
+bool Canvas::contains(int list, const DrawOp& op) {
+  for (int i = 0; i < op_count[list]; ++i)
+    if (ops[list][i] == op)
+      return true;
+  return false;
+}
+
+void Canvas::setFont(const GFXfont *f, bool compressed) {
+  font = f;
+  font_compressed = compressed;
+}
+
+void Canvas::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= CANVAS_WIDTH || y < 0 || y >= CANVAS_HEIGHT)
+    return;
+  uint8_t *p = frame + y * CANVAS_ROW_BYTES + x / 8;
+  if (color)
+    *p |= 0x80 >> (x & 7);
+  else
+    *p &= ~(0x80 >> (x & 7));
+}
+
+void Canvas::fill(int16_t x, int16_t y, int16_t w, int16_t h,
+                  uint16_t color) {
+  for (int16_t j = y; j < y + h; ++j)
+    for (int16_t i = x; i < x + w; ++i)
+      drawPixel(i, j, color);
+}
+
+// Same as Adafruit_GFX::drawChar() for custom fonts, background is
+// never painted. Rows are unpacked into bytes and blitted.
+void Canvas::drawChar(int16_t x, int16_t y, unsigned char c,
+                      uint16_t color, uint16_t bg, uint8_t size) {
+  const GFXglyph *glyph = &font->glyph[c - font->first];
+  Rect box = {(int16_t)(x + glyph->xOffset), (int16_t)(y + glyph->yOffset),
+              glyph->width, glyph->height};
+  record(box, font, c | (color ? 0 : 0x100));
+  uint8_t row[32];
+  int bytes = (glyph->width + 7) / 8;
+  GlyphStream bits(font, glyph, font_compressed);
+  for (int16_t yy = box.y; !bits.done(); ++yy) {
+    if (!bits.nextRow())
+      continue;
+    bits.readRow(row);
+    blitRow(box.x, yy, row, bytes, color);
+  }
+}
+
+void Canvas::drawRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint16_t color) {
+  record({x, y, w, h}, 0, RECT_OP | (color ? 1 : 0));
+  fill(x, y, w, 1, color);
+  fill(x, y + h - 1, w, 1, color);
+  fill(x, y, 1, h, color);
+  fill(x + w - 1, y, 1, h, color);
+}
+
+void Canvas::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                      uint16_t color) {
+  record({x, y, w, h}, 0, RECT_OP | FILL_OP | (color ? 1 : 0));
+  fill(x, y, w, h, color);
+}
+
+// Whole bytes of the frame are updated, bits at an unaligned x are
+// shifted on the fly and touch one more byte.
+void Canvas::blitRow(int16_t x, int16_t y, const uint8_t *bits, int bytes,
+                     uint16_t color) {
+  if (y < 0 || y >= CANVAS_HEIGHT)
+    return;
+  uint8_t *dst = frame + y * CANVAS_ROW_BYTES;
+  int shift = x & 7;
+  int first = x >> 3;
+  int count = shift ? bytes + 1 : bytes;
+  uint8_t carry = 0;
+  for (int i = 0; i < count; ++i) {
+    uint8_t src = i < bytes ? bits[i] : 0;
+    uint8_t ink = shift ? (carry << (8 - shift)) | (src >> shift) : src;
+    carry = src;
+    if (!ink || first + i < 0 || first + i >= CANVAS_ROW_BYTES)
+      continue;
+    if (color)
+      dst[first + i] |= ink;
+    else
+      dst[first + i] &= ~ink;
+  }
+}
+
+void Canvas::blit(int16_t x, int16_t y, const uint8_t *bits,
+                  int bytes_per_row, int rows, uint16_t color) {
+  record({x, y, (int16_t)(bytes_per_row * 8), (int16_t)rows},
+         bits, BLIT_OP | (color ? 1 : 0));
+  for (int row = 0; row < rows; ++row, bits += bytes_per_row)
+    blitRow(x, y + row, bits, bytes_per_row, color);
+}
+
+void Canvas::fillScreen(uint16_t color) {
+  frame_start = trace_start();
+  current ^= 1;
+  op_count[current] = 0;
+  overflow[current] = false;
+  memset(frame, color ? 0xff : 0x00, sizeof(frame));
+  if (color != EPD_WHITE)
+    record({0, 0, width(), height()}, 0, RECT_OP | FILL_OP);
+}
+
+Rect Canvas::Changed() {
+  int prev = current ^ 1;
+  if (!valid() || !history || overflow[current] || overflow[prev])
+    return {0, 0, width(), height()};
+  Rect result;
+  for (int i = 0; i < op_count[current]; ++i)
+    if (!contains(prev, ops[current][i]))
+      result.add(ops[current][i].box);
+  for (int i = 0; i < op_count[prev]; ++i)
+    if (!contains(current, ops[prev][i]))
+      result.add(ops[prev][i].box);
+  // glyphs may stick out of the canvas, diff() only reads the frame
+  result.clip(width(), height());
+  return result;
+}
+
+// Bounding box of the pixels in the rows of area which differ from
+// the shadow, byte aligned horizontally. Rows are compared a word at
+// a time, only the rows between the first and the last changed word
+// are looked at bytewise to find the columns.
+Rect Canvas::diff(const Rect& area) {
+  Rect result;
+  const uint32_t *a = (const uint32_t*)frame;
+  const uint32_t *b = (const uint32_t*)shadow.bits;
+  int first = area.y * CANVAS_ROW_BYTES / 4;
+  int last = ((area.y + area.h) * CANVAS_ROW_BYTES + 3) / 4 - 1;
+  while (first <= last && a[first] == b[first])
+    ++first;
+  if (first > last)
+    return result;
+  while (a[last] == b[last])
+    --last;
+  int y0 = first * 4 / CANVAS_ROW_BYTES;
+  int y1 = (last * 4 + 3) / CANVAS_ROW_BYTES;
+  if (y1 >= CANVAS_HEIGHT)
+    y1 = CANVAS_HEIGHT - 1;
+  int x0 = CANVAS_ROW_BYTES;
+  int x1 = -1;
+  for (int y = y0; y <= y1; ++y) {
+    const uint8_t *p = frame + y * CANVAS_ROW_BYTES;
+    const uint8_t *q = shadow.bits + y * CANVAS_ROW_BYTES;
+    for (int i = 0; i < x0; ++i)
+      if (p[i] != q[i]) {
+        x0 = i;
+        break;
+      }
+    for (int i = CANVAS_ROW_BYTES - 1; i > x1; --i)
+      if (p[i] != q[i]) {
+        x1 = i;
+        break;
+      }
+  }
+  if (x1 < x0)
+    return result;
+  // rows at the ends of the word span may be unchanged, skip them
+  while (!memcmp(frame + y0 * CANVAS_ROW_BYTES,
+                 shadow.bits + y0 * CANVAS_ROW_BYTES, CANVAS_ROW_BYTES))
+    ++y0;
+  while (!memcmp(frame + y1 * CANVAS_ROW_BYTES,
+                 shadow.bits + y1 * CANVAS_ROW_BYTES, CANVAS_ROW_BYTES))
+    --y1;
+  result = {(int16_t)(x0 * 8), (int16_t)y0,
+            (int16_t)((x1 - x0 + 1) * 8), (int16_t)(y1 - y0 + 1)};
+  return result;
+}
+
+// copy the area of the frame to the driver buffer and the shadow, the
+// layouts are the same, so whole bytes are copied
+void Canvas::push(const Rect& area) {
+  int x0 = area.x / 8;
+  int x1 = (area.x + area.w + 7) / 8;
+  for (int y = area.y; y < area.y + area.h; ++y) {
+    int offset = y * CANVAS_ROW_BYTES;
+    display.writeRow(x0 * 8, y, frame + offset + x0, x1 - x0);
+    memcpy(shadow.bits + offset + x0, frame + offset + x0, x1 - x0);
+  }
+}
+
+bool Canvas::Update(bool full) {
+  trace(TRACE_DRAW, frame_start);
+  int64_t start = trace_start();
+  Rect screen = {0, 0, width(), height()};
+  if (full) {
+    push(screen);
+    display.update();
+    trace(TRACE_REFRESH, start);
+    shadow.magic = CANVAS_SHADOW_MAGIC;
+    history = true;
+    return true;
+  }
+  Rect changed = Changed();
+  if (valid() && !changed.empty())
+    changed = diff(changed);
+  // from here on the shadow holds this frame, its records are the history
+  history = true;
+  if (changed.empty()) {
+    ESP_LOGD(TAG, "Nothing has changed");
+    return false;
+  }
+  shadow.magic = CANVAS_SHADOW_MAGIC;
+  // add 15 pixel, for some reason lower part doesn't update
+  changed.h += 15;
+  changed.clip(width(), height());
+  ESP_LOGD(TAG, "upd_x: %d, upd_y: %d, upd_w: %d, upd_h: %d",
+           changed.x, changed.y, changed.w, changed.h);
+  push(changed);
+  display.updateWindow(changed.x, changed.y, changed.w, changed.h, false);
+  trace(TRACE_REFRESH, start);
+  return true;
+}
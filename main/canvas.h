@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+#include <gfxfont.h>
+#include <gdeh0154d67.h>
+
+struct Rect {
+  int16_t x = 0;
+  int16_t y = 0;
+  int16_t w = 0;
+  int16_t h = 0;
+
+  bool empty() const {
+    return w <= 0 || h <= 0;
+  }
+
+  bool operator==(const Rect& other) const {
+    return x == other.x && y == other.y && w == other.w && h == other.h;
+  }
+
+  void add(const Rect& other);
+  void clip(int16_t width, int16_t height);
+};
+
+// Single drawing operation, a glyph of a font page or a rectangle
+struct DrawOp {
+  Rect box;
+  const void* source;
+  uint16_t code;
+
+  bool operator==(const DrawOp& other) const {
+    return box == other.box && source == other.source && code == other.code;
+  }
+};
+
+const int DRAW_OP_LIMIT = 128;
+const int CANVAS_WIDTH = GDEH0154D67_WIDTH;
+const int CANVAS_HEIGHT = GDEH0154D67_HEIGHT;
+const int CANVAS_ROW_BYTES = CANVAS_WIDTH / 8;
+const int CANVAS_SIZE = CANVAS_ROW_BYTES * CANVAS_HEIGHT;
+
+const uint32_t CANVAS_SHADOW_MAGIC = 0x53484457;
+
+// The frame the panel shows. The owner keeps it in RTC memory, so after
+// deep sleep the first frame is still compared against the panel and
+// only the pixels which differ are refreshed.
+struct CanvasShadow {
+  uint32_t magic;        // bits are what the panel shows
+  alignas(4) uint8_t bits[CANVAS_SIZE];
+};
+
+// Drawing target for Typography and the screens. Frames are drawn into
+// an own 1bpp buffer (same layout as the panel, set bit is white) and
+// everything drawn since the last fillScreen() is recorded. Comparing
+// the records with the previous frame gives the candidate region, a XOR
+// against the shadow copy of the last pushed frame narrows it down to
+// the pixels that really changed. Only those go to the panel.
+class Canvas {
+ private:
+  Gdeh0154d67 &display;
+  const GFXfont *font = 0;
+  bool font_compressed = false;
+  DrawOp ops[2][DRAW_OP_LIMIT];
+  int op_count[2] = {0, 0};
+  bool overflow[2] = {false, false};
+  int current = 0;
+  // the records of the frame on the panel are lost after a boot, until
+  // a frame has been pushed the whole screen is diffed against shadow
+  bool history = false;
+  alignas(4) uint8_t frame[CANVAS_SIZE];
+  CanvasShadow &shadow;
+  int64_t frame_start = 0;   // for tracing
+
+  bool valid() const {
+    return shadow.magic == CANVAS_SHADOW_MAGIC;
+  }
+  void record(const Rect& box, const void* source, uint16_t code);
+  bool contains(int list, const DrawOp& op);
+  void fill(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void blitRow(int16_t x, int16_t y, const uint8_t *bits, int bytes,
+               uint16_t color);
+  Rect diff(const Rect& area);
+  void push(const Rect& area);
+
+ public:
+  Canvas(Gdeh0154d67& tgt, CanvasShadow& panel)
+    : display(tgt), shadow(panel) {}
+
+  void setFont(const GFXfont *f, bool compressed = false);
+  void drawPixel(int16_t x, int16_t y, uint16_t color);
+  void drawChar(int16_t x, int16_t y, unsigned char c,
+                uint16_t color, uint16_t bg, uint8_t size);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  // paint the set bits of a bitmap with rows of bytes_per_row bytes,
+  // bits is recorded as the source, so it must stay unchanged
+  void blit(int16_t x, int16_t y, const uint8_t *bits,
+            int bytes_per_row, int rows, uint16_t color);
+  // starts a new frame
+  void fillScreen(uint16_t color);
+
+  int16_t width() {
+    return CANVAS_WIDTH;
+  }
+
+  int16_t height() {
+    return CANVAS_HEIGHT;
+  }
+
+  const uint8_t* buffer() {
+    return frame;
+  }
+
+  // union of the boxes which differ between this and the previous frame
+  Rect Changed();
+
+  // refresh the changed region, or the whole panel with the full waveform,
+  // returns false when there was nothing to refresh
+  bool Update(bool full);
+
+  // the panel content is unknown, next update covers the whole screen
+  void Invalidate() {
+    shadow.magic = 0;
+    history = false;
+  }
+};
@@ -0,0 +1,128 @@
+#include "chronos.h"
+#include "ble.h"
+#include "notifications.h"
+#include "main_queue.h"
+#include "esp_log.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static const char* TAG = "chronos";
+
+#define TEXT_OFFSET 8
+
+// a multibyte symbol cut at the end of the text is removed
+static void trim_utf8(char* text, size_t size) {
+  size_t lead = size;
+  while (lead > 0 && (text[lead - 1] & 0xc0) == 0x80)
+    --lead;
+  if (lead == 0)
+    return;
+  uint8_t first = text[--lead];
+  size_t symbol = (first & 0xe0) == 0xc0 ? 2 :
+    (first & 0xf0) == 0xe0 ? 3 : (first & 0xf8) == 0xf0 ? 4 : 1;
+  if (lead + symbol > size)
+    text[lead] = 0;
+}
+
+void ChronosReceiver::drop() {
+  text = 0;
+  length = 0;
+}
+
+void ChronosReceiver::BeginWrite(const uint8_t *lead, size_t lead_len) {
+  if (lead_len >= 4 && (lead[0] == 0xab || lead[0] == 0xea) &&
+      (lead[3] == 0xfe || lead[3] == 0xff)) {
+    if (length)
+      ESP_LOGW(TAG, "Packet is incomplete, %u of %u",
+               (unsigned)received, (unsigned)length);
+    drop();
+    length = lead[1] * 256 + lead[2] + 3;
+    received = 0;
+    skip = 0;
+    ESP_LOGI(TAG, "New packet, %u", (unsigned)length);
+  } else if (length) {
+    // sequence number
+    skip = 1;
+    ESP_LOGI(TAG, "Packet fragment, %u", (unsigned)lead_len);
+  } else
+    skip = 0;   // dropped by append()
+}
+
+void ChronosReceiver::Feed(const uint8_t *data, size_t len) {
+  if (skip >= len) {
+    skip -= len;
+    return;
+  }
+  append(data + skip, len - skip);
+  skip = 0;
+}
+
+void ChronosReceiver::append(const uint8_t *data, size_t len) {
+  if (!length)
+    return;
+  if (len > length - received)
+    len = length - received;
+  size_t end = received + len;
+  if (received < HEADER_SIZE) {
+    size_t count = end < HEADER_SIZE ? len : HEADER_SIZE - received;
+    memcpy(header + received, data, count);
+  }
+  if (received < TEXT_OFFSET && end >= TEXT_OFFSET &&
+      header[0] == 0xab && header[4] == 0x72) {
+    text_size = length - TEXT_OFFSET;
+    text = notifications.Begin(text_size, header[6], header[7]);
+  }
+  if (text && end > TEXT_OFFSET) {
+    size_t from = received > TEXT_OFFSET ? received : TEXT_OFFSET;
+    size_t to = end < TEXT_OFFSET + text_size ? end : TEXT_OFFSET + text_size;
+    if (to > from)
+      memcpy(text + from - TEXT_OFFSET,
+             data + (from - received), to - from);
+  }
+  received = end;
+  if (received == length)
+    finish();
+}
+
+void ChronosReceiver::finish() {
+  ESP_LOGI(TAG, "Packet, code: 0x%x", header[4]);
+  if (header[0] == 0xab) {
+    switch (header[4]) {
+    case 0x72: {
+      if (!text)
+        break;
+      if (text_size < length - TEXT_OFFSET)
+        trim_utf8(text, text_size);
+      uint32_t id = notifications.Commit();
+      struct Message msg = {CLIENT_NOTIFICATION, (void*)(uintptr_t)id};
+      xQueueSend(main_queue, &msg, 0);
+      break;
+    }
+    case 0x71: {
+      struct Message msg = {CLIENT_FIND, 0};
+      xQueueSend(main_queue, &msg, 0);
+      break;
+    }
+    case 0x73:
+      // alarm
+      break;
+    case 0x93: {
+      if (length < HEADER_SIZE)
+        break;
+      tm* t = new tm();
+      t->tm_year = header[7] * 256 + header[8] - 1900;
+      t->tm_mon = header[9] - 1;
+      t->tm_mday = header[10];
+      t->tm_hour = header[11];
+      t->tm_min = header[12];
+      t->tm_sec = header[13];
+      mktime(t);
+      struct Message msg = {CLIENT_TIME, t};
+      xQueueSend(main_queue, &msg, 0);
+      break;
+    }
+    }
+  }
+  drop();
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stddef.h>
+#include <inttypes.h>
+
+class NotificationBuffer;
+
+// Reassembles Chronos packets written to the RX characteristic. A packet
+// starts with 0xab or 0xea, 16 bit length, 0xfe or 0xff. Writes not
+// starting like that continue the current packet after a sequence byte.
+// The header is parsed as the bytes arrive, a notification text goes
+// straight into the notification arena, so every byte is copied once.
+// Complete packets are posted to the main queue.
+class ChronosReceiver {
+ private:
+  static const int HEADER_SIZE = 14;
+
+  uint8_t header[HEADER_SIZE];
+  size_t length = 0;      // of the current packet, 0 when there is none
+  size_t received = 0;
+  size_t skip = 0;        // bytes of the write which aren't packet data
+  NotificationBuffer &notifications;
+  char* text = 0;          // of a notification in the arena
+  size_t text_size = 0;
+
+  void append(const uint8_t *data, size_t len);
+  void finish();
+  void drop();
+
+ public:
+  ChronosReceiver(NotificationBuffer &store): notifications(store) {}
+
+  // A write begins, lead are its first bytes (4 are enough), the whole
+  // write follows through Feed()
+  void BeginWrite(const uint8_t *lead, size_t lead_len);
+  void Feed(const uint8_t *data, size_t len);
+};
@@ -0,0 +1,106 @@
+#include "clock_face.h"
+#include "glyph.h"
+#include <esp_log.h>
+#include <string.h>
+
+static const char* TAG = "clock_face";
+
+static const char clock_symbols[CLOCK_GLYPHS + 1] = "0123456789:";
+
+static const UnicodeFont* find_page(const UnicodeFont *font, int page_count,
+                                    const uint8_t *index, uint32_t sym,
+                                    const GFXglyph **glyph) {
+  int i = find_font_page(font, page_count, index, sym);
+  if (i < 0)
+    return 0;
+  *glyph = &font[i].base_font.glyph[sym - font[i].page -
+                                    font[i].base_font.first];
+  return &font[i];
+}
+
+void ClockFace::SetFont(const UnicodeFont *subj, int page_count,
+                        const uint8_t *index) {
+  if (font == subj)
+    return;
+  font = subj;
+  font_page_count = page_count;
+  font_index = index;
+  ready = false;
+}
+
+void ClockFace::render(Cell& cell, uint32_t sym) {
+  const GFXglyph *glyph;
+  const UnicodeFont *page = find_page(font, font_page_count, font_index, sym,
+                                      &glyph);
+  memset(cell.bits, 0, sizeof(cell.bits));
+  cell.advance = glyph->xAdvance;
+  cell.height = glyph->height;
+  // Typography puts the cursor glyph->height above the baseline
+  int row = glyph->height + glyph->yOffset - top;
+  GlyphStream bits(&page->base_font, glyph, page->compressed);
+  for (; !bits.done(); ++row) {
+    if (!bits.nextRow())
+      continue;
+    for (uint8_t xx = 0; xx < glyph->width; ++xx) {
+      int col = glyph->xOffset + xx;
+      if (bits.pixel())
+        cell.bits[row][col / 8] |= 0x80 >> (col & 7);
+    }
+  }
+}
+
+bool ClockFace::build() {
+  if (!font)
+    return false;
+  int bottom = INT16_MIN;
+  top = INT16_MAX;
+  for (int i = 0; i < CLOCK_GLYPHS; ++i) {
+    const GFXglyph *glyph;
+    if (!find_page(font, font_page_count, font_index, clock_symbols[i],
+                   &glyph)) {
+      ESP_LOGE(TAG, "No glyph for %c", clock_symbols[i]);
+      return false;
+    }
+    if (glyph->xOffset < 0 ||
+        glyph->xOffset + glyph->width > CLOCK_CELL_BYTES * 8) {
+      ESP_LOGE(TAG, "Glyph %c is too wide", clock_symbols[i]);
+      return false;
+    }
+    int glyph_top = glyph->height + glyph->yOffset;
+    if (glyph_top < top)
+      top = glyph_top;
+    if (glyph_top + glyph->height > bottom)
+      bottom = glyph_top + glyph->height;
+  }
+  rows = bottom - top;
+  if (rows > CLOCK_CELL_ROWS) {
+    ESP_LOGE(TAG, "Glyphs are too high: %d", rows);
+    return false;
+  }
+  for (int i = 0; i < CLOCK_GLYPHS; ++i)
+    render(cells[i], clock_symbols[i]);
+  ready = true;
+  return true;
+}
+
+uint16_t ClockFace::PrintCentered(int hour, int min, int16_t y) {
+  if (!ready && !build())
+    return 0;
+  const Cell* text[5] = {&cells[hour / 10 % 10], &cells[hour % 10],
+                         &cells[CLOCK_GLYPHS - 1],
+                         &cells[min / 10 % 10], &cells[min % 10]};
+  uint16_t width = 0;
+  uint16_t height = 0;
+  for (const Cell* cell : text) {
+    width += cell->advance;
+    if (cell->height > height)
+      height = cell->height;
+  }
+  int16_t x = (canvas.width() - width) / 2;
+  for (const Cell* cell : text) {
+    canvas.blit(x, y + top, &cell->bits[0][0], CLOCK_CELL_BYTES, rows,
+                EPD_BLACK);
+    x += cell->advance;
+  }
+  return height;
+}
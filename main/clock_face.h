@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include "canvas.h"
+#include "typography.h"
+
+const int CLOCK_GLYPHS = 11;          // digits and the colon
+const int CLOCK_CELL_BYTES = 6;
+const int CLOCK_CELL_ROWS = 56;
+
+// "HH:MM" of the main screen. The digits and the colon are rasterized
+// once into byte aligned cells, every minute they are only copied into
+// the canvas a byte at a time. The result is the same as printing the
+// string centered with Typography.
+class ClockFace {
+ private:
+  struct Cell {
+    uint8_t bits[CLOCK_CELL_ROWS][CLOCK_CELL_BYTES];
+    uint8_t advance;
+    uint8_t height;
+  };
+
+  Canvas &canvas;
+  const UnicodeFont *font = 0;
+  int font_page_count = 0;
+  const uint8_t *font_index = 0;
+  bool ready = false;
+  int16_t top = 0;   // first used row of the cells relative to the cursor
+  int16_t rows = 0;
+  Cell cells[CLOCK_GLYPHS];
+
+  bool build();
+  void render(Cell& cell, uint32_t sym);
+
+ public:
+  ClockFace(Canvas& tgt): canvas(tgt) {}
+
+  void SetFont(const UnicodeFont *subj, int page_count,
+               const uint8_t *index = 0);
+
+  // returns the height of the text like Typography::PrintCentered(),
+  // 0 when the font doesn't fit the cells
+  uint16_t PrintCentered(int hour, int min, int16_t y);
+};
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstdint>
+#include <gfxfont.h>
+
+// Reads glyph bitmaps row by row. Plain Adafruit-GFX bitmaps are bit
+// packed without any per row padding. Compressed ones (fontconvert -c)
+// have the empty columns trimmed via xOffset/width and begin with a mask
+// of (height + 7) / 8 bytes, a bit per row, most significant first. Only
+// the rows with a set bit follow, packed the same way. Empty glyphs
+// (width 0) have no bitmap at all.
+class GlyphStream {
+ private:
+  const uint8_t *mask = 0;
+  const uint8_t *bits;
+  uint8_t width;
+  uint8_t height;
+  uint8_t row = 0;
+  uint8_t acc = 0;
+  uint8_t left = 0;    // bits remaining in acc
+
+ public:
+  GlyphStream(const GFXfont *font, const GFXglyph *glyph, bool compressed)
+    : bits(font->bitmap + glyph->bitmapOffset),
+      width(glyph->width), height(glyph->height) {
+    if (!width)
+      height = 0;
+    else if (compressed) {
+      mask = bits;
+      bits += (height + 7) / 8;
+    }
+  }
+
+  bool done() const {
+    return row >= height;
+  }
+
+  // Moves to the next row, returns false when it is empty, the pixels
+  // of a non empty row have to be read with pixel() or readRow() before
+  // the next call
+  bool nextRow() {
+    uint8_t y = row++;
+    return !mask || (mask[y / 8] & (0x80 >> (y & 7)));
+  }
+
+  // Reads the width pixels of the row into dst, most significant bit
+  // first, the bits past the width are cleared
+  void readRow(uint8_t *dst) {
+    int n = width;
+    for (; n >= 8; n -= 8)
+      *dst++ = take(8);
+    if (n)
+      *dst = take(n) << (8 - n);
+  }
+
+  // next 1..8 bits as the low bits of the result
+  uint8_t take(int n) {
+    // only the upper `left` bits of acc are ever set
+    uint8_t result = acc >> (8 - n);
+    if (left >= n) {
+      acc <<= n;
+      left -= n;
+      return result;
+    }
+    uint8_t next = *bits++;
+    n -= left;
+    result |= next >> (8 - n);
+    acc = next << n;
+    left = 8 - n;
+    return result;
+  }
+
+  bool pixel() {
+    if (!left) {
+      acc = *bits++;
+      left = 8;
+    }
+    --left;
+    bool result = acc & 0x80;
+    acc <<= 1;
+    return result;
+  }
+};
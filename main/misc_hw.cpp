@@ -1,6 +1,10 @@
 #include "misc_hw.h"
 #include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <esp_attr.h>
 #include <esp_log.h>
+#include <esp_timer.h>
+#include <sys/time.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/queue.h>
 #include <freertos/task.h>
@@ -8,16 +12,19 @@
 #include <esp_adc/adc_oneshot.h>
 #include <driver/i2c_master.h>
 #include <pcf8563.h>
+#include <atomic>
 #include <cstring>
-#include <nvs_flash.h>
 
 #include "utils.h"
+#include "trace.h"
+#include "telemetry.h"
 
 #define VIB_MOTOR_PIN GPIO_NUM_13
 #define BUTTON_MENU_GPIO GPIO_NUM_26
 #define BUTTON_BACK_GPIO GPIO_NUM_25
 #define BUTTON_UP_GPIO GPIO_NUM_35
 #define BUTTON_DOWN_GPIO GPIO_NUM_4
+#define RTC_INT_GPIO GPIO_NUM_27   // open drain, active low
 #define ALL_BUTTONS ((1ULL << BUTTON_MENU_GPIO) | (1ULL << BUTTON_BACK_GPIO) | (1ULL << BUTTON_UP_GPIO) | (1ULL << BUTTON_DOWN_GPIO))
 #define BOUNCE_TIMEOUT 32
 
@@ -25,87 +32,241 @@
 adc_oneshot_unit_handle_t adc_handle; 
 gpio_num_t buttons_gpio[4] = {BUTTON_MENU_GPIO, BUTTON_BACK_GPIO, BUTTON_UP_GPIO, BUTTON_DOWN_GPIO};
 TimerHandle_t debounce_timers[4];
+static int wake_button = -1;
 
 
-void vibrate(uint8_t intervalMs, uint8_t length) {
-  bool motorOn = false;
-  for (int i = 0; i < length; i++) {
-    motorOn = !motorOn;
-    gpio_set_level(VIB_MOTOR_PIN, motorOn);
-    vTaskDelay(intervalMs / portTICK_PERIOD_MS);
+struct VibrationPattern {
+  uint16_t steps[8];    // milliseconds on, off, on..., up to a 0
+  uint8_t repeat;
+};
+
+static const VibrationPattern vibration_patterns[VIBRATIONS] = {
+  {{75, 75}, 3},        // VIBRATE_MESSAGE
+  {{100, 100}, 15},     // VIBRATE_CALL
+  {{50, 50}, 5},        // VIBRATE_FIND
+};
+
+// The player state belongs to the timer task, the other tasks only
+// post a request, the pattern index + 1 or VIBRATION_STOP
+#define VIBRATION_STOP 0xff
+static std::atomic<uint8_t> vibration_request(0);
+static std::atomic<bool> vibration_active(false);
+static TimerHandle_t vibration_timer;
+static const VibrationPattern *vibration_pattern;
+static uint8_t vibration_step;
+static uint8_t vibration_round;
+static int64_t vibration_start;
+
+static void finish_vibration() {
+  gpio_set_level(VIB_MOTOR_PIN, 0);
+  vibration_pattern = 0;
+  vibration_active = false;
+  trace(TRACE_VIBRATE, vibration_start);
+}
+
+static void on_vibration_timer(TimerHandle_t timer) {
+  uint8_t request = vibration_request.exchange(0);
+  if (request == VIBRATION_STOP) {
+    if (vibration_pattern)
+      finish_vibration();
+    vibration_active = false;
+    return;
+  }
+  if (request) {
+    if (!vibration_pattern)
+      vibration_start = trace_start();
+    vibration_pattern = &vibration_patterns[request - 1];
+    vibration_step = 0;
+    vibration_round = 0;
+  } else if (!vibration_pattern)
+    return;
+  else if (++vibration_step == 8 ||
+           !vibration_pattern->steps[vibration_step]) {
+    vibration_step = 0;
+    if (++vibration_round == vibration_pattern->repeat) {
+      finish_vibration();
+      return;
+    }
   }
+  gpio_set_level(VIB_MOTOR_PIN, !(vibration_step & 1));
+  xTimerChangePeriod(timer,
+                     pdMS_TO_TICKS(vibration_pattern->steps[vibration_step]),
+                     0);
+}
+
+static void request_vibration(uint8_t request) {
+  if (!vibration_timer)
+    vibration_timer = xTimerCreate(NULL, 1, pdFALSE, 0, on_vibration_timer);
+  vibration_request = request;
+  vibration_active = true;
+  // the callback takes the request on the next tick
+  xTimerChangePeriod(vibration_timer, 1, portMAX_DELAY);
+}
+
+void vibrate(Vibration pattern) {
+  request_vibration(pattern + 1);
+}
+
+void stop_vibration() {
+  if (vibration_active)
+    request_vibration(VIBRATION_STOP);
+}
+
+bool vibrating() {
+  return vibration_active;
 }
 
+// seconds between the RTC reads which correct the system clock
+#define TIME_SYNC_INTERVAL 3600
+// microseconds the system clock may lag behind the RTC
+#define TIME_PRECISION 10000
+
 // millivolts
 #define BATTERY_MAX 2900
 #define BATTERY_MIN 2300
-
-void Battery::flush() {
-  if (log_idx < 5)
-    return;
-  // Something happens during flush and deepsleep
-  // So that it starts vibrating
-  // This is kinda walkaround
-  // vTaskDelay(5000 / portTICK_PERIOD_MS);
-  // ESP_LOGI(__FILE__, "Storing battery log");
-  // append_nvs_block("whatchee.batt", log, log_idx * 2);
-  log_idx = 0;
+#define BATTERY_CURVE_STEP 25
+// seconds
+#define BATTERY_SAMPLE_INTERVAL 300
+#define BATTERY_LOG_INTERVAL (2 * BATTERY_SAMPLE_INTERVAL)
+#define BATTERY_OVERSAMPLING 4
+// log entries the discharge rate is fitted to, at least
+#define BATTERY_FIT_MIN 6
+
+// Charge in percent at BATTERY_MIN + i * BATTERY_CURVE_STEP. A typical
+// LiPo discharge curve (4.2 V full, 3.27 V empty) scaled to the range
+// the ADC reports, so the steep ends take few percent.
+static const uint8_t battery_curve[] = {
+  0, 1, 1, 2, 2, 3, 3, 4, 5, 6, 8, 12, 21,
+  31, 43, 55, 62, 67, 73, 78, 82, 86, 92, 96, 100};
+
+// interpolated between the points of the curve, percent
+static int battery_percent(int millivolts) {
+  const int last = sizeof(battery_curve) - 1;
+  int offset = millivolts - BATTERY_MIN;
+  if (offset <= 0)
+    return 0;
+  int i = offset / BATTERY_CURVE_STEP;
+  if (i >= last)
+    return 100;
+  int rest = offset % BATTERY_CURVE_STEP;
+  return battery_curve[i] +
+    (battery_curve[i + 1] - battery_curve[i]) * rest / BATTERY_CURVE_STEP;
 }
 
+// the older half of a full log is dropped
 void Battery::append_log(uint16_t subj) {
   ESP_LOGI(__FILE__, "Logging battery, %u", subj);
-  log[log_idx++] = subj;
-  if (log_idx >= 100)
-    flush();
+  telemetry_append(TELEMETRY_BATTERY, subj);
+  if (history.log_idx == BATTERY_LOG_SIZE) {
+    const int half = BATTERY_LOG_SIZE / 2;
+    memmove(history.log, history.log + half, half * sizeof(history.log[0]));
+    history.log_idx = half;
+    history.fit_start =
+      history.fit_start > half ? history.fit_start - half : 0;
+  }
+  history.log[history.log_idx++] = subj;
 }
 
-void Battery::measure(struct tm* now) {
-  time_t new_time = now ? mktime(now) : time(0);
+void Battery::measure(bool valid) {
+  time_t new_time = time(0);
+  if (history.valid &&
+      new_time / BATTERY_SAMPLE_INTERVAL ==
+      history.time / BATTERY_SAMPLE_INTERVAL)
+    return;
+  sample(new_time);
   int new_voltage = get_voltage();
-  up_count = new_voltage > prev_voltage ? up_count + 1 : 0;
-  if (up_count > 5 || start_voltage == 0) {
-    start_voltage = new_voltage;
-    start_time = new_time;
-    discharge_rate = 0;
+  history.up_count =
+    new_voltage > history.prev_voltage ? history.up_count + 1 : 0;
+  if (valid && new_time % BATTERY_LOG_INTERVAL < BATTERY_SAMPLE_INTERVAL)
+    append_log(new_voltage);
+  if (history.up_count > 5 || history.start_voltage == 0) {
+    history.start_voltage = new_voltage;
+    history.start_time = new_time;
+    history.fit_start = history.log_idx;
+    history.discharge_rate = 0;
     ESP_LOGI(__FILE__, "Charging: %u", new_voltage);
   } else {
-    discharge_rate = (start_voltage - new_voltage) * 100 * 24 * 3600 /
-      ((new_time - start_time) * (BATTERY_MAX - BATTERY_MIN));
+    history.discharge_rate = fit_discharge_rate(new_voltage, new_time);
     ESP_LOGI(__FILE__, "Disharging: %u", new_voltage);
   }
-  prev_voltage = new_voltage;
-  prev_time = new_time;
-  if (now && (now->tm_min % 10) == 0) {
-    append_log(get_voltage());
-  }
+  history.prev_voltage = new_voltage;
+  history.prev_time = new_time;
+}
+
+// Least squares slope of the charge over the log entries since the last
+// charge, percent a day. Before there are enough of them, from the
+// charge lost since then.
+uint8_t Battery::fit_discharge_rate(int voltage, time_t now) {
+  int n = history.log_idx - history.fit_start;
+  float rate;
+  if (n >= BATTERY_FIT_MIN) {
+    float sum_x = 0, sum_y = 0, sum_xx = 0, sum_xy = 0;
+    for (int i = 0; i < n; ++i) {
+      float y = battery_percent(history.log[history.fit_start + i]);
+      sum_x += i;
+      sum_y += y;
+      sum_xx += (float)i * i;
+      sum_xy += i * y;
+    }
+    float slope = (n * sum_xy - sum_x * sum_y) / (n * sum_xx - sum_x * sum_x);
+    rate = -slope * (24 * 3600 / BATTERY_LOG_INTERVAL);
+  } else if (now > history.start_time)
+    rate = (float)(battery_percent(history.start_voltage) -
+                   battery_percent(voltage)) *
+      24 * 3600 / (now - history.start_time);
+  else
+    rate = 0;
+  return rate < 0 ? 0 : rate > 255 ? 255 : (uint8_t)rate;
 }
 
 uint8_t Battery::get_level() {
-  int millivolts = get_voltage();
-  uint8_t level = (millivolts - BATTERY_MIN) * 100 / (BATTERY_MAX - BATTERY_MIN);
-  return level > 100 ? 100 : level;
+  return battery_percent(get_voltage());
 }
 
-int Battery::get_voltage() {
-  int battery_voltage;
-  // GPIO_34 corresponds to ADC1 channel 6
-  ESP_ERROR_CHECK(adc_oneshot_read(adc_handle, ADC_CHANNEL_6, &battery_voltage));
+// oversampled, millivolts
+int Battery::read_voltage() {
+  int sum = 0;
+  int64_t start = trace_start();
+  for (int i = 0; i < BATTERY_OVERSAMPLING; ++i) {
+    int raw;
+    // GPIO_34 corresponds to ADC1 channel 6
+    ESP_ERROR_CHECK(adc_oneshot_read(adc_handle, ADC_CHANNEL_6, &raw));
+    sum += raw;
+  }
+  trace(TRACE_ADC, start);
   // 2 - battery voltage divided by two resistors
   // 2450 - max voltage for ADC_ATTEN_DB_12
   // 4096 - levels for 12bit ADC mode
-  return battery_voltage * 2 * 2450 / 4096;
+  return sum * 2 * 2450 / (4096 * BATTERY_OVERSAMPLING);
+}
+
+// exponential moving average, a quarter of the new sample
+void Battery::sample(time_t now) {
+  int millivolts = read_voltage() * 16;
+  if (history.valid)
+    history.millivolts += (millivolts - history.millivolts) / 4;
+  else
+    history.millivolts = millivolts;
+  history.time = now;
+  history.valid = true;
+}
+
+int Battery::get_voltage() {
+  if (!history.valid)
+    sample(time(0));
+  return history.millivolts / 16;
 }
 
 uint8_t Battery::get_discharge_rate() {
-  return discharge_rate;
+  return history.discharge_rate;
 }
 
 void on_debounce_timer(TimerHandle_t timer) {
-  uint32_t btn = (uint32_t) pvTimerGetTimerID(timer);
+  uint32_t btn = (uintptr_t)pvTimerGetTimerID(timer);
   gpio_num_t gpio_pin = buttons_gpio[btn];
   int level = gpio_get_level(gpio_pin);
   ESP_LOGD(__FILE__, "Pin %lu level is %d\n", btn, level);
-  struct Message msg = {level ? BUTTON_PRESSED : BUTTON_RELEASED, (void *)btn};
+  struct Message msg = {level ? BUTTON_PRESSED : BUTTON_RELEASED, (void *)(uintptr_t)btn};
   xQueueSend(main_queue, &msg, 0);
   gpio_set_intr_type(gpio_pin,
                      level ? GPIO_INTR_LOW_LEVEL : GPIO_INTR_HIGH_LEVEL);
@@ -117,7 +278,7 @@ void debounce(unsigned btn) {
     debounce_timers[btn] = xTimerCreate(NULL,
                                         pdMS_TO_TICKS(BOUNCE_TIMEOUT),
                                         pdFALSE,
-                                        (void *)btn,
+                                        (void *)(uintptr_t)btn,
                                         on_debounce_timer);
   }
   if (xTimerIsTimerActive(debounce_timers[btn]) == pdFALSE) {
@@ -126,16 +287,16 @@ void debounce(unsigned btn) {
 }
 
 void button_handler(void* arg) {
-  uint32_t btn = (uint32_t) arg;
+  uint32_t btn = (uintptr_t)arg;
   gpio_intr_disable(buttons_gpio[btn]);
-  struct Message msg = {BUTTON_CHANGED, (void *)btn};
+  struct Message msg = {BUTTON_CHANGED, (void *)(uintptr_t)btn};
   xQueueSendFromISR(main_queue, &msg, NULL);
 }
 
 bool handle_misc_hw_events(Message msg) {
   if (msg.type == BUTTON_CHANGED) {
-    ESP_LOGD(__FILE__, "Button %u has changed", (unsigned)msg.data);
-    debounce((unsigned)msg.data);
+    ESP_LOGD(__FILE__, "Button %u has changed", (unsigned)(uintptr_t)msg.data);
+    debounce((unsigned)(uintptr_t)msg.data);
     return true;
   }
   return false;
@@ -181,70 +342,136 @@ pcf8563_t pcf = {.read = &i2c_read,
                  .write = &i2c_write,
                  .handle = 0};
 
-bool get_rtc_time(tm* t) {
-  if (int err = pcf8563_read(&pcf, t)) {
+// The system clock keeps the time between the RTC reads, it must not
+// run ahead of the RTC. A read only tells that the second began within
+// the last second, so after the read the clock may lag up to a second.
+// The lag is found by bisection: the RTC is read a bit before the minute
+// change of the clock, if it shows the new minute already the clock is
+// advanced. The probes take the place of the minute tick's own wake.
+static bool time_synced = false;
+static time_t time_synced_at = 0;
+static int64_t time_lag = 0;    // bound of the lag, microseconds
+
+static int64_t clock_us(const timeval& tv) {
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+static void set_clock_us(int64_t us) {
+  struct timeval tv = {(time_t)(us / 1000000), (suseconds_t)(us % 1000000)};
+  settimeofday(&tv, 0);
+}
+
+// start and end are the system clock before and after the read
+static bool read_rtc(time_t& rtc, int64_t& start, int64_t& end) {
+  struct tm t;
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  start = clock_us(tv);
+  if (int err = pcf8563_read(&pcf, &t)) {
     ESP_LOGE(__FILE__, "Error getting RTC time %d", err);
     return false;
   }
+  gettimeofday(&tv, 0);
+  end = clock_us(tv);
+  rtc = mktime(&t);
   return true;
 }
 
-void set_rtc_time(tm* t) {
+static bool sync_time() {
+  time_t rtc;
+  int64_t start, end;
+  if (!read_rtc(rtc, start, end))
+    return false;
+  int64_t rtc_us = (int64_t)rtc * 1000000;
+  if (start >= rtc_us && start - rtc_us < TIME_PRECISION)
+    // read right after the clock's second began, it is close enough
+    time_lag = rtc_us + 1000000 - start;
+  else {
+    set_clock_us(rtc_us);
+    time_lag = 1000000 + end - start;
+  }
+  time_synced_at = rtc;
+  return true;
+}
+
+bool get_time(tm* t) {
+  time_t now = time(0);
+  if (!time_synced || now - time_synced_at >= TIME_SYNC_INTERVAL) {
+    time_synced = sync_time();
+    now = time(0);
+  }
+  localtime_r(&now, t);
+  return time_synced;
+}
+
+void set_time(tm* t) {
+  time_t now = mktime(t);
+  set_clock_us((int64_t)now * 1000000);
   if (int err = pcf8563_write(&pcf, t))
     ESP_LOGE(__FILE__, "Error setting RTC time %d", err);
+  time_synced = true;
+  time_synced_at = now;
+  // the phone's time is to the second too
+  time_lag = 1000000;
 }
 
-void clear_rtc_timer() {
-  uint8_t tmp = ~PCF8563_TF;
-  pcf8563_ioctl(&pcf, PCF8563_CONTROL_STATUS2_WRITE, &tmp);
+int64_t time_probe_lead() {
+  return time_synced && time_lag > TIME_PRECISION ? time_lag / 2 : 0;
 }
 
-void set_rtc_timer(uint8_t minutes) {
-  uint8_t control = PCF8563_TIMER_ENABLE | PCF8563_TIMER_1_60HZ;
-  pcf8563_ioctl(&pcf, PCF8563_TIMER_WRITE, &minutes);
-  pcf8563_ioctl(&pcf, PCF8563_TIMER_CONTROL_WRITE, &control);
+bool probe_time() {
+  struct timeval tv;
+  gettimeofday(&tv, 0);
+  if (tv.tv_sec % 60 != 59)
+    // too late for a probe, the minute has begun
+    return true;
+  time_t rtc;
+  int64_t start, end;
+  if (!read_rtc(rtc, start, end)) {
+    time_lag = 0;
+    return true;
+  }
+  int64_t rtc_us = (int64_t)rtc * 1000000;
+  if (rtc_us + 1000000 <= start) {
+    // the clock has run ahead
+    set_clock_us(rtc_us);
+    time_lag = 1000000 + end - start;
+    return false;
+  }
+  if (rtc_us > end) {
+    // the RTC shows the new minute, the clock lags at least this much
+    int64_t lag = rtc_us - end;
+    set_clock_us(rtc_us);
+    if (lag > time_lag)
+      // the clock has drifted out of the bounds
+      time_lag = 1000000 + end - start;
+    else
+      time_lag -= lag;
+    return true;
+  }
+  if (rtc_us + 1000000 - start < time_lag)
+    time_lag = rtc_us + 1000000 - start;
+  return false;
 }
 
-int8_t find_last_bloc(nvs_handle_t handle) {
-  nvs_iterator_t it = 0;
-  int8_t block = -1;
-  esp_err_t res = nvs_entry_find_in_handle(handle, NVS_TYPE_BLOB, &it);
-  while (res == ESP_OK) {
-    nvs_entry_info_t info;
-    nvs_entry_info(it, &info);
-    int key = atoi(info.key);
-    if (key > block)
-      block = (int8_t) key;
-    res = nvs_entry_next(&it);
-  }
-  return block;
+void clear_rtc_timer() {
+  // stops the countdown, clears TF and releases the interrupt line
+  uint8_t tmp = 0;
+  pcf8563_ioctl(&pcf, PCF8563_TIMER_CONTROL_WRITE, &tmp);
+  pcf8563_ioctl(&pcf, PCF8563_CONTROL_STATUS2_WRITE, &tmp);
 }
 
-void delete_block_before(nvs_handle_t handle, int8_t block_no) {
-  esp_err_t res = ESP_OK;
-  for (int8_t no = block_no; no >= 0 && res == ESP_OK; --no) {
-    char key[5];
-    sprintf(key, "%d", no);
-    res = nvs_erase_key(handle, key);
-  }
+void set_rtc_timer(uint8_t seconds) {
+  uint8_t control = PCF8563_TIMER_ENABLE | PCF8563_TIMER_1HZ;
+  uint8_t status = PCF8563_TIE;
+  pcf8563_ioctl(&pcf, PCF8563_TIMER_WRITE, &seconds);
+  pcf8563_ioctl(&pcf, PCF8563_TIMER_CONTROL_WRITE, &control);
+  pcf8563_ioctl(&pcf, PCF8563_CONTROL_STATUS2_WRITE, &status);
 }
 
-void append_nvs_block(const char *name, void *buf, size_t size) {
-  nvs_handle_t handle;
-  esp_err_t res = nvs_open(name, NVS_READWRITE, &handle);
-  if (res == ESP_OK) {
-    int8_t block_no = find_last_bloc(handle) + 1;
-    int8_t old_no = block_no - 10;
-    if (old_no >= 0)
-      delete_block_before(handle, old_no);
-    if (block_no > 99)
-      block_no = 0;
-    char key[5];
-    sprintf(key, "%d", block_no);
-    nvs_set_blob(handle, key, buf, size);
-    nvs_commit(handle);
-    nvs_close(handle);
-  }
+void enable_rtc_wakeup(uint8_t seconds) {
+  set_rtc_timer(seconds);
+  esp_sleep_enable_ext0_wakeup(RTC_INT_GPIO, 0);
 }
 
 void setup_battery_adc() {
@@ -262,6 +489,13 @@ void setup_battery_adc() {
 }
 
 void setup_buttons() {
+  wake_button = -1;
+  if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT1) {
+    uint64_t pins = esp_sleep_get_ext1_wakeup_status();
+    for (int i = 0; i < 4; i++)
+      if (pins & (1ULL << buttons_gpio[i]))
+        wake_button = i;
+  }
   gpio_config_t io_conf = {}; 
   io_conf.intr_type = GPIO_INTR_HIGH_LEVEL;
   io_conf.pin_bit_mask = ALL_BUTTONS;
@@ -269,12 +503,30 @@ void setup_buttons() {
   gpio_config(&io_conf);
   gpio_install_isr_service(0);
   for (unsigned i = 0; i < 4; i++) {
+    // the press which has woken the watch is reported by wakeup_button()
+    if ((int)i == wake_button)
+      gpio_set_intr_type(buttons_gpio[i], GPIO_INTR_LOW_LEVEL);
     gpio_wakeup_enable(buttons_gpio[i], GPIO_INTR_HIGH_LEVEL);
-    gpio_isr_handler_add(buttons_gpio[i], button_handler, (void*) i);
+    gpio_isr_handler_add(buttons_gpio[i], button_handler, (void*)(uintptr_t)i);
   }
 }
 
+int wakeup_button() {
+  return wake_button;
+}
+
+void enable_button_wakeup() {
+  // a button which is still held would wake the watch right away
+  while (gpio_get_level(BUTTON_MENU_GPIO) || gpio_get_level(BUTTON_BACK_GPIO) ||
+         gpio_get_level(BUTTON_UP_GPIO) || gpio_get_level(BUTTON_DOWN_GPIO))
+    vTaskDelay(pdMS_TO_TICKS(BOUNCE_TIMEOUT));
+  esp_sleep_enable_ext1_wakeup(ALL_BUTTONS, ESP_EXT1_WAKEUP_ANY_HIGH);
+}
+
 void setup_rtc() {
+  // the system clock is read back from the RTC after every boot
+  time_synced = false;
+  time_lag = 0;
   int err = i2c_new_master_bus(&i2c_mst_config, &bus_handle);
   if (err)
     ESP_LOGE(__FILE__, "Master bus init error, %d", err);
@@ -12,37 +12,97 @@
 #define BUTTON_PRESSED 2u
 #define BUTTON_RELEASED 3u
 
-void vibrate(uint8_t intervalMs, uint8_t length);
+enum Vibration : uint8_t {
+  VIBRATE_MESSAGE,
+  VIBRATE_CALL,
+  VIBRATE_FIND,
+  VIBRATIONS
+};
+
+// Starts playing the pattern and returns right away, a pattern which is
+// still playing is replaced. The motor is switched by a FreeRTOS timer,
+// so the CPU can light-sleep between the pulses.
+void vibrate(Vibration pattern);
+
+void stop_vibration();
+
+bool vibrating();
 
 void setup_misc_hw();
 
+// the button which has woken the watch from deep sleep, -1 for other
+// wake-ups, only its release comes as a message
+int wakeup_button();
+
+// any button wakes the watch from deep sleep, waits for the buttons to
+// be released
+void enable_button_wakeup();
+
 bool handle_misc_hw_events(Message msg);
 
-bool get_rtc_time(tm* t);
+// The time from the system clock, the RTC is read over I2C only after
+// boot and then once an hour to correct it. False until a read has
+// succeeded.
+bool get_time(tm* t);
+
+// How long before the clock's next minute change the RTC should be read
+// by probe_time(), to find out how far the clock lags behind. 0 when the
+// lag is known closely enough.
+int64_t time_probe_lead();
 
-void set_rtc_time(tm* t);
+// true when the RTC has shown the new minute and the clock has been
+// advanced to it, or there was nothing to probe
+bool probe_time();
 
+// sets both the system clock and the RTC
+void set_time(tm* t);
+
+// stops the timer and acknowledges its interrupt
 void clear_rtc_timer();
 
-void set_rtc_timer(uint8_t minutes);
+// the interrupt line goes low in the given number of seconds, the 1 Hz
+// countdown keeps the wake aligned to the RTC seconds
+void set_rtc_timer(uint8_t seconds);
+
+// arms the timer and wakes from deep sleep on its interrupt
+void enable_rtc_wakeup(uint8_t seconds);
 
-void append_nvs_block(const char *name, void *buf, size_t size);
+const int BATTERY_LOG_SIZE = 100;
+
+// The samples of the previous wakes, the filter, the charge detection
+// and the discharge rate need them. The owner keeps it in RTC memory, it
+// starts zeroed after power-on.
+struct BatteryHistory {
+  int32_t millivolts;     // filtered, 1/16 mV
+  time_t time;            // of the last sample
+  bool valid;             // there has been a sample
+  int start_voltage;      // 0 until the first sample
+  time_t start_time;
+  int prev_voltage;
+  time_t prev_time;
+  unsigned up_count;
+  uint8_t discharge_rate;
+  uint16_t log[BATTERY_LOG_SIZE];   // every 10 minutes
+  uint8_t log_idx;
+  uint8_t fit_start;      // first log entry after the last charge
+};
 
 class Battery {
  private:
-  int start_voltage;
-  time_t start_time;
-  int prev_voltage = 0;
-  time_t prev_time = 0;
-  unsigned up_count = 0;
-  uint8_t discharge_rate = 0;
-  uint16_t log[100];
-  uint8_t log_idx = 0;
+  BatteryHistory &history;
   void append_log(uint16_t subj);
+  uint8_t fit_discharge_rate(int voltage, time_t now);
+  int read_voltage();
+  void sample(time_t now);
  public:
-  void measure(struct tm* now);
+  Battery(BatteryHistory &subj): history(subj) {}
+
+  // samples the ADC when the current BATTERY_SAMPLE_INTERVAL slot hasn't
+  // been sampled yet
+  // valid is false when the clock hasn't been set
+  void measure(bool valid);
+  // the filtered value, the ADC is only read before the first sample
   uint8_t get_level();
   int get_voltage();
   uint8_t get_discharge_rate();
-  void flush();
 };
@@ -0,0 +1,167 @@
+#include "notifications.h"
+#include <esp_attr.h>
+#include <esp_log.h>
+#include <string.h>
+
+static const char* TAG = "notifications";
+
+static const uint32_t STORE_MAGIC = 0x4e4f5433;
+
+RTC_DATA_ATTR NotificationStore notification_store;
+
+static size_t record_size(size_t length) {
+  return (sizeof(Notification) + length + 1 + 3) & ~3;
+}
+
+// FNV-1a
+static uint32_t hash(uint32_t h, const void* data, size_t size) {
+  const uint8_t* p = (const uint8_t*)data;
+  for (size_t i = 0; i < size; ++i)
+    h = (h ^ p[i]) * 16777619u;
+  return h;
+}
+
+uint32_t NotificationBuffer::checksum() {
+  uint32_t h = hash(2166136261u, &store,
+                    offsetof(NotificationStore, checksum));
+  for (int i = 0; i < store.count; ++i)
+    h = hash(h, at(i), record_size(at(i)->length));
+  return h;
+}
+
+void NotificationBuffer::seal() {
+  store.checksum = checksum();
+}
+
+void NotificationBuffer::Restore() {
+  bool valid = store.magic == STORE_MAGIC &&
+    store.count >= 0 && store.count <= NOTIFICATION_LIMIT &&
+    store.first >= 0 && store.first < NOTIFICATION_LIMIT &&
+    store.current >= -1 && store.current < store.count &&
+    store.tail <= NOTIFICATION_ARENA_SIZE;
+  for (int i = 0; valid && i < store.count; ++i) {
+    size_t offset = store.offsets[(store.first + i) % NOTIFICATION_LIMIT];
+    valid = offset + sizeof(Notification) <= NOTIFICATION_ARENA_SIZE &&
+      offset + record_size(at(i)->length) <= NOTIFICATION_ARENA_SIZE;
+  }
+  if (valid && store.checksum == checksum()) {
+    ESP_LOGI(TAG, "%d notifications restored", store.count);
+    return;
+  }
+  memset(&store, 0, offsetof(NotificationStore, arena));
+  store.magic = STORE_MAGIC;
+  store.next_id = 1;
+  store.current = -1;
+  seal();
+}
+
+bool NotificationBuffer::overlaps(size_t start, size_t size) {
+  for (int i = 0; i < store.count; ++i) {
+    size_t offset = (uint8_t*)at(i) - store.arena;
+    if (offset < start + size && start < offset + record_size(at(i)->length))
+      return true;
+  }
+  return false;
+}
+
+void NotificationBuffer::evict() {
+  store.first = (store.first + 1) % NOTIFICATION_LIMIT;
+  --store.count;
+  if (store.current < 0)
+    return;
+  if (--store.current < 0)
+    store.current = 0;
+  while (store.current < store.count && !at(store.current)->visible)
+    ++store.current;
+  if (store.current == store.count)
+    store.current = -1;
+}
+
+char* NotificationBuffer::Begin(size_t &length, uint8_t icon, uint8_t state) {
+  if (length > NOTIFICATION_TEXT_LIMIT)
+    length = NOTIFICATION_TEXT_LIMIT;
+  size_t size = record_size(length);
+  lock();
+  size_t start = store.tail + size > NOTIFICATION_ARENA_SIZE ? 0 : store.tail;
+  while (store.count &&
+         (store.count == NOTIFICATION_LIMIT || overlaps(start, size)))
+    evict();
+  seal();
+  pending = (Notification*)(store.arena + start);
+  pending->id = store.next_id++;
+  pending->length = length;
+  pending->icon = icon;
+  pending->state = state;
+  pending->visible = false;
+  pending->text()[length] = 0;
+  unlock();
+  return pending->text();
+}
+
+uint32_t NotificationBuffer::Commit() {
+  if (!pending)
+    return 0;
+  lock();
+  size_t offset = (uint8_t*)pending - store.arena;
+  store.offsets[(store.first + store.count) % NOTIFICATION_LIMIT] = offset;
+  ++store.count;
+  store.tail = offset + record_size(pending->length);
+  uint32_t id = pending->id;
+  pending = 0;
+  seal();
+  unlock();
+  return id;
+}
+
+Notification* NotificationBuffer::find(uint32_t id) {
+  for (int i = 0; i < store.count; ++i)
+    if (at(i)->id == id)
+      return at(i);
+  return 0;
+}
+
+void NotificationBuffer::show(uint32_t id) {
+  for (int i = 0; i < store.count; ++i)
+    if (at(i)->id == id) {
+      at(i)->visible = true;
+      store.current = i;
+    }
+  seal();
+}
+
+void NotificationBuffer::discard(uint32_t id) {
+  int pos = 0;
+  while (pos < store.count && at(pos)->id != id)
+    ++pos;
+  if (pos == store.count)
+    return;
+  for (int i = pos; i + 1 < store.count; ++i)
+    store.offsets[(store.first + i) % NOTIFICATION_LIMIT] =
+      store.offsets[(store.first + i + 1) % NOTIFICATION_LIMIT];
+  --store.count;
+  // the space of the newest record can be taken again right away
+  if (pos == store.count)
+    store.tail = pos ? (uint8_t*)at(pos - 1) - store.arena +
+      record_size(at(pos - 1)->length) : 0;
+  if (store.current > pos)
+    --store.current;
+  seal();
+}
+
+void NotificationBuffer::clear() {
+  for (int i = 0; i < store.count; ++i)
+    at(i)->visible = false;
+  store.current = -1;
+  seal();
+}
+
+void NotificationBuffer::step(int direction) {
+  if (store.current < 0)
+    return;
+  int pos = store.current;
+  do
+    pos = (pos + direction + store.count) % store.count;
+  while (!at(pos)->visible);
+  store.current = pos;
+  seal();
+}
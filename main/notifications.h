@@ -0,0 +1,132 @@
+#pragma once
+
+#include <stddef.h>
+#include <inttypes.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "typography.h"
+
+const int NOTIFICATION_LIMIT = 8;
+const size_t NOTIFICATION_ARENA_SIZE = 2048;
+// longer texts are cut, at least one notification fits the arena
+const size_t NOTIFICATION_TEXT_LIMIT = 1024;
+
+const int NOTIFICATION_PAGES = 16;
+
+// How the notification screen shows a record, worked out once when it
+// arrives
+struct NotificationLayout {
+  uint16_t code_offset;     // of the 2FA code in the text
+  uint8_t code_length;      // 0 when there is no code
+  uint8_t text_top;
+  uint8_t page_count;       // the rest of a longer text is cut
+  TextPage pages[NOTIFICATION_PAGES];
+};
+
+// Header of a record in the arena, the text and its terminating zero
+// follow it
+struct Notification {
+  uint32_t id;
+  uint16_t length;
+  uint8_t icon;
+  uint8_t state;
+  bool visible;     // hidden ones are skipped when browsing
+  NotificationLayout layout;   // valid for the visible ones
+
+  char* text() {
+    return (char*)(this + 1);
+  }
+};
+
+// Kept in RTC memory, so it survives deep sleep. There are only offsets
+// in it, no pointers. The checksum covers the fields before it and the
+// records in the ring.
+struct NotificationStore {
+  uint32_t magic;
+  uint32_t next_id;
+  uint16_t offsets[NOTIFICATION_LIMIT];   // ring, oldest first
+  uint16_t tail;           // end of the newest record
+  int8_t first;
+  int8_t count;
+  int8_t current;          // position in the ring, -1 if none
+  uint32_t checksum;
+  alignas(4) uint8_t arena[NOTIFICATION_ARENA_SIZE];
+};
+
+// The last NOTIFICATION_LIMIT notifications kept one after another in a
+// preallocated arena. A new record goes after the newest one, or to the
+// start of the arena when it doesn't fit before the end, records are
+// evicted from the oldest one until it overlaps none. There is no heap
+// allocation at all.
+//
+// The BLE task writes a text straight into the arena between Begin()
+// and Commit(), the main task reads and browses the records, it has to
+// hold the lock while it uses a record.
+class NotificationBuffer {
+ private:
+  NotificationStore &store;
+  Notification* pending = 0;
+  StaticSemaphore_t mutex_buffer;
+  SemaphoreHandle_t mutex;
+
+  Notification* at(int pos) {
+    int slot = (store.first + pos) % NOTIFICATION_LIMIT;
+    return (Notification*)(store.arena + store.offsets[slot]);
+  }
+  uint32_t checksum();
+  bool overlaps(size_t start, size_t size);
+  void evict();
+  void step(int direction);
+
+ public:
+  NotificationBuffer(NotificationStore &subj): store(subj) {
+    mutex = xSemaphoreCreateMutexStatic(&mutex_buffer);
+  }
+
+  // keeps the records of the previous boot when they are intact,
+  // before the BLE task starts
+  void Restore();
+
+  void lock() {
+    xSemaphoreTake(mutex, portMAX_DELAY);
+  }
+
+  void unlock() {
+    xSemaphoreGive(mutex);
+  }
+
+  // Starts a hidden record for a text of length bytes, length is reduced
+  // to what fits. The text has to be written before Commit(), a Begin()
+  // without Commit() drops the record.
+  char* Begin(size_t &length, uint8_t icon, uint8_t state);
+  // returns the id of the new record
+  uint32_t Commit();
+
+  // the rest is for the lock holder
+  Notification* find(uint32_t id);
+  // makes the record visible and current
+  void show(uint32_t id);
+  // after a record has been changed in place
+  void seal();
+  // drops a hidden record, so it doesn't push out the older ones
+  void discard(uint32_t id);
+
+  Notification* get_current() {
+    return store.current < 0 ? 0 : at(store.current);
+  }
+
+  uint32_t get_current_id() {
+    return store.current < 0 ? 0 : at(store.current)->id;
+  }
+
+  void clear();
+  void prev() {
+    step(-1);
+  }
+  void next() {
+    step(1);
+  }
+};
+
+extern NotificationStore notification_store;
+extern NotificationBuffer notifications;
@@ -0,0 +1,170 @@
+#include "telemetry.h"
+#include <esp_attr.h>
+#include <esp_log.h>
+#include <nvs.h>
+#include <nvs_flash.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static const char* TAG = "telemetry";
+
+#define TELEMETRY_NAMESPACE "whatchee.tlm"
+
+static const uint32_t TELEMETRY_MAGIC = 0x544c4d31;
+
+struct TelemetryBlock {
+  uint32_t seq;           // of the block since the log was started
+  uint16_t count;
+  TelemetryRecord records[TELEMETRY_BATCH];
+} __attribute__((packed));
+
+const size_t TELEMETRY_HEADER = offsetof(TelemetryBlock, records);
+
+// Kept in RTC memory, so a batch survives deep sleep
+struct TelemetryState {
+  uint32_t magic;
+  bool head_known;        // the slots have been scanned for seq
+  uint32_t seq;           // of the next block
+  uint16_t count;
+  TelemetryRecord records[TELEMETRY_BATCH];
+};
+
+RTC_DATA_ATTR static TelemetryState state;
+
+// same as setup_nvs(), but a failure is returned
+static esp_err_t init_nvs() {
+  esp_err_t err = nvs_flash_init();
+  if (err == ESP_ERR_NVS_NO_FREE_PAGES ||
+      err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+    err = nvs_flash_erase();
+    if (err == ESP_OK)
+      err = nvs_flash_init();
+  }
+  return err;
+}
+
+// wakes from deep sleep leave NVS alone until the log needs it
+static esp_err_t open_log(nvs_open_mode_t mode, nvs_handle_t* handle) {
+  esp_err_t err = nvs_open(TELEMETRY_NAMESPACE, mode, handle);
+  if (err == ESP_ERR_NVS_NOT_INITIALIZED && init_nvs() == ESP_OK)
+    err = nvs_open(TELEMETRY_NAMESPACE, mode, handle);
+  return err;
+}
+
+static void slot_key(uint32_t seq, char* key) {
+  snprintf(key, 4, "%u", (unsigned)(seq % TELEMETRY_SLOTS));
+}
+
+static bool read_block(nvs_handle_t handle, uint32_t seq,
+                       TelemetryBlock* block) {
+  char key[4];
+  slot_key(seq, key);
+  size_t size = sizeof(TelemetryBlock);
+  if (nvs_get_blob(handle, key, block, &size) != ESP_OK ||
+      size < TELEMETRY_HEADER)
+    return false;
+  if (block->count > TELEMETRY_BATCH)
+    block->count = TELEMETRY_BATCH;
+  return true;
+}
+
+// after power-on the batch is empty and the head is still to be found
+static void start_batch() {
+  if (state.magic == TELEMETRY_MAGIC)
+    return;
+  state.magic = TELEMETRY_MAGIC;
+  state.head_known = false;
+  state.seq = 0;
+  state.count = 0;
+}
+
+// the slot after the block with the highest number, until the log can
+// be opened it is tried again on every flush or read
+static bool find_head() {
+  start_batch();
+  if (state.head_known)
+    return true;
+  nvs_handle_t handle;
+  esp_err_t err = open_log(NVS_READONLY, &handle);
+  if (err == ESP_ERR_NVS_NOT_FOUND) {
+    // nothing has been written yet
+    state.seq = 0;
+    state.head_known = true;
+    return true;
+  }
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Can't scan the log, %d", err);
+    return false;
+  }
+  TelemetryBlock block;
+  state.seq = 0;
+  for (int i = 0; i < TELEMETRY_SLOTS; ++i)
+    if (read_block(handle, i, &block) && block.seq + 1 > state.seq)
+      state.seq = block.seq + 1;
+  nvs_close(handle);
+  state.head_known = true;
+  ESP_LOGI(TAG, "Next block %lu", (unsigned long)state.seq);
+  return true;
+}
+
+void telemetry_flush() {
+  if (state.magic != TELEMETRY_MAGIC || !state.count || !find_head())
+    return;
+  nvs_handle_t handle;
+  esp_err_t err = open_log(NVS_READWRITE, &handle);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Can't open the log, %d", err);
+    return;
+  }
+  TelemetryBlock block;
+  block.seq = state.seq;
+  block.count = state.count;
+  memcpy(block.records, state.records,
+         state.count * sizeof(TelemetryRecord));
+  char key[4];
+  slot_key(state.seq, key);
+  err = nvs_set_blob(handle, key, &block,
+                     TELEMETRY_HEADER + state.count * sizeof(TelemetryRecord));
+  if (err == ESP_OK)
+    err = nvs_commit(handle);
+  nvs_close(handle);
+  if (err != ESP_OK) {
+    ESP_LOGE(TAG, "Can't write block %lu, %d", (unsigned long)state.seq, err);
+    return;
+  }
+  ++state.seq;
+  state.count = 0;
+}
+
+void telemetry_append(TelemetryKind kind, uint32_t value) {
+  start_batch();
+  TelemetryRecord &record = state.records[state.count++];
+  record.time = time(0);
+  record.kind = kind;
+  record.value = value < 0xffff ? value : 0xffff;
+  if (state.count == TELEMETRY_BATCH)
+    telemetry_flush();
+  // a failed flush keeps the oldest records of the batch
+  if (state.count == TELEMETRY_BATCH)
+    --state.count;
+}
+
+int telemetry_read(int back, TelemetryRecord* out, int limit) {
+  if (!find_head())
+    return -1;
+  if (back < 0 || back >= TELEMETRY_SLOTS || (uint32_t)back >= state.seq)
+    return -1;
+  nvs_handle_t handle;
+  if (open_log(NVS_READONLY, &handle) != ESP_OK)
+    return -1;
+  TelemetryBlock block;
+  uint32_t seq = state.seq - 1 - back;
+  bool found = read_block(handle, seq, &block) && block.seq == seq;
+  nvs_close(handle);
+  if (!found)
+    return -1;
+  int count = block.count < limit ? block.count : limit;
+  memcpy(out, block.records, count * sizeof(TelemetryRecord));
+  return count;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <inttypes.h>
+
+enum TelemetryKind : uint8_t {
+  TELEMETRY_BATTERY,      // millivolts
+  TELEMETRY_DISCONNECT,   // disconnects since boot
+  TELEMETRY_WAKE,         // average wake cycle of the last hour, us
+};
+
+struct TelemetryRecord {
+  uint32_t time;          // seconds of the system clock
+  uint8_t kind;
+  uint16_t value;         // saturated
+} __attribute__((packed));
+
+const int TELEMETRY_BATCH = 32;
+const int TELEMETRY_SLOTS = 16;
+
+// Append-only log in NVS. Records are collected in RTC memory, a full
+// batch goes to the next of TELEMETRY_SLOTS blobs in a ring with a single
+// nvs_set_blob(), so the flash wear is spread over the slots and no key
+// is ever erased. The slot to write next is cached in RTC memory too,
+// after power-on the slots are read to find it before the first flush.
+void telemetry_append(TelemetryKind kind, uint32_t value);
+
+// writes a partial batch, there is no need to call it before deep sleep
+void telemetry_flush();
+
+// The slot written back blocks ago, 0 is the latest. Returns the number
+// of records put into out, -1 when there is no such block.
+int telemetry_read(int back, TelemetryRecord* out, int limit);
@@ -2,919 +2,678 @@ const UnicodeFont ter_x20b_pcf20pt[] = {
   {
     {
       (uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
-        0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x0c, 0xc3, 0x30, 0xcc, 0x33, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0x33, 0x0c, 0xc3, 0x31,
-        0xfe, 0x33, 0x0c, 0xc3, 0x31, 0xfe, 0x33, 0x0c, 0xc3, 0x30, 0xcc, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x3f, 0x1b, 0x66,
-        0xc1, 0xb0, 0x6c, 0x0f, 0xc0, 0xd8, 0x36, 0x0d, 0x9b, 0x63, 0xf0, 0x30,
-        0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x14,
-        0xc7, 0x60, 0x18, 0x0c, 0x03, 0x01, 0x80, 0x60, 0x30, 0x0d, 0xc6, 0x51,
-        0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x66,
-        0x19, 0x86, 0x60, 0xf0, 0x18, 0x0e, 0x66, 0xdb, 0x1c, 0xc3, 0x30, 0xc6,
-        0x78, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x30,
-        0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x18, 0x0c, 0x03, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
-        0x03, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x60, 0x0c, 0x03, 0x00, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
-        0x06, 0x03, 0x00, 0xc0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0xd8, 0x1c, 0x3f, 0xe1, 0xc0,
-        0xd8, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x1f, 0xe0,
-        0xc0, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x30, 0x18, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x60,
-        0x18, 0x0c, 0x03, 0x01, 0x80, 0x60, 0x30, 0x0c, 0x06, 0x01, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66,
-        0x19, 0x8e, 0x67, 0x9b, 0x67, 0x99, 0xc6, 0x61, 0x98, 0x66, 0x18, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x1c, 0x0f,
-        0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61,
-        0x98, 0x66, 0x18, 0x06, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06,
-        0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
-        0x61, 0x98, 0x60, 0x18, 0x06, 0x01, 0x87, 0xc0, 0x18, 0x06, 0x01, 0x98,
-        0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x06, 0x03, 0x81, 0xe0, 0xd8, 0x66, 0x31, 0x98, 0x66, 0x19, 0x86, 0x7f,
-        0x80, 0x60, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0xfe, 0x60, 0x18, 0x06, 0x01, 0x80, 0x7f, 0x00, 0x60, 0x18, 0x06,
-        0x01, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x7c, 0x30, 0x18, 0x06, 0x01, 0x80, 0x7f, 0x18, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0xfe, 0x61, 0x98, 0x60, 0x18, 0x0c, 0x03, 0x01, 0x80,
-        0x60, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x8f,
-        0xc6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
-        0x98, 0x63, 0xf8, 0x06, 0x01, 0x80, 0x60, 0x30, 0xf8, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-        0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x30, 0x18,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x80,
-        0xc0, 0x60, 0x30, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x30,
-        0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03,
-        0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
-        0x33, 0x18, 0x66, 0x18, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x30, 0x00, 0x00,
-        0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0xfc, 0xc1, 0xb0, 0x6c, 0xfb, 0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xcf,
-        0xb0, 0x0c, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f, 0xe6, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x7f, 0x18, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x19, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x01, 0x80, 0x60, 0x18, 0x06,
-        0x01, 0x80, 0x60, 0x18, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0xf8, 0x63, 0x18, 0x66, 0x19, 0x86, 0x61, 0x98,
-        0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x31, 0xf8, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
-        0x1f, 0x86, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0xfe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x60, 0x18, 0x06, 0x01, 0x80,
-        0x60, 0x1f, 0x86, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x01,
-        0x80, 0x60, 0x19, 0xe6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x61, 0x9f, 0xe6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x03,
-        0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0,
-        0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x03,
-        0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x63, 0x18, 0xc6,
-        0x30, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86,
-        0x61, 0x98, 0xc6, 0x61, 0xb0, 0x78, 0x1c, 0x07, 0x81, 0xb0, 0x66, 0x18,
-        0xc6, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
-        0x18, 0x06, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x02, 0x02, 0xc1, 0xb8, 0xef, 0x7b, 0x76, 0xc9, 0xb0, 0x6c, 0x1b, 0x06,
-        0xc1, 0xb0, 0x6c, 0x1b, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0xc6, 0x79, 0x9b, 0x66, 0x79,
-        0x8e, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f,
-        0xc6, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
-        0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x78, 0xfc, 0x03, 0x00, 0x60,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x9f, 0xc7, 0x81, 0xb0, 0x66, 0x18, 0xc6, 0x19, 0x86, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x01,
-        0x80, 0x60, 0x0f, 0xc0, 0x18, 0x06, 0x01, 0x98, 0x66, 0x18, 0xfc, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x0c, 0x03, 0x00,
-        0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98,
-        0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61,
-        0x98, 0x66, 0x19, 0x86, 0x33, 0x0c, 0xc3, 0x30, 0xcc, 0x1e, 0x07, 0x80,
-        0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06,
-        0xc1, 0xb0, 0x6c, 0x1b, 0x06, 0xc1, 0xb0, 0x6c, 0x9b, 0x76, 0xf7, 0xb8,
-        0xec, 0x1a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x86, 0x61, 0x98, 0x63, 0x30, 0xcc, 0x1e, 0x03, 0x01, 0xe0, 0xcc, 0x33,
-        0x18, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x86, 0x61, 0x98, 0x63, 0x30, 0xcc, 0x33, 0x07, 0x80, 0xc0, 0x30,
-        0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xfe, 0x01, 0x80, 0x60, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80,
-        0xc0, 0x60, 0x18, 0x06, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x78, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
-        0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x03, 0x00, 0xc0, 0x18, 0x06,
-        0x00, 0xc0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06,
-        0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x78, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x03, 0x01, 0xe0, 0xcc, 0x61, 0x80, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xe0, 0x00, 0x00, 0x30, 0x06, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xfc, 0x01, 0x80, 0x63, 0xf9, 0x86, 0x61, 0x98, 0x66, 0x18,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60,
-        0x18, 0x06, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66,
-        0x19, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x06, 0x01, 0x80, 0x60, 0x18,
-        0x06, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x06, 0x01, 0x80, 0x60, 0x18, 0xfe, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
-        0x98, 0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0xfe,
-        0x60, 0x18, 0x06, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1e, 0x0c, 0x03, 0x00, 0xc0, 0xfc, 0x0c, 0x03, 0x00, 0xc0,
-        0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfe, 0x01, 0x80, 0x63, 0xf0, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0xfc, 0x61, 0x98,
-        0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x70, 0x0c,
-        0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x78, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x1c,
-        0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x33, 0x0c,
-        0xc1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
-        0x86, 0x63, 0x19, 0x86, 0xc1, 0xe0, 0x6c, 0x19, 0x86, 0x31, 0x86, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0c, 0x03, 0x00,
-        0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x78,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xfc, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd9,
-        0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98,
-        0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
-        0x98, 0x66, 0x19, 0xfc, 0x60, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x18, 0xfe, 0x01, 0x80, 0x60, 0x18, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbe, 0x78, 0x1c, 0x06, 0x01,
-        0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x06,
-        0x00, 0xfc, 0x01, 0x80, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0x81, 0xf8, 0x18, 0x06,
-        0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x3c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61,
-        0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86,
-        0x61, 0x98, 0x63, 0x30, 0xcc, 0x33, 0x07, 0x80, 0xc0, 0x30, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x86, 0x61, 0x98, 0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd8, 0xfc, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x86, 0x61, 0x8c, 0xc1, 0xe0, 0x30, 0x1e, 0x0c, 0xc6, 0x19, 0x86,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18,
-        0xfe, 0x01, 0x80, 0x63, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0xfe, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06,
-        0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
-        0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x0e, 0x00, 0xc0, 0x30, 0x0c, 0x03,
-        0x00, 0xc0, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
-        0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xe0, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x01, 0xc0, 0xc0, 0x30,
-        0x0c, 0x03, 0x00, 0xc0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
-        0x66, 0xd9, 0xb6, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        0x1f, 0xf3, 0x00, 0xff, 0xff, 0xfc, 0x78, 0x00, 0x00, 0xcf, 0x3c, 0xf3,
+        0x1f, 0xff, 0x00, 0x66, 0x66, 0x66, 0x66, 0xff, 0x66, 0x66, 0x66, 0xff,
+        0x66, 0x66, 0x66, 0x66, 0x3f, 0xff, 0x80, 0x18, 0x18, 0x7e, 0xdb, 0xd8,
+        0xd8, 0xd8, 0x7e, 0x1b, 0x1b, 0x1b, 0xdb, 0x7e, 0x18, 0x18, 0x0f, 0xff,
+        0x00, 0xe7, 0x4f, 0xb0, 0x61, 0x83, 0x0c, 0x18, 0x60, 0xdf, 0x2e, 0x70,
+        0x1f, 0xff, 0x00, 0x3c, 0x33, 0x19, 0x8c, 0xc3, 0xc0, 0xc0, 0xe6, 0xdb,
+        0xc7, 0x61, 0xb0, 0xcc, 0xf3, 0xd8, 0x78, 0x00, 0x00, 0xff, 0x1f, 0xff,
+        0x00, 0x36, 0x6c, 0xcc, 0xcc, 0xcc, 0x66, 0x30, 0x1f, 0xff, 0x00, 0xc6,
+        0x63, 0x33, 0x33, 0x33, 0x66, 0xc0, 0x03, 0xf8, 0x00, 0x63, 0x1b, 0x07,
+        0x1f, 0xf1, 0xc1, 0xb1, 0x8c, 0x03, 0xf8, 0x00, 0x18, 0x18, 0x18, 0xff,
+        0x18, 0x18, 0x18, 0x00, 0x07, 0x80, 0x6d, 0xe0, 0x00, 0x40, 0x00, 0xff,
+        0x00, 0x03, 0x00, 0xf0, 0x0f, 0xff, 0x00, 0x06, 0x0c, 0x30, 0x61, 0x83,
+        0x0c, 0x18, 0x60, 0xc3, 0x06, 0x00, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3,
+        0xc3, 0xc7, 0xcf, 0xdb, 0xf3, 0xe3, 0xc3, 0xc3, 0xc3, 0x7e, 0x1f, 0xff,
+        0x00, 0x31, 0xcf, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0xfc, 0x1f,
+        0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc3, 0x03, 0x03, 0x06, 0x0c, 0x18, 0x30,
+        0x60, 0xc0, 0xff, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0x03, 0x03, 0x03,
+        0x3e, 0x03, 0x03, 0x03, 0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0x03, 0x07,
+        0x0f, 0x1b, 0x33, 0x63, 0xc3, 0xc3, 0xc3, 0xff, 0x03, 0x03, 0x03, 0x1f,
+        0xff, 0x00, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0x03, 0x03, 0x03, 0x03,
+        0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0x3e, 0x60, 0xc0, 0xc0, 0xc0, 0xfe,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0xff, 0xc3,
+        0xc3, 0x03, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f,
+        0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0x7f, 0x03, 0x03, 0x03, 0x06, 0x7c, 0x01, 0x86, 0x00, 0xff, 0x01,
+        0x87, 0x80, 0x6d, 0xb7, 0x80, 0x1f, 0xff, 0x00, 0x03, 0x06, 0x0c, 0x18,
+        0x30, 0x60, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x10, 0x00,
+        0xff, 0xff, 0x1f, 0xff, 0x00, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03,
+        0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x1f, 0xf3, 0x00, 0x3c, 0x66, 0xc3,
+        0xc3, 0x03, 0x06, 0x0c, 0x18, 0x18, 0x18, 0x18, 0x1f, 0xff, 0x00, 0x7f,
+        0x60, 0xf0, 0x79, 0xfd, 0x9e, 0xcf, 0x67, 0xb3, 0xd9, 0xe7, 0xf0, 0x18,
+        0x07, 0xf8, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x1f, 0xff, 0x00, 0xfe, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0x1f, 0xff,
+        0x00, 0x7e, 0xc3, 0xc3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3,
+        0xc3, 0x7e, 0x1f, 0xff, 0x00, 0xfc, 0xc6, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc6, 0xfc, 0x1f, 0xff, 0x00, 0xff, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0x1f, 0xff,
+        0x00, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc0, 0xc0, 0xc0, 0xcf,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x1f, 0xff,
+        0x00, 0xf6, 0x66, 0x66, 0x66, 0x66, 0x66, 0xf0, 0x1f, 0xff, 0x00, 0x0f,
+        0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xc6, 0xc6, 0xc6, 0x7c,
+        0x1f, 0xff, 0x00, 0xc3, 0xc3, 0xc6, 0xcc, 0xd8, 0xf0, 0xe0, 0xf0, 0xd8,
+        0xcc, 0xc6, 0xc3, 0xc3, 0x1f, 0xff, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0x1f, 0xff, 0x00, 0x80,
+        0xe0, 0xf8, 0xfe, 0xfd, 0xde, 0x4f, 0x07, 0x83, 0xc1, 0xe0, 0xf0, 0x78,
+        0x3c, 0x18, 0x1f, 0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xe3, 0xf3, 0xdb,
+        0xcf, 0xc7, 0xc3, 0xc3, 0xc3, 0xc3, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x1f, 0xff,
+        0x00, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0x1f, 0xff, 0xc0, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xcf, 0x7e, 0x06, 0x03, 0x1f, 0xff, 0x00, 0xfe,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xf0, 0xd8, 0xcc, 0xc6, 0xc3, 0xc3,
+        0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc0, 0xc0, 0xc0, 0x7e, 0x03, 0x03,
+        0x03, 0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18,
+        0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0xff, 0x00, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e,
+        0x1f, 0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x66, 0x66, 0x66, 0x66,
+        0x3c, 0x3c, 0x18, 0x18, 0x1f, 0xff, 0x00, 0xc1, 0xe0, 0xf0, 0x78, 0x3c,
+        0x1e, 0x0f, 0x07, 0x93, 0xdd, 0xfb, 0xf8, 0xf8, 0x38, 0x08, 0x1f, 0xff,
+        0x00, 0xc3, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0x66, 0xc3,
+        0xc3, 0xc3, 0x1f, 0xff, 0x00, 0xc3, 0xc3, 0xc3, 0x66, 0x66, 0x66, 0x3c,
+        0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0xff, 0x00, 0xff, 0x03, 0x03,
+        0x03, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0xc0, 0xc0, 0xff, 0x1f, 0xff,
+        0x00, 0xfc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xf0, 0x0f, 0xff, 0x00, 0xc1,
+        0x81, 0x83, 0x03, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x18, 0x30, 0x1f, 0xff,
+        0x00, 0xf3, 0x33, 0x33, 0x33, 0x33, 0x33, 0xf0, 0x78, 0x00, 0x00, 0x18,
+        0x3c, 0x66, 0xc3, 0x00, 0x00, 0x40, 0xff, 0xe0, 0x00, 0x00, 0xc6, 0x30,
+        0x01, 0xff, 0x00, 0x7e, 0x03, 0x03, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f,
+        0x1f, 0xff, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xfe, 0x01, 0xff, 0x00, 0x7e, 0xc3, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0x03, 0x03, 0x03, 0x03, 0x7f,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x01, 0xff, 0x00, 0x7e,
+        0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0x1e,
+        0x60, 0xc1, 0x8f, 0xc6, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x00, 0x01,
+        0xff, 0xe0, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x03,
+        0x03, 0x7e, 0x1f, 0xff, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x19, 0xff, 0x00, 0x66, 0xe6, 0x66,
+        0x66, 0x66, 0xf0, 0x19, 0xff, 0xe0, 0x0c, 0x31, 0xc3, 0x0c, 0x30, 0xc3,
+        0x0c, 0x30, 0xf3, 0xcd, 0xe0, 0x1f, 0xff, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+        0xc3, 0xc6, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0xc3, 0x1f, 0xff, 0x00,
+        0xe6, 0x66, 0x66, 0x66, 0x66, 0x66, 0xf0, 0x01, 0xff, 0x00, 0xfe, 0xdb,
+        0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x01, 0xff, 0x00, 0xfe, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x01, 0xff, 0x00, 0x7e, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x01, 0xff, 0xe0, 0xfe, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xc0, 0xc0, 0xc0, 0x01, 0xff,
+        0xe0, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x03, 0x03,
+        0x03, 0x01, 0xff, 0x00, 0xdf, 0xf0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+        0xc0, 0x01, 0xff, 0x00, 0x7e, 0xc3, 0xc0, 0xc0, 0x7e, 0x03, 0x03, 0xc3,
+        0x7e, 0x1f, 0xff, 0x00, 0x30, 0x60, 0xc1, 0x8f, 0xc6, 0x0c, 0x18, 0x30,
+        0x60, 0xc1, 0x81, 0xe0, 0x01, 0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0x7f, 0x01, 0xff, 0x00, 0xc3, 0xc3, 0xc3, 0x66, 0x66,
+        0x66, 0x3c, 0x18, 0x18, 0x01, 0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xdb, 0xdb,
+        0xdb, 0xdb, 0xdb, 0x7e, 0x01, 0xff, 0x00, 0xc3, 0xc3, 0x66, 0x3c, 0x18,
+        0x3c, 0x66, 0xc3, 0xc3, 0x01, 0xff, 0xe0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0x7f, 0x03, 0x03, 0x7e, 0x01, 0xff, 0x00, 0xff, 0x03,
+        0x06, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0xff, 0x1f, 0xff, 0x00, 0x1c, 0xc3,
+        0x0c, 0x30, 0xce, 0x0c, 0x30, 0xc3, 0x0c, 0x1c, 0x1f, 0xff, 0x00, 0xff,
+        0xff, 0xff, 0xc0, 0x1f, 0xff, 0x00, 0xe0, 0xc3, 0x0c, 0x30, 0xc1, 0xcc,
+        0x30, 0xc3, 0x0c, 0xe0, 0x78, 0x00, 0x00, 0x73, 0xdb, 0xdb, 0xce
       },
       (GFXglyph[]){
-        {     0,   7,  20,   7,    0,  -15 },   // 0x20 ' '
-        {    25,  10,  20,  10,    0,  -15 },   // 0x21 '!'
-        {    50,  10,  20,  10,    0,  -15 },   // 0x22 '"'
-        {    75,  10,  20,  10,    0,  -15 },   // 0x23 '#'
-        {   100,  10,  20,  10,    0,  -15 },   // 0x24 '$'
-        {   125,  10,  20,  10,    0,  -15 },   // 0x25 '%'
-        {   150,  10,  20,  10,    0,  -15 },   // 0x26 '&'
-        {   175,  10,  20,  10,    0,  -15 },   // 0x27 '''
-        {   200,  10,  20,  10,    0,  -15 },   // 0x28 '('
-        {   225,  10,  20,  10,    0,  -15 },   // 0x29 ')'
-        {   250,  10,  20,  10,    0,  -15 },   // 0x2A '*'
-        {   275,  10,  20,  10,    0,  -15 },   // 0x2B '+'
-        {   300,  10,  20,  10,    0,  -15 },   // 0x2C ','
-        {   325,  10,  20,  10,    0,  -15 },   // 0x2D '-'
-        {   350,  10,  20,  10,    0,  -15 },   // 0x2E '.'
-        {   375,  10,  20,  10,    0,  -15 },   // 0x2F '/'
-        {   400,  10,  20,  10,    0,  -15 },   // 0x30 '0'
-        {   425,  10,  20,  10,    0,  -15 },   // 0x31 '1'
-        {   450,  10,  20,  10,    0,  -15 },   // 0x32 '2'
-        {   475,  10,  20,  10,    0,  -15 },   // 0x33 '3'
-        {   500,  10,  20,  10,    0,  -15 },   // 0x34 '4'
-        {   525,  10,  20,  10,    0,  -15 },   // 0x35 '5'
-        {   550,  10,  20,  10,    0,  -15 },   // 0x36 '6'
-        {   575,  10,  20,  10,    0,  -15 },   // 0x37 '7'
-        {   600,  10,  20,  10,    0,  -15 },   // 0x38 '8'
-        {   625,  10,  20,  10,    0,  -15 },   // 0x39 '9'
-        {   650,  10,  20,  10,    0,  -15 },   // 0x3A ':'
-        {   675,  10,  20,  10,    0,  -15 },   // 0x3B ';'
-        {   700,  10,  20,  10,    0,  -15 },   // 0x3C '<'
-        {   725,  10,  20,  10,    0,  -15 },   // 0x3D '='
-        {   750,  10,  20,  10,    0,  -15 },   // 0x3E '>'
-        {   775,  10,  20,  10,    0,  -15 },   // 0x3F '?'
-        {   800,  10,  20,  10,    0,  -15 },   // 0x40 '@'
-        {   825,  10,  20,  10,    0,  -15 },   // 0x41 'A'
-        {   850,  10,  20,  10,    0,  -15 },   // 0x42 'B'
-        {   875,  10,  20,  10,    0,  -15 },   // 0x43 'C'
-        {   900,  10,  20,  10,    0,  -15 },   // 0x44 'D'
-        {   925,  10,  20,  10,    0,  -15 },   // 0x45 'E'
-        {   950,  10,  20,  10,    0,  -15 },   // 0x46 'F'
-        {   975,  10,  20,  10,    0,  -15 },   // 0x47 'G'
-        {  1000,  10,  20,  10,    0,  -15 },   // 0x48 'H'
-        {  1025,  10,  20,  10,    0,  -15 },   // 0x49 'I'
-        {  1050,  10,  20,  10,    0,  -15 },   // 0x4A 'J'
-        {  1075,  10,  20,  10,    0,  -15 },   // 0x4B 'K'
-        {  1100,  10,  20,  10,    0,  -15 },   // 0x4C 'L'
-        {  1125,  10,  20,  10,    0,  -15 },   // 0x4D 'M'
-        {  1150,  10,  20,  10,    0,  -15 },   // 0x4E 'N'
-        {  1175,  10,  20,  10,    0,  -15 },   // 0x4F 'O'
-        {  1200,  10,  20,  10,    0,  -15 },   // 0x50 'P'
-        {  1225,  10,  20,  10,    0,  -15 },   // 0x51 'Q'
-        {  1250,  10,  20,  10,    0,  -15 },   // 0x52 'R'
-        {  1275,  10,  20,  10,    0,  -15 },   // 0x53 'S'
-        {  1300,  10,  20,  10,    0,  -15 },   // 0x54 'T'
-        {  1325,  10,  20,  10,    0,  -15 },   // 0x55 'U'
-        {  1350,  10,  20,  10,    0,  -15 },   // 0x56 'V'
-        {  1375,  10,  20,  10,    0,  -15 },   // 0x57 'W'
-        {  1400,  10,  20,  10,    0,  -15 },   // 0x58 'X'
-        {  1425,  10,  20,  10,    0,  -15 },   // 0x59 'Y'
-        {  1450,  10,  20,  10,    0,  -15 },   // 0x5A 'Z'
-        {  1475,  10,  20,  10,    0,  -15 },   // 0x5B '['
-        {  1500,  10,  20,  10,    0,  -15 },   // 0x5C '\'
-        {  1525,  10,  20,  10,    0,  -15 },   // 0x5D ']'
-        {  1550,  10,  20,  10,    0,  -15 },   // 0x5E '^'
-        {  1575,  10,  20,  10,    0,  -15 },   // 0x5F '_'
-        {  1600,  10,  20,  10,    0,  -15 },   // 0x60 '`'
-        {  1625,  10,  20,  10,    0,  -15 },   // 0x61 'a'
-        {  1650,  10,  20,  10,    0,  -15 },   // 0x62 'b'
-        {  1675,  10,  20,  10,    0,  -15 },   // 0x63 'c'
-        {  1700,  10,  20,  10,    0,  -15 },   // 0x64 'd'
-        {  1725,  10,  20,  10,    0,  -15 },   // 0x65 'e'
-        {  1750,  10,  20,  10,    0,  -15 },   // 0x66 'f'
-        {  1775,  10,  20,  10,    0,  -15 },   // 0x67 'g'
-        {  1800,  10,  20,  10,    0,  -15 },   // 0x68 'h'
-        {  1825,  10,  20,  10,    0,  -15 },   // 0x69 'i'
-        {  1850,  10,  20,  10,    0,  -15 },   // 0x6A 'j'
-        {  1875,  10,  20,  10,    0,  -15 },   // 0x6B 'k'
-        {  1900,  10,  20,  10,    0,  -15 },   // 0x6C 'l'
-        {  1925,  10,  20,  10,    0,  -15 },   // 0x6D 'm'
-        {  1950,  10,  20,  10,    0,  -15 },   // 0x6E 'n'
-        {  1975,  10,  20,  10,    0,  -15 },   // 0x6F 'o'
-        {  2000,  10,  20,  10,    0,  -15 },   // 0x70 'p'
-        {  2025,  10,  20,  10,    0,  -15 },   // 0x71 'q'
-        {  2050,  10,  20,  10,    0,  -15 },   // 0x72 'r'
-        {  2075,  10,  20,  10,    0,  -15 },   // 0x73 's'
-        {  2100,  10,  20,  10,    0,  -15 },   // 0x74 't'
-        {  2125,  10,  20,  10,    0,  -15 },   // 0x75 'u'
-        {  2150,  10,  20,  10,    0,  -15 },   // 0x76 'v'
-        {  2175,  10,  20,  10,    0,  -15 },   // 0x77 'w'
-        {  2200,  10,  20,  10,    0,  -15 },   // 0x78 'x'
-        {  2225,  10,  20,  10,    0,  -15 },   // 0x79 'y'
-        {  2250,  10,  20,  10,    0,  -15 },   // 0x7A 'z'
-        {  2275,  10,  20,  10,    0,  -15 },   // 0x7B '{'
-        {  2300,  10,  20,  10,    0,  -15 },   // 0x7C '|'
-        {  2325,  10,  20,  10,    0,  -15 },   // 0x7D '}'
-        {  2350,  10,  20,  10,    0,  -15 },   // 0x7E '~'
+        {     0,   0,  20,   7,    0,  -15 },   // 0x20 ' '
+        {     0,   2,  20,  10,    4,  -15 },   // 0x21 '!'
+        {     6,   6,  20,  10,    2,  -15 },   // 0x22 '"'
+        {    12,   8,  20,  10,    1,  -15 },   // 0x23 '#'
+        {    28,   8,  20,  10,    1,  -15 },   // 0x24 '$'
+        {    46,   7,  20,  10,    1,  -15 },   // 0x25 '%'
+        {    60,   9,  20,  10,    0,  -15 },   // 0x26 '&'
+        {    78,   2,  20,  10,    4,  -15 },   // 0x27 '''
+        {    82,   4,  20,  10,    3,  -15 },   // 0x28 '('
+        {    92,   4,  20,  10,    3,  -15 },   // 0x29 ')'
+        {   102,   9,  20,  10,    0,  -15 },   // 0x2A '*'
+        {   113,   8,  20,  10,    1,  -15 },   // 0x2B '+'
+        {   123,   3,  20,  10,    3,  -15 },   // 0x2C ','
+        {   128,   8,  20,  10,    1,  -15 },   // 0x2D '-'
+        {   132,   2,  20,  10,    4,  -15 },   // 0x2E '.'
+        {   136,   7,  20,  10,    1,  -15 },   // 0x2F '/'
+        {   150,   8,  20,  10,    1,  -15 },   // 0x30 '0'
+        {   166,   6,  20,  10,    2,  -15 },   // 0x31 '1'
+        {   179,   8,  20,  10,    1,  -15 },   // 0x32 '2'
+        {   195,   8,  20,  10,    1,  -15 },   // 0x33 '3'
+        {   211,   8,  20,  10,    1,  -15 },   // 0x34 '4'
+        {   227,   8,  20,  10,    1,  -15 },   // 0x35 '5'
+        {   243,   8,  20,  10,    1,  -15 },   // 0x36 '6'
+        {   259,   8,  20,  10,    1,  -15 },   // 0x37 '7'
+        {   275,   8,  20,  10,    1,  -15 },   // 0x38 '8'
+        {   291,   8,  20,  10,    1,  -15 },   // 0x39 '9'
+        {   307,   2,  20,  10,    4,  -15 },   // 0x3A ':'
+        {   311,   3,  20,  10,    3,  -15 },   // 0x3B ';'
+        {   317,   8,  20,  10,    1,  -15 },   // 0x3C '<'
+        {   333,   8,  20,  10,    1,  -15 },   // 0x3D '='
+        {   338,   8,  20,  10,    1,  -15 },   // 0x3E '>'
+        {   354,   8,  20,  10,    1,  -15 },   // 0x3F '?'
+        {   368,   9,  20,  10,    0,  -15 },   // 0x40 '@'
+        {   386,   8,  20,  10,    1,  -15 },   // 0x41 'A'
+        {   402,   8,  20,  10,    1,  -15 },   // 0x42 'B'
+        {   418,   8,  20,  10,    1,  -15 },   // 0x43 'C'
+        {   434,   8,  20,  10,    1,  -15 },   // 0x44 'D'
+        {   450,   8,  20,  10,    1,  -15 },   // 0x45 'E'
+        {   466,   8,  20,  10,    1,  -15 },   // 0x46 'F'
+        {   482,   8,  20,  10,    1,  -15 },   // 0x47 'G'
+        {   498,   8,  20,  10,    1,  -15 },   // 0x48 'H'
+        {   514,   4,  20,  10,    3,  -15 },   // 0x49 'I'
+        {   524,   8,  20,  10,    1,  -15 },   // 0x4A 'J'
+        {   540,   8,  20,  10,    1,  -15 },   // 0x4B 'K'
+        {   556,   8,  20,  10,    1,  -15 },   // 0x4C 'L'
+        {   572,   9,  20,  10,    0,  -15 },   // 0x4D 'M'
+        {   590,   8,  20,  10,    1,  -15 },   // 0x4E 'N'
+        {   606,   8,  20,  10,    1,  -15 },   // 0x4F 'O'
+        {   622,   8,  20,  10,    1,  -15 },   // 0x50 'P'
+        {   638,   8,  20,  10,    1,  -15 },   // 0x51 'Q'
+        {   656,   8,  20,  10,    1,  -15 },   // 0x52 'R'
+        {   672,   8,  20,  10,    1,  -15 },   // 0x53 'S'
+        {   688,   8,  20,  10,    1,  -15 },   // 0x54 'T'
+        {   704,   8,  20,  10,    1,  -15 },   // 0x55 'U'
+        {   720,   8,  20,  10,    1,  -15 },   // 0x56 'V'
+        {   736,   9,  20,  10,    0,  -15 },   // 0x57 'W'
+        {   754,   8,  20,  10,    1,  -15 },   // 0x58 'X'
+        {   770,   8,  20,  10,    1,  -15 },   // 0x59 'Y'
+        {   786,   8,  20,  10,    1,  -15 },   // 0x5A 'Z'
+        {   802,   4,  20,  10,    3,  -15 },   // 0x5B '['
+        {   812,   7,  20,  10,    1,  -15 },   // 0x5C '\'
+        {   826,   4,  20,  10,    3,  -15 },   // 0x5D ']'
+        {   836,   8,  20,  10,    1,  -15 },   // 0x5E '^'
+        {   843,   8,  20,  10,    1,  -15 },   // 0x5F '_'
+        {   847,   4,  20,  10,    2,  -15 },   // 0x60 '`'
+        {   852,   8,  20,  10,    1,  -15 },   // 0x61 'a'
+        {   864,   8,  20,  10,    1,  -15 },   // 0x62 'b'
+        {   880,   8,  20,  10,    1,  -15 },   // 0x63 'c'
+        {   892,   8,  20,  10,    1,  -15 },   // 0x64 'd'
+        {   908,   8,  20,  10,    1,  -15 },   // 0x65 'e'
+        {   920,   7,  20,  10,    2,  -15 },   // 0x66 'f'
+        {   935,   8,  20,  10,    1,  -15 },   // 0x67 'g'
+        {   950,   8,  20,  10,    1,  -15 },   // 0x68 'h'
+        {   966,   4,  20,  10,    3,  -15 },   // 0x69 'i'
+        {   975,   6,  20,  10,    2,  -15 },   // 0x6A 'j'
+        {   989,   8,  20,  10,    1,  -15 },   // 0x6B 'k'
+        {  1005,   4,  20,  10,    3,  -15 },   // 0x6C 'l'
+        {  1015,   8,  20,  10,    1,  -15 },   // 0x6D 'm'
+        {  1027,   8,  20,  10,    1,  -15 },   // 0x6E 'n'
+        {  1039,   8,  20,  10,    1,  -15 },   // 0x6F 'o'
+        {  1051,   8,  20,  10,    1,  -15 },   // 0x70 'p'
+        {  1066,   8,  20,  10,    1,  -15 },   // 0x71 'q'
+        {  1081,   8,  20,  10,    1,  -15 },   // 0x72 'r'
+        {  1093,   8,  20,  10,    1,  -15 },   // 0x73 's'
+        {  1105,   7,  20,  10,    1,  -15 },   // 0x74 't'
+        {  1120,   8,  20,  10,    1,  -15 },   // 0x75 'u'
+        {  1132,   8,  20,  10,    1,  -15 },   // 0x76 'v'
+        {  1144,   8,  20,  10,    1,  -15 },   // 0x77 'w'
+        {  1156,   8,  20,  10,    1,  -15 },   // 0x78 'x'
+        {  1168,   8,  20,  10,    1,  -15 },   // 0x79 'y'
+        {  1183,   8,  20,  10,    1,  -15 },   // 0x7A 'z'
+        {  1195,   6,  20,  10,    2,  -15 },   // 0x7B '{'
+        {  1208,   2,  20,  10,    4,  -15 },   // 0x7C '|'
+        {  1215,   6,  20,  10,    2,  -15 },   // 0x7D '}'
+        {  1228,   8,  20,  10,    1,  -15 },   // 0x7E '~'
       },  0x20, 0x7e, 0
 
-    }, 0x0, 0x20, 0x7e
+    }, 0x0, 0x20, 0x7e, true
   },
-  // Approx. 3047 bytes
+  // Approx. 1907 bytes
 
   {
     {
       (uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x30, 0x0c,
-        0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0xfc,
-        0x6d, 0x9b, 0x06, 0xc1, 0xb0, 0x6c, 0x1b, 0x06, 0xd8, 0xfc, 0x0c, 0x03,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x33, 0x0c, 0x03, 0x00,
-        0xc0, 0x30, 0x1f, 0x83, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x19, 0xfe, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x66,
-        0x30, 0xf8, 0x63, 0x18, 0xc6, 0x31, 0x8c, 0x3e, 0x18, 0xcc, 0x18, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x8c,
-        0xc3, 0x30, 0xcc, 0x1e, 0x07, 0x80, 0xc0, 0xfc, 0x0c, 0x0f, 0xc0, 0xc0,
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c,
-        0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00,
-        0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0xcc,
-        0x30, 0x0c, 0x01, 0xc0, 0xd8, 0x33, 0x0c, 0xc3, 0x30, 0x6c, 0x0e, 0x00,
-        0xc0, 0x30, 0xcc, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x0f, 0xc4, 0x0a, 0x79, 0xb3, 0x6c, 0x1b, 0x06, 0xcd,
-        0x9e, 0x50, 0x23, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
-        0x80, 0x30, 0xfc, 0x63, 0x18, 0xc6, 0x30, 0xfc, 0x00, 0x1f, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x19, 0x8c, 0xc6,
-        0x63, 0x30, 0x66, 0x0c, 0xc1, 0x98, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x01, 0x80,
-        0x60, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc4, 0x0a, 0xf9,
-        0xb3, 0x6c, 0xdb, 0xe6, 0xd9, 0xb3, 0x50, 0x23, 0xf0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0x30, 0xcc, 0x33, 0x07, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xc0, 0x30, 0x0c, 0x1f, 0xe0, 0xc0, 0x30, 0x0c, 0x00, 0x00, 0x01,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0x30, 0xcc, 0x06,
-        0x03, 0x01, 0x80, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0x30, 0x0c,
-        0x0e, 0x00, 0xc3, 0x30, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x39, 0xf6, 0x60, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xfe, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x6d, 0x8f, 0x60, 0xd8,
-        0x36, 0x0d, 0x83, 0x60, 0xd8, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
-        0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x01, 0x80,
-        0x00, 0x00, 0x03, 0x01, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x78, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x0f, 0x86, 0x31, 0x8c, 0x63, 0x18, 0xc6, 0x30, 0xf8,
-        0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-        0x30, 0x66, 0x0c, 0xc1, 0x98, 0x33, 0x19, 0x8c, 0xc6, 0x63, 0x30, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0xc0, 0x30, 0x0c, 0x23,
-        0x18, 0xcc, 0x06, 0x03, 0x01, 0x98, 0xce, 0x67, 0xb3, 0x68, 0xf8, 0x06,
-        0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x01, 0xc0, 0x30, 0x0c,
-        0x23, 0x18, 0xcc, 0x06, 0x03, 0x01, 0x80, 0xdc, 0x6d, 0xb0, 0x68, 0x30,
-        0x18, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x60, 0x70,
-        0x06, 0x21, 0x9b, 0xcc, 0x06, 0x03, 0x01, 0x98, 0xce, 0x67, 0xb3, 0x68,
-        0xf8, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-        0x0c, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x06, 0x03, 0x01, 0x80, 0x61, 0x98,
-        0x63, 0x30, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
-        0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f, 0xe6, 0x19, 0x86, 0x61,
-        0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00,
-        0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f, 0xe6, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c,
-        0xc0, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f, 0xe6, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b,
-        0x9b, 0x80, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f, 0xe6,
-        0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x33, 0x0c, 0xc0, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f,
-        0xe6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1e, 0x0c, 0xc1, 0xe0, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
-        0x9f, 0xe6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc6, 0x31, 0x8c, 0x63, 0x18,
-        0xc6, 0x3f, 0xfc, 0x63, 0x18, 0xc6, 0x31, 0x8c, 0x63, 0x1f, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x01,
-        0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x66, 0x18, 0xfc, 0x0c,
-        0x03, 0x01, 0x80, 0x00, 0x18, 0x03, 0x00, 0x01, 0xfe, 0x60, 0x18, 0x06,
-        0x01, 0x80, 0x60, 0x1f, 0x86, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x01, 0xfe, 0x60, 0x18,
-        0x06, 0x01, 0x80, 0x60, 0x1f, 0x86, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0xc0, 0x01, 0xfe, 0x60,
-        0x18, 0x06, 0x01, 0x80, 0x60, 0x1f, 0x86, 0x01, 0x80, 0x60, 0x18, 0x06,
-        0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc0, 0x01, 0xfe,
-        0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x1f, 0x86, 0x01, 0x80, 0x60, 0x18,
-        0x06, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00,
-        0x78, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
-        0x03, 0x00, 0xc0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00,
-        0x00, 0x78, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30,
-        0x0c, 0x03, 0x00, 0xc0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c,
-        0xc0, 0x00, 0x78, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0,
-        0x30, 0x0c, 0x03, 0x00, 0xc0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
-        0x0c, 0xc0, 0x00, 0x78, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00,
-        0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0xf8, 0x63, 0x18, 0x66, 0x19, 0x86, 0x61, 0xbf,
-        0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x31, 0xf8, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x3b, 0x9b, 0x80, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0xc6, 0x79,
-        0x9b, 0x66, 0x79, 0x8e, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0xc0, 0x00, 0xfc, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x9b, 0x80, 0x00, 0xfc, 0x61, 0x98,
-        0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc0, 0x00, 0xfc, 0x61,
-        0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66,
-        0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x06, 0x18, 0xcc, 0x1e, 0x03, 0x01, 0xe0, 0xcc, 0x61, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xfc, 0x61, 0x98, 0x76, 0x19, 0x8e, 0x67, 0x9b, 0x67, 0x99, 0xc6, 0x61,
-        0xb8, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00,
-        0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03,
-        0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
-        0x0c, 0xc0, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x33, 0x0c, 0xc0, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98,
-        0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x06, 0x03, 0x00, 0x01, 0x86, 0x61, 0x98, 0x63, 0x30, 0xcc, 0x33,
-        0x07, 0x80, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x18, 0x07, 0xf1, 0x86,
-        0x61, 0x98, 0x66, 0x19, 0x86, 0x7f, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x63, 0x18, 0xc6, 0x31,
-        0x88, 0x7f, 0x18, 0x66, 0x19, 0x86, 0x61, 0x98, 0x67, 0x19, 0xbc, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00,
-        0x00, 0xfc, 0x01, 0x80, 0x63, 0xf9, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03,
-        0x00, 0x00, 0xfc, 0x01, 0x80, 0x63, 0xf9, 0x86, 0x61, 0x98, 0x66, 0x18,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
-        0x0c, 0xc0, 0x00, 0xfc, 0x01, 0x80, 0x63, 0xf9, 0x86, 0x61, 0x98, 0x66,
-        0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3b, 0x9b, 0x80, 0x00, 0xfc, 0x01, 0x80, 0x63, 0xf9, 0x86, 0x61, 0x98,
-        0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x33, 0x0c, 0xc0, 0x00, 0xfc, 0x01, 0x80, 0x63, 0xf9, 0x86, 0x61,
-        0x98, 0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1e, 0x0c, 0xc1, 0xe0, 0xfc, 0x01, 0x80, 0x63, 0xf9, 0x86,
-        0x61, 0x98, 0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xee, 0x0c, 0xc3, 0x37, 0xcf,
-        0x3f, 0xcc, 0x33, 0x0c, 0xcd, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x06,
-        0x01, 0x80, 0x60, 0x18, 0x06, 0x18, 0xfc, 0x0c, 0x03, 0x01, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xfc, 0x61, 0x98,
-        0x66, 0x19, 0xfe, 0x60, 0x18, 0x06, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0xfc, 0x61,
-        0x98, 0x66, 0x19, 0xfe, 0x60, 0x18, 0x06, 0x18, 0xfc, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0xc0, 0x00, 0xfc,
-        0x61, 0x98, 0x66, 0x19, 0xfe, 0x60, 0x18, 0x06, 0x18, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc0, 0x00,
-        0xfc, 0x61, 0x98, 0x66, 0x19, 0xfe, 0x60, 0x18, 0x06, 0x18, 0xfc, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00,
-        0x00, 0x70, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x78,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03,
-        0x00, 0x00, 0x70, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0,
-        0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
-        0x0c, 0xc0, 0x00, 0x70, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00,
-        0xc0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x33, 0x0c, 0xc0, 0x00, 0x70, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03,
-        0x00, 0xc0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xd8, 0x3c, 0x1b, 0x00, 0x60, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
-        0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x3b, 0x9b, 0x80, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0xc0, 0x00, 0xfc, 0x61, 0x98,
-        0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x9b, 0x80, 0x00, 0xfc, 0x61,
-        0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc0, 0x00, 0xfc,
-        0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0,
-        0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xfd, 0x61, 0x98, 0xe6, 0x79, 0xb6, 0x79, 0x9c, 0x66, 0x1a, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03,
-        0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18,
-        0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
-        0x03, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66,
-        0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1e, 0x0c, 0xc0, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98,
-        0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x33, 0x0c, 0xc0, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
-        0x98, 0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x06, 0x03, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x18, 0xfe, 0x01, 0x80, 0x63, 0xf0, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x19, 0xfc, 0x60, 0x18, 0x06, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc0, 0x01, 0x86, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfe, 0x01, 0x80, 0x63, 0xf0, 0x00
+        0x19, 0xff, 0x00, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xc0, 0x18, 0x18, 0x7e,
+        0xdb, 0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0xdb, 0x7e, 0x18, 0x18, 0x1f, 0xff,
+        0x00, 0x3c, 0x66, 0x60, 0x60, 0x60, 0x60, 0xfc, 0x60, 0x60, 0x60, 0x60,
+        0x63, 0xff, 0x07, 0xfe, 0x00, 0xc1, 0xb1, 0x8f, 0x8c, 0x66, 0x33, 0x19,
+        0x8c, 0x7c, 0x63, 0x60, 0xc0, 0x1f, 0xff, 0x00, 0xc3, 0xc3, 0x66, 0x66,
+        0x66, 0x3c, 0x3c, 0x18, 0x7e, 0x18, 0x7e, 0x18, 0x18, 0x1f, 0x3f, 0x00,
+        0xff, 0xff, 0xfc, 0x3f, 0xff, 0x80, 0x7b, 0x3c, 0x30, 0x73, 0x6c, 0xf3,
+        0xcd, 0xb3, 0x83, 0x0f, 0x37, 0x80, 0xc0, 0x00, 0x00, 0xcf, 0x30, 0x07,
+        0xfe, 0x00, 0x3f, 0x10, 0x29, 0xe6, 0xcd, 0xb0, 0x6c, 0x1b, 0x36, 0x79,
+        0x40, 0x8f, 0xc0, 0x7f, 0x40, 0x00, 0x7c, 0x0d, 0xfe, 0x3c, 0x78, 0xdf,
+        0xff, 0x01, 0xff, 0x00, 0x0c, 0xc6, 0x63, 0x31, 0x98, 0xcc, 0x19, 0x83,
+        0x30, 0x66, 0x0c, 0xc0, 0x01, 0xf0, 0x00, 0xff, 0x03, 0x03, 0x03, 0x03,
+        0x00, 0x40, 0x00, 0xfc, 0x07, 0xfe, 0x00, 0x3f, 0x10, 0x2b, 0xe6, 0xcd,
+        0xb3, 0x6f, 0x9b, 0x66, 0xcd, 0x40, 0x8f, 0xc0, 0x40, 0x00, 0x00, 0xfc,
+        0x7c, 0x00, 0x00, 0x7b, 0x3c, 0xf3, 0x78, 0x03, 0xf9, 0x00, 0x18, 0x18,
+        0x18, 0xff, 0x18, 0x18, 0x18, 0xff, 0x7f, 0x00, 0x00, 0x7b, 0x3c, 0xc6,
+        0x31, 0x8f, 0xc0, 0x7f, 0x00, 0x00, 0x7b, 0x30, 0xce, 0x0f, 0x37, 0x80,
+        0xc0, 0x00, 0x00, 0x78, 0x01, 0xff, 0xe0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc7, 0xfb, 0xc0, 0xc0, 0xc0, 0x1f, 0xff, 0x00, 0x7f, 0xdb,
+        0xdb, 0xdb, 0xdb, 0xdb, 0x7b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x1b, 0x00,
+        0x60, 0x00, 0xf0, 0x00, 0x00, 0xe0, 0x6f, 0x00, 0x7f, 0x00, 0x00, 0x6e,
+        0x66, 0x66, 0xf0, 0x7f, 0x40, 0x00, 0x7d, 0x8f, 0x1e, 0x3c, 0x78, 0xdf,
+        0x7f, 0x01, 0xff, 0x00, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc6, 0x63,
+        0x31, 0x98, 0xcc, 0x00, 0x3f, 0xff, 0x80, 0x30, 0x38, 0x0c, 0x06, 0x13,
+        0x19, 0x98, 0x18, 0x18, 0x19, 0x99, 0xd9, 0xf9, 0xb8, 0xf8, 0x0c, 0x06,
+        0x3f, 0xff, 0x80, 0x30, 0x38, 0x0c, 0x06, 0x13, 0x19, 0x98, 0x18, 0x18,
+        0x18, 0x1b, 0x9b, 0x78, 0x38, 0x30, 0x30, 0x3e, 0x3f, 0xff, 0x80, 0xf0,
+        0x0c, 0x1c, 0x03, 0x11, 0x9f, 0x98, 0x18, 0x18, 0x19, 0x99, 0xd9, 0xf9,
+        0xb8, 0xf8, 0x0c, 0x06, 0x19, 0xff, 0x00, 0x18, 0x18, 0x18, 0x18, 0x30,
+        0x60, 0xc0, 0xc3, 0xc3, 0x66, 0x3c, 0xdf, 0xff, 0x00, 0x30, 0x18, 0x7e,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xdf, 0xff, 0x00, 0x0c, 0x18, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xdf, 0xff, 0x00, 0x3c, 0x66, 0x7e,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xdf, 0xff, 0x00, 0x77, 0xdc, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xdf, 0xff, 0x00, 0x66, 0x66, 0x7e,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xff, 0xff, 0x00, 0x3c, 0x66, 0x3c, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x1f, 0xff, 0x00, 0x7f, 0xf1,
+        0x8c, 0x63, 0x18, 0xc6, 0x31, 0x8f, 0xff, 0x18, 0xc6, 0x31, 0x8c, 0x63,
+        0x18, 0xc7, 0xc0, 0x1f, 0xff, 0xe0, 0x7e, 0xc3, 0xc3, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0x7e, 0x18, 0x18, 0x30, 0xdf, 0xff,
+        0x00, 0x30, 0x18, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0xff, 0xdf, 0xff, 0x00, 0x0c, 0x18, 0xff, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xdf, 0xff,
+        0x00, 0x3c, 0x66, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0xff, 0xdf, 0xff, 0x00, 0x66, 0x66, 0xff, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xdf, 0xff,
+        0x00, 0xc6, 0xf6, 0x66, 0x66, 0x66, 0x66, 0x66, 0xf0, 0xdf, 0xff, 0x00,
+        0x36, 0xf6, 0x66, 0x66, 0x66, 0x66, 0x66, 0xf0, 0xdf, 0xff, 0x00, 0x7b,
+        0x37, 0x8c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc7, 0x80, 0xdf,
+        0xff, 0x00, 0xcf, 0x37, 0x8c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30,
+        0xc7, 0x80, 0x1f, 0xff, 0x00, 0x7e, 0x31, 0x98, 0x6c, 0x36, 0x1b, 0x0f,
+        0xf6, 0xc3, 0x61, 0xb0, 0xd8, 0x6c, 0x67, 0xe0, 0xdf, 0xff, 0x00, 0x77,
+        0xdc, 0xc3, 0xc3, 0xc3, 0xc3, 0xe3, 0xf3, 0xdb, 0xcf, 0xc7, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xdf, 0xff, 0x00, 0x30, 0x18, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0xdf, 0xff, 0x00, 0x0c,
+        0x18, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0x7e, 0xdf, 0xff, 0x00, 0x3c, 0x66, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0xdf, 0xff, 0x00, 0x77,
+        0xdc, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0x7e, 0xdf, 0xff, 0x00, 0x66, 0x66, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x03, 0xf8, 0x00, 0xc3,
+        0x66, 0x3c, 0x18, 0x3c, 0x66, 0xc3, 0x1f, 0xff, 0x00, 0x3f, 0x18, 0x66,
+        0x1d, 0x86, 0x63, 0x99, 0xe6, 0xd9, 0xe6, 0x71, 0x98, 0x6e, 0x19, 0x86,
+        0x3f, 0x00, 0xdf, 0xff, 0x00, 0x30, 0x18, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0xdf, 0xff, 0x00, 0x0c,
+        0x18, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0x7e, 0xdf, 0xff, 0x00, 0x3c, 0x66, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0xdf, 0xff, 0x00, 0x66,
+        0x66, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0x7e, 0xdf, 0xff, 0x00, 0x0c, 0x18, 0xc3, 0xc3, 0xc3, 0x66, 0x66,
+        0x66, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f, 0xff, 0x00, 0xc0,
+        0xc0, 0xc0, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xc0, 0xc0, 0xc0,
+        0x1f, 0xff, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc4, 0xfe, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xe3, 0xde, 0x0d, 0xff, 0x00, 0x30, 0x18, 0x7e, 0x03, 0x03,
+        0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x0d, 0xff, 0x00, 0x0c, 0x18, 0x7e,
+        0x03, 0x03, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x0d, 0xff, 0x00, 0x3c,
+        0x66, 0x7e, 0x03, 0x03, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x0d, 0xff,
+        0x00, 0x77, 0xdc, 0x7e, 0x03, 0x03, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f,
+        0x0d, 0xff, 0x00, 0x66, 0x66, 0x7e, 0x03, 0x03, 0x7f, 0xc3, 0xc3, 0xc3,
+        0xc3, 0x7f, 0x0f, 0xff, 0x00, 0x3c, 0x66, 0x3c, 0x7e, 0x03, 0x03, 0x7f,
+        0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x01, 0xff, 0x00, 0x7b, 0x83, 0x30, 0xcd,
+        0xf3, 0xcf, 0xf3, 0x0c, 0xc3, 0x33, 0x77, 0x80, 0x01, 0xff, 0xe0, 0x7e,
+        0xc3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0x7e, 0x18, 0x18, 0x30, 0x0d,
+        0xff, 0x00, 0x30, 0x18, 0x7e, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc3,
+        0x7e, 0x0d, 0xff, 0x00, 0x0c, 0x18, 0x7e, 0xc3, 0xc3, 0xc3, 0xff, 0xc0,
+        0xc0, 0xc3, 0x7e, 0x0d, 0xff, 0x00, 0x3c, 0x66, 0x7e, 0xc3, 0xc3, 0xc3,
+        0xff, 0xc0, 0xc0, 0xc3, 0x7e, 0x0d, 0xff, 0x00, 0x66, 0x66, 0x7e, 0xc3,
+        0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc3, 0x7e, 0x0d, 0xff, 0x00, 0xc6, 0xe6,
+        0x66, 0x66, 0x66, 0xf0, 0x0d, 0xff, 0x00, 0x36, 0xe6, 0x66, 0x66, 0x66,
+        0xf0, 0x0d, 0xff, 0x00, 0x7b, 0x37, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc7,
+        0x80, 0x0d, 0xff, 0x00, 0xcf, 0x37, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc7,
+        0x80, 0x1f, 0xff, 0x00, 0x6c, 0x78, 0xd8, 0x0c, 0x7e, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x0d, 0xff, 0x00, 0x77, 0xdc, 0xfe, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x0d, 0xff, 0x00, 0x30, 0x18,
+        0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x0d, 0xff, 0x00,
+        0x0c, 0x18, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x0d,
+        0xff, 0x00, 0x3c, 0x66, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0x7e, 0x0d, 0xff, 0x00, 0x77, 0xdc, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0x7e, 0x0d, 0xff, 0x00, 0x66, 0x66, 0x7e, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x06, 0x4c, 0x00, 0x18, 0x18, 0xff, 0x18,
+        0x18, 0x01, 0xff, 0x00, 0x3f, 0x58, 0x66, 0x39, 0x9e, 0x6d, 0x9e, 0x67,
+        0x19, 0x86, 0xbf, 0x00, 0x0d, 0xff, 0x00, 0x30, 0x18, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x0d, 0xff, 0x00, 0x0c, 0x18, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x0d, 0xff, 0x00, 0x3c,
+        0x66, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x0d, 0xff,
+        0x00, 0x66, 0x66, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f,
+        0x0d, 0xff, 0xe0, 0x0c, 0x18, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0x7f, 0x03, 0x03, 0x7e, 0x1f, 0xff, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0,
+        0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xc0, 0xc0, 0xc0,
+        0x0d, 0xff, 0xe0, 0x66, 0x66, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0x7f, 0x03, 0x03, 0x7e
       },
       (GFXglyph[]){
-        {     0,  10,  20,  10,    0,  -15 },   // 0xA0
-        {    25,  10,  20,  10,    0,  -15 },   // 0xA1
-        {    50,  10,  20,  10,    0,  -15 },   // 0xA2
-        {    75,  10,  20,  10,    0,  -15 },   // 0xA3
-        {   100,  10,  20,  10,    0,  -15 },   // 0xA4
-        {   125,  10,  20,  10,    0,  -15 },   // 0xA5
-        {   150,  10,  20,  10,    0,  -15 },   // 0xA6
-        {   175,  10,  20,  10,    0,  -15 },   // 0xA7
-        {   200,  10,  20,  10,    0,  -15 },   // 0xA8
-        {   225,  10,  20,  10,    0,  -15 },   // 0xA9
-        {   250,  10,  20,  10,    0,  -15 },   // 0xAA
-        {   275,  10,  20,  10,    0,  -15 },   // 0xAB
-        {   300,  10,  20,  10,    0,  -15 },   // 0xAC
-        {   325,  10,  20,  10,    0,  -15 },   // 0xAD
-        {   350,  10,  20,  10,    0,  -15 },   // 0xAE
-        {   375,  10,  20,  10,    0,  -15 },   // 0xAF
-        {   400,  10,  20,  10,    0,  -15 },   // 0xB0
-        {   425,  10,  20,  10,    0,  -15 },   // 0xB1
-        {   450,  10,  20,  10,    0,  -15 },   // 0xB2
-        {   475,  10,  20,  10,    0,  -15 },   // 0xB3
-        {   500,  10,  20,  10,    0,  -15 },   // 0xB4
-        {   525,  10,  20,  10,    0,  -15 },   // 0xB5
-        {   550,  10,  20,  10,    0,  -15 },   // 0xB6
-        {   575,  10,  20,  10,    0,  -15 },   // 0xB7
-        {   600,  10,  20,  10,    0,  -15 },   // 0xB8
-        {   625,  10,  20,  10,    0,  -15 },   // 0xB9
-        {   650,  10,  20,  10,    0,  -15 },   // 0xBA
-        {   675,  10,  20,  10,    0,  -15 },   // 0xBB
-        {   700,  10,  20,  10,    0,  -15 },   // 0xBC
-        {   725,  10,  20,  10,    0,  -15 },   // 0xBD
-        {   750,  10,  20,  10,    0,  -15 },   // 0xBE
-        {   775,  10,  20,  10,    0,  -15 },   // 0xBF
-        {   800,  10,  20,  10,    0,  -15 },   // 0xC0
-        {   825,  10,  20,  10,    0,  -15 },   // 0xC1
-        {   850,  10,  20,  10,    0,  -15 },   // 0xC2
-        {   875,  10,  20,  10,    0,  -15 },   // 0xC3
-        {   900,  10,  20,  10,    0,  -15 },   // 0xC4
-        {   925,  10,  20,  10,    0,  -15 },   // 0xC5
-        {   950,  10,  20,  10,    0,  -15 },   // 0xC6
-        {   975,  10,  20,  10,    0,  -15 },   // 0xC7
-        {  1000,  10,  20,  10,    0,  -15 },   // 0xC8
-        {  1025,  10,  20,  10,    0,  -15 },   // 0xC9
-        {  1050,  10,  20,  10,    0,  -15 },   // 0xCA
-        {  1075,  10,  20,  10,    0,  -15 },   // 0xCB
-        {  1100,  10,  20,  10,    0,  -15 },   // 0xCC
-        {  1125,  10,  20,  10,    0,  -15 },   // 0xCD
-        {  1150,  10,  20,  10,    0,  -15 },   // 0xCE
-        {  1175,  10,  20,  10,    0,  -15 },   // 0xCF
-        {  1200,  10,  20,  10,    0,  -15 },   // 0xD0
-        {  1225,  10,  20,  10,    0,  -15 },   // 0xD1
-        {  1250,  10,  20,  10,    0,  -15 },   // 0xD2
-        {  1275,  10,  20,  10,    0,  -15 },   // 0xD3
-        {  1300,  10,  20,  10,    0,  -15 },   // 0xD4
-        {  1325,  10,  20,  10,    0,  -15 },   // 0xD5
-        {  1350,  10,  20,  10,    0,  -15 },   // 0xD6
-        {  1375,  10,  20,  10,    0,  -15 },   // 0xD7
-        {  1400,  10,  20,  10,    0,  -15 },   // 0xD8
-        {  1425,  10,  20,  10,    0,  -15 },   // 0xD9
-        {  1450,  10,  20,  10,    0,  -15 },   // 0xDA
-        {  1475,  10,  20,  10,    0,  -15 },   // 0xDB
-        {  1500,  10,  20,  10,    0,  -15 },   // 0xDC
-        {  1525,  10,  20,  10,    0,  -15 },   // 0xDD
-        {  1550,  10,  20,  10,    0,  -15 },   // 0xDE
-        {  1575,  10,  20,  10,    0,  -15 },   // 0xDF
-        {  1600,  10,  20,  10,    0,  -15 },   // 0xE0
-        {  1625,  10,  20,  10,    0,  -15 },   // 0xE1
-        {  1650,  10,  20,  10,    0,  -15 },   // 0xE2
-        {  1675,  10,  20,  10,    0,  -15 },   // 0xE3
-        {  1700,  10,  20,  10,    0,  -15 },   // 0xE4
-        {  1725,  10,  20,  10,    0,  -15 },   // 0xE5
-        {  1750,  10,  20,  10,    0,  -15 },   // 0xE6
-        {  1775,  10,  20,  10,    0,  -15 },   // 0xE7
-        {  1800,  10,  20,  10,    0,  -15 },   // 0xE8
-        {  1825,  10,  20,  10,    0,  -15 },   // 0xE9
-        {  1850,  10,  20,  10,    0,  -15 },   // 0xEA
-        {  1875,  10,  20,  10,    0,  -15 },   // 0xEB
-        {  1900,  10,  20,  10,    0,  -15 },   // 0xEC
-        {  1925,  10,  20,  10,    0,  -15 },   // 0xED
-        {  1950,  10,  20,  10,    0,  -15 },   // 0xEE
-        {  1975,  10,  20,  10,    0,  -15 },   // 0xEF
-        {  2000,  10,  20,  10,    0,  -15 },   // 0xF0
-        {  2025,  10,  20,  10,    0,  -15 },   // 0xF1
-        {  2050,  10,  20,  10,    0,  -15 },   // 0xF2
-        {  2075,  10,  20,  10,    0,  -15 },   // 0xF3
-        {  2100,  10,  20,  10,    0,  -15 },   // 0xF4
-        {  2125,  10,  20,  10,    0,  -15 },   // 0xF5
-        {  2150,  10,  20,  10,    0,  -15 },   // 0xF6
-        {  2175,  10,  20,  10,    0,  -15 },   // 0xF7
-        {  2200,  10,  20,  10,    0,  -15 },   // 0xF8
-        {  2225,  10,  20,  10,    0,  -15 },   // 0xF9
-        {  2250,  10,  20,  10,    0,  -15 },   // 0xFA
-        {  2275,  10,  20,  10,    0,  -15 },   // 0xFB
-        {  2300,  10,  20,  10,    0,  -15 },   // 0xFC
-        {  2325,  10,  20,  10,    0,  -15 },   // 0xFD
-        {  2350,  10,  20,  10,    0,  -15 },   // 0xFE
-        {  2375,  10,  20,  10,    0,  -15 },   // 0xFF
+        {     0,   0,  20,  10,    0,  -15 },   // 0xA0
+        {     0,   2,  20,  10,    4,  -15 },   // 0xA1
+        {     6,   8,  20,  10,    1,  -15 },   // 0xA2
+        {    22,   8,  20,  10,    1,  -15 },   // 0xA3
+        {    38,   9,  20,  10,    0,  -15 },   // 0xA4
+        {    53,   8,  20,  10,    1,  -15 },   // 0xA5
+        {    69,   2,  20,  10,    4,  -15 },   // 0xA6
+        {    75,   6,  20,  10,    2,  -15 },   // 0xA7
+        {    90,   6,  20,  10,    2,  -15 },   // 0xA8
+        {    95,  10,  20,  10,    0,  -15 },   // 0xA9
+        {   111,   7,  20,  10,    1,  -15 },   // 0xAA
+        {   121,  10,  20,  10,    0,  -15 },   // 0xAB
+        {   136,   8,  20,  10,    1,  -15 },   // 0xAC
+        {   144,   6,  20,  10,    2,  -15 },   // 0xAD
+        {   148,  10,  20,  10,    0,  -15 },   // 0xAE
+        {   164,   6,  20,  10,    2,  -15 },   // 0xAF
+        {   168,   6,  20,  10,    2,  -15 },   // 0xB0
+        {   175,   8,  20,  10,    1,  -15 },   // 0xB1
+        {   186,   6,  20,  10,    2,  -15 },   // 0xB2
+        {   195,   6,  20,  10,    2,  -15 },   // 0xB3
+        {   204,   3,  20,  10,    4,  -15 },   // 0xB4
+        {   208,   8,  20,  10,    1,  -15 },   // 0xB5
+        {   223,   8,  20,  10,    1,  -15 },   // 0xB6
+        {   239,   2,  20,  10,    4,  -15 },   // 0xB7
+        {   243,   3,  20,  10,    3,  -15 },   // 0xB8
+        {   248,   4,  20,  10,    3,  -15 },   // 0xB9
+        {   255,   7,  20,  10,    1,  -15 },   // 0xBA
+        {   265,  10,  20,  10,    0,  -15 },   // 0xBB
+        {   280,   9,  20,  10,    0,  -15 },   // 0xBC
+        {   300,   9,  20,  10,    0,  -15 },   // 0xBD
+        {   320,   9,  20,  10,    0,  -15 },   // 0xBE
+        {   340,   8,  20,  10,    1,  -15 },   // 0xBF
+        {   354,   8,  20,  10,    1,  -15 },   // 0xC0
+        {   372,   8,  20,  10,    1,  -15 },   // 0xC1
+        {   390,   8,  20,  10,    1,  -15 },   // 0xC2
+        {   408,   8,  20,  10,    1,  -15 },   // 0xC3
+        {   426,   8,  20,  10,    1,  -15 },   // 0xC4
+        {   444,   8,  20,  10,    1,  -15 },   // 0xC5
+        {   463,  10,  20,  10,    0,  -15 },   // 0xC6
+        {   483,   8,  20,  10,    1,  -15 },   // 0xC7
+        {   502,   8,  20,  10,    1,  -15 },   // 0xC8
+        {   520,   8,  20,  10,    1,  -15 },   // 0xC9
+        {   538,   8,  20,  10,    1,  -15 },   // 0xCA
+        {   556,   8,  20,  10,    1,  -15 },   // 0xCB
+        {   574,   4,  20,  10,    3,  -15 },   // 0xCC
+        {   585,   4,  20,  10,    3,  -15 },   // 0xCD
+        {   596,   6,  20,  10,    2,  -15 },   // 0xCE
+        {   611,   6,  20,  10,    2,  -15 },   // 0xCF
+        {   626,   9,  20,  10,    0,  -15 },   // 0xD0
+        {   644,   8,  20,  10,    1,  -15 },   // 0xD1
+        {   662,   8,  20,  10,    1,  -15 },   // 0xD2
+        {   680,   8,  20,  10,    1,  -15 },   // 0xD3
+        {   698,   8,  20,  10,    1,  -15 },   // 0xD4
+        {   716,   8,  20,  10,    1,  -15 },   // 0xD5
+        {   734,   8,  20,  10,    1,  -15 },   // 0xD6
+        {   752,   8,  20,  10,    1,  -15 },   // 0xD7
+        {   762,  10,  20,  10,    0,  -15 },   // 0xD8
+        {   782,   8,  20,  10,    1,  -15 },   // 0xD9
+        {   800,   8,  20,  10,    1,  -15 },   // 0xDA
+        {   818,   8,  20,  10,    1,  -15 },   // 0xDB
+        {   836,   8,  20,  10,    1,  -15 },   // 0xDC
+        {   854,   8,  20,  10,    1,  -15 },   // 0xDD
+        {   872,   8,  20,  10,    1,  -15 },   // 0xDE
+        {   888,   8,  20,  10,    1,  -15 },   // 0xDF
+        {   904,   8,  20,  10,    1,  -15 },   // 0xE0
+        {   918,   8,  20,  10,    1,  -15 },   // 0xE1
+        {   932,   8,  20,  10,    1,  -15 },   // 0xE2
+        {   946,   8,  20,  10,    1,  -15 },   // 0xE3
+        {   960,   8,  20,  10,    1,  -15 },   // 0xE4
+        {   974,   8,  20,  10,    1,  -15 },   // 0xE5
+        {   989,  10,  20,  10,    0,  -15 },   // 0xE6
+        {  1004,   8,  20,  10,    1,  -15 },   // 0xE7
+        {  1019,   8,  20,  10,    1,  -15 },   // 0xE8
+        {  1033,   8,  20,  10,    1,  -15 },   // 0xE9
+        {  1047,   8,  20,  10,    1,  -15 },   // 0xEA
+        {  1061,   8,  20,  10,    1,  -15 },   // 0xEB
+        {  1075,   4,  20,  10,    3,  -15 },   // 0xEC
+        {  1084,   4,  20,  10,    3,  -15 },   // 0xED
+        {  1093,   6,  20,  10,    2,  -15 },   // 0xEE
+        {  1105,   6,  20,  10,    2,  -15 },   // 0xEF
+        {  1117,   8,  20,  10,    1,  -15 },   // 0xF0
+        {  1133,   8,  20,  10,    1,  -15 },   // 0xF1
+        {  1147,   8,  20,  10,    1,  -15 },   // 0xF2
+        {  1161,   8,  20,  10,    1,  -15 },   // 0xF3
+        {  1175,   8,  20,  10,    1,  -15 },   // 0xF4
+        {  1189,   8,  20,  10,    1,  -15 },   // 0xF5
+        {  1203,   8,  20,  10,    1,  -15 },   // 0xF6
+        {  1217,   8,  20,  10,    1,  -15 },   // 0xF7
+        {  1225,  10,  20,  10,    0,  -15 },   // 0xF8
+        {  1240,   8,  20,  10,    1,  -15 },   // 0xF9
+        {  1254,   8,  20,  10,    1,  -15 },   // 0xFA
+        {  1268,   8,  20,  10,    1,  -15 },   // 0xFB
+        {  1282,   8,  20,  10,    1,  -15 },   // 0xFC
+        {  1296,   8,  20,  10,    1,  -15 },   // 0xFD
+        {  1313,   8,  20,  10,    1,  -15 },   // 0xFE
+        {  1332,   8,  20,  10,    1,  -15 },   // 0xFF
       },  0x20, 0x7f, 0
 
-    }, 0x80, 0xa0, 0xff
+    }, 0x80, 0xa0, 0xff, true
   },
-  // Approx. 3079 bytes
+  // Approx. 2028 bytes
 
   {
     {
       (uint8_t[]){
-        0x18, 0x03, 0x00, 0x01, 0xfe, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x1f,
-        0x86, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x33, 0x0c, 0xc0, 0x01, 0xfe, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60,
-        0x1f, 0x86, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0xfe, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x30, 0x0c, 0x03, 0x00, 0xfc,
-        0x31, 0x8c, 0x63, 0x18, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0xcc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x01, 0xfe, 0x60, 0x18, 0x06, 0x01,
-        0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66,
-        0x01, 0x80, 0x60, 0x1f, 0x86, 0x01, 0x80, 0x60, 0x18, 0x66, 0x18, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98,
-        0x66, 0x01, 0x80, 0x60, 0x0f, 0xc0, 0x18, 0x06, 0x01, 0x98, 0x66, 0x18,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c,
-        0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00,
-        0xc0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc0, 0x00, 0x78,
-        0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03,
-        0x00, 0xc0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1e, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x63,
-        0x18, 0xc6, 0x30, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xf0, 0x6c, 0x33, 0x0c, 0xc3, 0x30, 0xcf, 0xb3, 0x3c, 0xcf, 0x33,
-        0xcc, 0xf3, 0x3c, 0xce, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x03, 0x30, 0xcc, 0x33, 0x0c, 0xc3, 0x30, 0xcf, 0xbf, 0x3c, 0xcf,
-        0x33, 0xcc, 0xf3, 0x3c, 0xcf, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0xf0, 0x30, 0x0c, 0x03, 0x00, 0xfc, 0x31, 0x8c, 0x63,
-        0x18, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x06, 0x03, 0x00, 0x01, 0x86, 0x61, 0x98, 0xc6, 0x61, 0xb0, 0x78, 0x1c,
-        0x07, 0x81, 0xb0, 0x66, 0x18, 0xc6, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x18, 0x03, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x8e, 0x67,
-        0x9b, 0x67, 0x99, 0xc6, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x33, 0x07, 0x80, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x63, 0xf8, 0x06, 0x01, 0x80, 0x60, 0x18, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0xfe, 0x0c,
-        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x61, 0x9f, 0xe6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x60, 0x18,
-        0x06, 0x01, 0x80, 0x7f, 0x18, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x61,
-        0x98, 0x66, 0x19, 0x86, 0x7f, 0x18, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66,
-        0x19, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe,
-        0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18,
-        0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7c, 0x33, 0x18, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0xc6, 0x31, 0x8c, 0x63,
-        0x18, 0xc6, 0x33, 0xfe, 0xc1, 0xb0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0xfe, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x1f, 0x86, 0x01, 0x80,
-        0x60, 0x18, 0x06, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xb6, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x3f, 0x07, 0x83, 0xf1,
-        0xb6, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x60, 0x18, 0x06, 0x01, 0x87, 0xc0,
-        0x18, 0x06, 0x01, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x8e, 0x67, 0x9b,
-        0x67, 0x99, 0xc6, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x33, 0x07, 0x80, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x8e, 0x67,
-        0x9b, 0x67, 0x99, 0xc6, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0xc6, 0x61, 0xb0,
-        0x78, 0x1c, 0x07, 0x81, 0xb0, 0x66, 0x18, 0xc6, 0x19, 0x86, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x19, 0x8c, 0x63, 0x18,
-        0xc6, 0x31, 0x8c, 0x63, 0x18, 0xc6, 0x31, 0x8c, 0x63, 0x19, 0x86, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0xc1, 0xb8, 0xef,
-        0x7b, 0x76, 0xc9, 0xb0, 0x6c, 0x1b, 0x06, 0xc1, 0xb0, 0x6c, 0x1b, 0x06,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98,
-        0x66, 0x19, 0x86, 0x61, 0x9f, 0xe6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61,
-        0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66,
-        0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfe,
-        0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98,
-        0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9f, 0xc6, 0x01, 0x80, 0x60,
-        0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xfc, 0x61, 0x98, 0x66, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
-        0x60, 0x18, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xfe, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0,
-        0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x63,
-        0xf8, 0x06, 0x01, 0x80, 0x60, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xc0, 0xfc, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x6d, 0x9b,
-        0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd8, 0xfc, 0x0c, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x63, 0x30, 0xcc, 0x1e,
-        0x03, 0x01, 0xe0, 0xcc, 0x33, 0x18, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xff, 0x00, 0xc0,
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x61, 0x8f, 0xe0, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb6, 0x6d, 0x9b, 0x66,
-        0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd8, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb6, 0x6d, 0x9b,
-        0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd8,
-        0xff, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xe0,
-        0x18, 0x06, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66,
-        0x19, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x06,
-        0xc1, 0xb0, 0x6c, 0x1b, 0xe6, 0xcd, 0xb3, 0x6c, 0xdb, 0x36, 0xcd, 0xb3,
-        0x6c, 0xdb, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x80, 0x60, 0x18, 0x06, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
-        0x98, 0x66, 0x19, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xfc, 0x61, 0x98, 0x60, 0x18, 0x06, 0x01, 0x87, 0xe0, 0x18, 0x06,
-        0x01, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x03, 0x3c, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd9, 0xbe, 0x6d, 0x9b,
-        0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xfe, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x8f, 0xe0,
-        0x78, 0x36, 0x19, 0x8c, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x80,
-        0x63, 0xf9, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x60, 0x18, 0x06, 0x01, 0xfc, 0x61,
-        0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0xfc, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x63, 0x18, 0xc6, 0x31, 0x88,
-        0x7f, 0x18, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0xfe, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xfe, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfe,
-        0x01, 0x80, 0x63, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0xfe, 0x60, 0x18, 0x06, 0x18,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0xb6, 0x6d, 0x9b, 0x63, 0xf0, 0x78, 0x3f, 0x1b, 0x66,
-        0xd9, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x80, 0x60, 0x18, 0x7c, 0x01, 0x80,
-        0x66, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61,
-        0x98, 0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x33, 0x07, 0x80, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x63, 0x19, 0x86, 0xc1,
-        0xe0, 0x6c, 0x19, 0x86, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x19, 0x8c, 0x63,
-        0x18, 0xc6, 0x31, 0x8c, 0x63, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x61, 0x9c,
-        0xe7, 0xf9, 0xb6, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61,
-        0x98, 0x66, 0x19, 0xfe, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
-        0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x18, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0xfe, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0xfc,
-        0x60, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xfc, 0x61, 0x98, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x18,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0xfe, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00,
-        0xc0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98,
-        0x66, 0x18, 0xfe, 0x01, 0x80, 0x63, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x00, 0xc0, 0xfc, 0x6d, 0x9b, 0x66, 0xd9, 0xb6, 0x6d,
-        0x9b, 0x66, 0xd8, 0xfc, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x8c, 0xc1, 0xe0, 0x30,
-        0x1e, 0x0c, 0xc6, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x18, 0xff, 0x00, 0xc0, 0x30, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66,
-        0x18, 0xfe, 0x01, 0x80, 0x60, 0x18, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb6, 0x6d, 0x9b,
-        0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd8, 0xfe, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb6, 0x6d,
-        0x9b, 0x66, 0xd9, 0xb6, 0x6d, 0x9b, 0x66, 0xd8, 0xff, 0x00, 0xc0, 0x30,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0,
-        0x30, 0x0c, 0x03, 0xf0, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-        0x06, 0xc1, 0xb0, 0x6f, 0x9b, 0x36, 0xcd, 0xb3, 0x6c, 0xdb, 0xe6, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x80, 0x60, 0x18, 0x07, 0xe1, 0x8c, 0x63, 0x18, 0xc6, 0x31, 0xf8,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xfc, 0x61, 0x80, 0x60, 0x18, 0x7e, 0x01, 0x80, 0x66, 0x18,
-        0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x3c, 0xd9, 0xb6, 0x6d, 0x9b, 0xe6, 0xd9, 0xb6, 0x6d,
-        0x9b, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xfe, 0x61, 0x98, 0x66, 0x18, 0xfe, 0x0d, 0x86,
-        0x63, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x18, 0x03, 0x00, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0xfe, 0x60,
-        0x18, 0x06, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x33, 0x0c, 0xc0, 0x00, 0xfc, 0x61, 0x98, 0x66, 0x19, 0xfe,
-        0x60, 0x18, 0x06, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x80, 0xfc, 0x18, 0x06, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x01, 0x80, 0x60, 0x70, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x01, 0xfe, 0x60, 0x18, 0x06,
-        0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61, 0x98,
-        0x06, 0x01, 0xf8, 0x60, 0x18, 0x06, 0x18, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x61,
-        0x98, 0x06, 0x00, 0xfc, 0x01, 0x80, 0x66, 0x18, 0xfc, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x70,
-        0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x78, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x0c, 0xc0, 0x00,
-        0x70, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x78, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00,
-        0x00, 0x1c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c,
-        0x33, 0x0c, 0xc1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xf0, 0x6c, 0x33, 0x0c, 0xfb, 0x33, 0xcc, 0xf3, 0x3c, 0xce,
-        0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x30, 0xcc, 0x33, 0x0c, 0xfb, 0xf3, 0xcc, 0xf3, 0x3c,
-        0xcf, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-        0xfc, 0x18, 0x06, 0x01, 0xfc, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98,
-        0x66, 0x19, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x06, 0x03, 0x00, 0x01, 0x86, 0x63, 0x19, 0x86, 0xc1, 0xe0, 0x6c,
-        0x19, 0x86, 0x31, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0x03, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86,
-        0x61, 0x98, 0x66, 0x18, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x33, 0x07, 0x80, 0x01, 0x86, 0x61, 0x98, 0x66, 0x19,
-        0x86, 0x61, 0x98, 0x66, 0x18, 0xfe, 0x01, 0x80, 0x63, 0xf0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x86, 0x61, 0x98, 0x66,
-        0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0xfe, 0x0c, 0x03, 0x00, 0x00, 0x00
+        0xdf, 0xff, 0x00, 0x30, 0x18, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc,
+        0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff, 0xdf, 0xff, 0x00, 0x66, 0x66, 0xff,
+        0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xff,
+        0x1f, 0xff, 0x00, 0xfc, 0x18, 0x0c, 0x06, 0x03, 0xf1, 0x8c, 0xc6, 0x63,
+        0x31, 0x98, 0xcc, 0x66, 0x33, 0x30, 0xdf, 0xff, 0x00, 0x0c, 0x18, 0xff,
+        0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+        0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0,
+        0xc0, 0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc0, 0xc0,
+        0xc0, 0x7e, 0x03, 0x03, 0x03, 0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0xf6,
+        0x66, 0x66, 0x66, 0x66, 0x66, 0xf0, 0xdf, 0xff, 0x00, 0xcf, 0x37, 0x8c,
+        0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc7, 0x80, 0x1f, 0xff, 0x00,
+        0x0f, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0xc6, 0xc6, 0xc6,
+        0x7c, 0x1f, 0xff, 0x00, 0x3c, 0x1b, 0x0c, 0xc3, 0x30, 0xcc, 0x33, 0xec,
+        0xcf, 0x33, 0xcc, 0xf3, 0x3c, 0xcf, 0x33, 0x8f, 0x80, 0x1f, 0xff, 0x00,
+        0xcc, 0x33, 0x0c, 0xc3, 0x30, 0xcc, 0x33, 0xef, 0xcf, 0x33, 0xcc, 0xf3,
+        0x3c, 0xcf, 0x33, 0xcf, 0x80, 0x1f, 0xff, 0x00, 0xfc, 0x18, 0x0c, 0x06,
+        0x03, 0xf1, 0x8c, 0xc6, 0x63, 0x31, 0x98, 0xcc, 0x66, 0x33, 0x18, 0xdf,
+        0xff, 0x00, 0x0c, 0x18, 0xc3, 0xc3, 0xc6, 0xcc, 0xd8, 0xf0, 0xe0, 0xf0,
+        0xd8, 0xcc, 0xc6, 0xc3, 0xc3, 0xdf, 0xff, 0x00, 0x30, 0x18, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc7, 0xcf, 0xdb, 0xf3, 0xe3, 0xc3, 0xc3, 0xc3, 0xc3, 0xdf,
+        0xff, 0x00, 0x66, 0x3c, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f,
+        0x03, 0x03, 0x03, 0x03, 0x7e, 0x1f, 0xff, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0x18, 0x18, 0x1f,
+        0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0x1f, 0xff, 0x00, 0xfe, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0x1f, 0xff, 0x00, 0xfe, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0x1f,
+        0xff, 0x00, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0x1f, 0xff, 0xc0, 0x1f, 0x19, 0x98, 0xcc, 0x66, 0x33,
+        0x19, 0x8c, 0xc6, 0x63, 0x31, 0x98, 0xcc, 0x6f, 0xfe, 0x0f, 0x06, 0x1f,
+        0xff, 0x00, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xff, 0x1f, 0xff, 0x00, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e,
+        0x3c, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x1f, 0xff, 0x00, 0x7e, 0xc3,
+        0xc3, 0x03, 0x03, 0x03, 0x3e, 0x03, 0x03, 0x03, 0xc3, 0xc3, 0x7e, 0x1f,
+        0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xc7, 0xcf, 0xdb, 0xf3, 0xe3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xdf, 0xff, 0x00, 0x66, 0x3c, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc7, 0xcf, 0xdb, 0xf3, 0xe3, 0xc3, 0xc3, 0xc3, 0xc3, 0x1f, 0xff, 0x00,
+        0xc3, 0xc3, 0xc6, 0xcc, 0xd8, 0xf0, 0xe0, 0xf0, 0xd8, 0xcc, 0xc6, 0xc3,
+        0xc3, 0x1f, 0xff, 0x00, 0x1f, 0x33, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63,
+        0x63, 0x63, 0x63, 0x63, 0xc3, 0x1f, 0xff, 0x00, 0x80, 0xe0, 0xf8, 0xfe,
+        0xfd, 0xde, 0x4f, 0x07, 0x83, 0xc1, 0xe0, 0xf0, 0x78, 0x3c, 0x18, 0x1f,
+        0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0xff, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x1f,
+        0xff, 0x00, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00, 0xff, 0x18,
+        0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1f,
+        0xff, 0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x03, 0x03,
+        0x03, 0x03, 0x7e, 0x3f, 0xff, 0x80, 0x18, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb,
+        0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x1f, 0xff, 0x00,
+        0xc3, 0xc3, 0xc3, 0x66, 0x66, 0x3c, 0x18, 0x3c, 0x66, 0x66, 0xc3, 0xc3,
+        0xc3, 0x1f, 0xff, 0xc0, 0xc3, 0x61, 0xb0, 0xd8, 0x6c, 0x36, 0x1b, 0x0d,
+        0x86, 0xc3, 0x61, 0xb0, 0xd8, 0x67, 0xf8, 0x0c, 0x06, 0x1f, 0xff, 0x00,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x03, 0x03, 0x03, 0x03, 0x03,
+        0x03, 0x1f, 0xff, 0x00, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb,
+        0xdb, 0xdb, 0xdb, 0xdb, 0x7f, 0x1f, 0xff, 0xc0, 0xdb, 0x6d, 0xb6, 0xdb,
+        0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x67, 0xf8, 0x0c,
+        0x06, 0x1f, 0xff, 0x00, 0xe0, 0x70, 0x18, 0x0c, 0x07, 0xf3, 0x0d, 0x86,
+        0xc3, 0x61, 0xb0, 0xd8, 0x6c, 0x37, 0xf0, 0x1f, 0xff, 0x00, 0xc1, 0xe0,
+        0xf0, 0x78, 0x3f, 0x9e, 0x6f, 0x37, 0x9b, 0xcd, 0xe6, 0xf3, 0x79, 0xbf,
+        0x98, 0x1f, 0xff, 0x00, 0xc0, 0xc0, 0xc0, 0xc0, 0xfe, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0x1f, 0xff, 0x00, 0x7e, 0xc3, 0xc3, 0x03,
+        0x03, 0x03, 0x3f, 0x03, 0x03, 0x03, 0xc3, 0xc3, 0x7e, 0x1f, 0xff, 0x00,
+        0xcf, 0x6c, 0xf6, 0x7b, 0x3d, 0x9e, 0xcf, 0xe7, 0xb3, 0xd9, 0xec, 0xf6,
+        0x7b, 0x3c, 0xf0, 0x1f, 0xff, 0x00, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0x7f, 0x0f, 0x1b, 0x33, 0x63, 0xc3, 0xc3, 0x01, 0xff, 0x00, 0x7e, 0x03,
+        0x03, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x1f, 0xff, 0x00, 0x7c, 0xc0,
+        0xc0, 0xc0, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0x1f,
+        0xff, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc4, 0xfe, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xfe, 0x01, 0xff, 0x00, 0xff, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+        0xc0, 0xc0, 0xc0, 0x01, 0xff, 0xe0, 0x7f, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0x7f, 0x03, 0x03, 0x7e, 0x01, 0xff, 0x00, 0x7e, 0xc3, 0xc3,
+        0xc3, 0xff, 0xc0, 0xc0, 0xc3, 0x7e, 0x01, 0xff, 0x00, 0xdb, 0xdb, 0xdb,
+        0x7e, 0x3c, 0x7e, 0xdb, 0xdb, 0xdb, 0x01, 0xff, 0x00, 0x7e, 0xc3, 0x03,
+        0x03, 0x3e, 0x03, 0x03, 0xc3, 0x7e, 0x01, 0xff, 0x00, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x0d, 0xff, 0x00, 0x66, 0x3c, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x01, 0xff, 0x00, 0xc3,
+        0xc6, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0xc3, 0x01, 0xff, 0x00, 0x1f,
+        0x33, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xc3, 0x01, 0xff, 0x00, 0x81,
+        0xc3, 0xe7, 0xff, 0xdb, 0xc3, 0xc3, 0xc3, 0xc3, 0x01, 0xff, 0x00, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xff, 0xc3, 0xc3, 0xc3, 0xc3, 0x01, 0xff, 0x00, 0x7e,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7e, 0x01, 0xff, 0x00, 0xff,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x01, 0xff, 0xe0, 0xfe,
+        0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xfe, 0xc0, 0xc0, 0xc0, 0x01,
+        0xff, 0x00, 0x7e, 0xc3, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc3, 0x7e, 0x01,
+        0xff, 0x00, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x01,
+        0xff, 0xe0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x03,
+        0x03, 0x7e, 0x07, 0xff, 0xc0, 0x18, 0x18, 0x7e, 0xdb, 0xdb, 0xdb, 0xdb,
+        0xdb, 0xdb, 0xdb, 0x7e, 0x18, 0x18, 0x01, 0xff, 0x00, 0xc3, 0xc3, 0x66,
+        0x3c, 0x18, 0x3c, 0x66, 0xc3, 0xc3, 0x01, 0xff, 0xc0, 0xc3, 0x61, 0xb0,
+        0xd8, 0x6c, 0x36, 0x1b, 0x0d, 0x86, 0x7f, 0x80, 0xc0, 0x60, 0x01, 0xff,
+        0x00, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x03, 0x03, 0x03, 0x03, 0x01, 0xff,
+        0x00, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0xdb, 0x7f, 0x01, 0xff,
+        0xc0, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0x7f, 0x80,
+        0xc0, 0x60, 0x01, 0xff, 0x00, 0xe0, 0x60, 0x60, 0x7e, 0x63, 0x63, 0x63,
+        0x63, 0x7e, 0x01, 0xff, 0x00, 0xc1, 0xe0, 0xf0, 0x7f, 0x3c, 0xde, 0x6f,
+        0x37, 0x9b, 0xf9, 0x80, 0x01, 0xff, 0x00, 0xc1, 0x83, 0x07, 0xec, 0x78,
+        0xf1, 0xe3, 0xfc, 0x01, 0xff, 0x00, 0x7e, 0xc3, 0x03, 0x03, 0x3f, 0x03,
+        0x03, 0xc3, 0x7e, 0x01, 0xff, 0x00, 0xcf, 0x6c, 0xf6, 0x7b, 0x3f, 0x9e,
+        0xcf, 0x67, 0xb3, 0xcf, 0x00, 0x01, 0xff, 0x00, 0x7f, 0xc3, 0xc3, 0xc3,
+        0x7f, 0x1b, 0x33, 0x63, 0xc3, 0x0d, 0xff, 0x00, 0x30, 0x18, 0x7e, 0xc3,
+        0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc3, 0x7e, 0x0d, 0xff, 0x00, 0x66, 0x66,
+        0x7e, 0xc3, 0xc3, 0xc3, 0xff, 0xc0, 0xc0, 0xc3, 0x7e, 0x1f, 0xff, 0xe0,
+        0x60, 0x7e, 0x18, 0x0c, 0x07, 0xf3, 0x0d, 0x86, 0xc3, 0x61, 0xb0, 0xd8,
+        0x6c, 0x36, 0x18, 0x0c, 0x06, 0x0e, 0x0d, 0xff, 0x00, 0x0c, 0x18, 0xff,
+        0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x01, 0xff, 0x00, 0x7e,
+        0xc3, 0xc0, 0xc0, 0xfc, 0xc0, 0xc0, 0xc3, 0x7e, 0x01, 0xff, 0x00, 0x7e,
+        0xc3, 0xc0, 0xc0, 0x7e, 0x03, 0x03, 0xc3, 0x7e, 0x19, 0xff, 0x00, 0x66,
+        0xe6, 0x66, 0x66, 0x66, 0xf0, 0x0d, 0xff, 0x00, 0xcf, 0x37, 0x0c, 0x30,
+        0xc3, 0x0c, 0x30, 0xc7, 0x80, 0x19, 0xff, 0xe0, 0x0c, 0x31, 0xc3, 0x0c,
+        0x30, 0xc3, 0x0c, 0x30, 0xf3, 0xcd, 0xe0, 0x01, 0xff, 0x00, 0x3c, 0x1b,
+        0x0c, 0xc3, 0x3e, 0xcc, 0xf3, 0x3c, 0xcf, 0x33, 0x8f, 0x80, 0x01, 0xff,
+        0x00, 0xcc, 0x33, 0x0c, 0xc3, 0x3e, 0xfc, 0xf3, 0x3c, 0xcf, 0x33, 0xcf,
+        0x80, 0x1f, 0xff, 0x00, 0x60, 0x7e, 0x18, 0x0c, 0x07, 0xf3, 0x0d, 0x86,
+        0xc3, 0x61, 0xb0, 0xd8, 0x6c, 0x36, 0x18, 0x0d, 0xff, 0x00, 0x0c, 0x18,
+        0xc3, 0xc6, 0xcc, 0xd8, 0xf0, 0xd8, 0xcc, 0xc6, 0xc3, 0x0d, 0xff, 0x00,
+        0x30, 0x18, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0x7f, 0x0d,
+        0xff, 0xe0, 0x66, 0x3c, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0x7f, 0x03, 0x03, 0x7e, 0x01, 0xff, 0xc0, 0xc3, 0xc3, 0xc3, 0xc3, 0xc3,
+        0xc3, 0xc3, 0xc3, 0xff, 0x18, 0x18
       },
       (GFXglyph[]){
-        {     0,  10,  20,  10,    0,  -15 },   // 0x400
-        {    25,  10,  20,  10,    0,  -15 },   // 0x401
-        {    50,  10,  20,  10,    0,  -15 },   // 0x402
-        {    75,  10,  20,  10,    0,  -15 },   // 0x403
-        {   100,  10,  20,  10,    0,  -15 },   // 0x404
-        {   125,  10,  20,  10,    0,  -15 },   // 0x405
-        {   150,  10,  20,  10,    0,  -15 },   // 0x406
-        {   175,  10,  20,  10,    0,  -15 },   // 0x407
-        {   200,  10,  20,  10,    0,  -15 },   // 0x408
-        {   225,  10,  20,  10,    0,  -15 },   // 0x409
-        {   250,  10,  20,  10,    0,  -15 },   // 0x40A
-        {   275,  10,  20,  10,    0,  -15 },   // 0x40B
-        {   300,  10,  20,  10,    0,  -15 },   // 0x40C
-        {   325,  10,  20,  10,    0,  -15 },   // 0x40D
-        {   350,  10,  20,  10,    0,  -15 },   // 0x40E
-        {   375,  10,  20,  10,    0,  -15 },   // 0x40F
-        {   400,  10,  20,  10,    0,  -15 },   // 0x410
-        {   425,  10,  20,  10,    0,  -15 },   // 0x411
-        {   450,  10,  20,  10,    0,  -15 },   // 0x412
-        {   475,  10,  20,  10,    0,  -15 },   // 0x413
-        {   500,  10,  20,  10,    0,  -15 },   // 0x414
-        {   525,  10,  20,  10,    0,  -15 },   // 0x415
-        {   550,  10,  20,  10,    0,  -15 },   // 0x416
-        {   575,  10,  20,  10,    0,  -15 },   // 0x417
-        {   600,  10,  20,  10,    0,  -15 },   // 0x418
-        {   625,  10,  20,  10,    0,  -15 },   // 0x419
-        {   650,  10,  20,  10,    0,  -15 },   // 0x41A
-        {   675,  10,  20,  10,    0,  -15 },   // 0x41B
-        {   700,  10,  20,  10,    0,  -15 },   // 0x41C
-        {   725,  10,  20,  10,    0,  -15 },   // 0x41D
-        {   750,  10,  20,  10,    0,  -15 },   // 0x41E
-        {   775,  10,  20,  10,    0,  -15 },   // 0x41F
-        {   800,  10,  20,  10,    0,  -15 },   // 0x420
-        {   825,  10,  20,  10,    0,  -15 },   // 0x421
-        {   850,  10,  20,  10,    0,  -15 },   // 0x422
-        {   875,  10,  20,  10,    0,  -15 },   // 0x423
-        {   900,  10,  20,  10,    0,  -15 },   // 0x424
-        {   925,  10,  20,  10,    0,  -15 },   // 0x425
-        {   950,  10,  20,  10,    0,  -15 },   // 0x426
-        {   975,  10,  20,  10,    0,  -15 },   // 0x427
-        {  1000,  10,  20,  10,    0,  -15 },   // 0x428
-        {  1025,  10,  20,  10,    0,  -15 },   // 0x429
-        {  1050,  10,  20,  10,    0,  -15 },   // 0x42A
-        {  1075,  10,  20,  10,    0,  -15 },   // 0x42B
-        {  1100,  10,  20,  10,    0,  -15 },   // 0x42C
-        {  1125,  10,  20,  10,    0,  -15 },   // 0x42D
-        {  1150,  10,  20,  10,    0,  -15 },   // 0x42E
-        {  1175,  10,  20,  10,    0,  -15 },   // 0x42F
-        {  1200,  10,  20,  10,    0,  -15 },   // 0x430
-        {  1225,  10,  20,  10,    0,  -15 },   // 0x431
-        {  1250,  10,  20,  10,    0,  -15 },   // 0x432
-        {  1275,  10,  20,  10,    0,  -15 },   // 0x433
-        {  1300,  10,  20,  10,    0,  -15 },   // 0x434
-        {  1325,  10,  20,  10,    0,  -15 },   // 0x435
-        {  1350,  10,  20,  10,    0,  -15 },   // 0x436
-        {  1375,  10,  20,  10,    0,  -15 },   // 0x437
-        {  1400,  10,  20,  10,    0,  -15 },   // 0x438
-        {  1425,  10,  20,  10,    0,  -15 },   // 0x439
-        {  1450,  10,  20,  10,    0,  -15 },   // 0x43A
-        {  1475,  10,  20,  10,    0,  -15 },   // 0x43B
-        {  1500,  10,  20,  10,    0,  -15 },   // 0x43C
-        {  1525,  10,  20,  10,    0,  -15 },   // 0x43D
-        {  1550,  10,  20,  10,    0,  -15 },   // 0x43E
-        {  1575,  10,  20,  10,    0,  -15 },   // 0x43F
-        {  1600,  10,  20,  10,    0,  -15 },   // 0x440
-        {  1625,  10,  20,  10,    0,  -15 },   // 0x441
-        {  1650,  10,  20,  10,    0,  -15 },   // 0x442
-        {  1675,  10,  20,  10,    0,  -15 },   // 0x443
-        {  1700,  10,  20,  10,    0,  -15 },   // 0x444
-        {  1725,  10,  20,  10,    0,  -15 },   // 0x445
-        {  1750,  10,  20,  10,    0,  -15 },   // 0x446
-        {  1775,  10,  20,  10,    0,  -15 },   // 0x447
-        {  1800,  10,  20,  10,    0,  -15 },   // 0x448
-        {  1825,  10,  20,  10,    0,  -15 },   // 0x449
-        {  1850,  10,  20,  10,    0,  -15 },   // 0x44A
-        {  1875,  10,  20,  10,    0,  -15 },   // 0x44B
-        {  1900,  10,  20,  10,    0,  -15 },   // 0x44C
-        {  1925,  10,  20,  10,    0,  -15 },   // 0x44D
-        {  1950,  10,  20,  10,    0,  -15 },   // 0x44E
-        {  1975,  10,  20,  10,    0,  -15 },   // 0x44F
-        {  2000,  10,  20,  10,    0,  -15 },   // 0x450
-        {  2025,  10,  20,  10,    0,  -15 },   // 0x451
-        {  2050,  10,  20,  10,    0,  -15 },   // 0x452
-        {  2075,  10,  20,  10,    0,  -15 },   // 0x453
-        {  2100,  10,  20,  10,    0,  -15 },   // 0x454
-        {  2125,  10,  20,  10,    0,  -15 },   // 0x455
-        {  2150,  10,  20,  10,    0,  -15 },   // 0x456
-        {  2175,  10,  20,  10,    0,  -15 },   // 0x457
-        {  2200,  10,  20,  10,    0,  -15 },   // 0x458
-        {  2225,  10,  20,  10,    0,  -15 },   // 0x459
-        {  2250,  10,  20,  10,    0,  -15 },   // 0x45A
-        {  2275,  10,  20,  10,    0,  -15 },   // 0x45B
-        {  2300,  10,  20,  10,    0,  -15 },   // 0x45C
-        {  2325,  10,  20,  10,    0,  -15 },   // 0x45D
-        {  2350,  10,  20,  10,    0,  -15 },   // 0x45E
-        {  2375,  10,  20,  10,    0,  -15 },   // 0x45F
+        {     0,   8,  20,  10,    1,  -15 },   // 0x400
+        {    18,   8,  20,  10,    1,  -15 },   // 0x401
+        {    36,   9,  20,  10,    0,  -15 },   // 0x402
+        {    54,   8,  20,  10,    1,  -15 },   // 0x403
+        {    72,   8,  20,  10,    1,  -15 },   // 0x404
+        {    88,   8,  20,  10,    1,  -15 },   // 0x405
+        {   104,   4,  20,  10,    3,  -15 },   // 0x406
+        {   114,   6,  20,  10,    2,  -15 },   // 0x407
+        {   129,   8,  20,  10,    1,  -15 },   // 0x408
+        {   145,  10,  20,  10,    0,  -15 },   // 0x409
+        {   165,  10,  20,  10,    0,  -15 },   // 0x40A
+        {   185,   9,  20,  10,    0,  -15 },   // 0x40B
+        {   203,   8,  20,  10,    1,  -15 },   // 0x40C
+        {   221,   8,  20,  10,    1,  -15 },   // 0x40D
+        {   239,   8,  20,  10,    1,  -15 },   // 0x40E
+        {   257,   8,  20,  10,    1,  -15 },   // 0x40F
+        {   275,   8,  20,  10,    1,  -15 },   // 0x410
+        {   291,   8,  20,  10,    1,  -15 },   // 0x411
+        {   307,   8,  20,  10,    1,  -15 },   // 0x412
+        {   323,   8,  20,  10,    1,  -15 },   // 0x413
+        {   339,   9,  20,  10,    0,  -15 },   // 0x414
+        {   359,   8,  20,  10,    1,  -15 },   // 0x415
+        {   375,   8,  20,  10,    1,  -15 },   // 0x416
+        {   391,   8,  20,  10,    1,  -15 },   // 0x417
+        {   407,   8,  20,  10,    1,  -15 },   // 0x418
+        {   423,   8,  20,  10,    1,  -15 },   // 0x419
+        {   441,   8,  20,  10,    1,  -15 },   // 0x41A
+        {   457,   8,  20,  10,    1,  -15 },   // 0x41B
+        {   473,   9,  20,  10,    0,  -15 },   // 0x41C
+        {   491,   8,  20,  10,    1,  -15 },   // 0x41D
+        {   507,   8,  20,  10,    1,  -15 },   // 0x41E
+        {   523,   8,  20,  10,    1,  -15 },   // 0x41F
+        {   539,   8,  20,  10,    1,  -15 },   // 0x420
+        {   555,   8,  20,  10,    1,  -15 },   // 0x421
+        {   571,   8,  20,  10,    1,  -15 },   // 0x422
+        {   587,   8,  20,  10,    1,  -15 },   // 0x423
+        {   603,   8,  20,  10,    1,  -15 },   // 0x424
+        {   621,   8,  20,  10,    1,  -15 },   // 0x425
+        {   637,   9,  20,  10,    1,  -15 },   // 0x426
+        {   657,   8,  20,  10,    1,  -15 },   // 0x427
+        {   673,   8,  20,  10,    1,  -15 },   // 0x428
+        {   689,   9,  20,  10,    1,  -15 },   // 0x429
+        {   709,   9,  20,  10,    0,  -15 },   // 0x42A
+        {   727,   9,  20,  10,    0,  -15 },   // 0x42B
+        {   745,   8,  20,  10,    1,  -15 },   // 0x42C
+        {   761,   8,  20,  10,    1,  -15 },   // 0x42D
+        {   777,   9,  20,  10,    0,  -15 },   // 0x42E
+        {   795,   8,  20,  10,    1,  -15 },   // 0x42F
+        {   811,   8,  20,  10,    1,  -15 },   // 0x430
+        {   823,   8,  20,  10,    1,  -15 },   // 0x431
+        {   839,   8,  20,  10,    1,  -15 },   // 0x432
+        {   855,   8,  20,  10,    1,  -15 },   // 0x433
+        {   867,   8,  20,  10,    1,  -15 },   // 0x434
+        {   882,   8,  20,  10,    1,  -15 },   // 0x435
+        {   894,   8,  20,  10,    1,  -15 },   // 0x436
+        {   906,   8,  20,  10,    1,  -15 },   // 0x437
+        {   918,   8,  20,  10,    1,  -15 },   // 0x438
+        {   930,   8,  20,  10,    1,  -15 },   // 0x439
+        {   944,   8,  20,  10,    1,  -15 },   // 0x43A
+        {   956,   8,  20,  10,    1,  -15 },   // 0x43B
+        {   968,   8,  20,  10,    1,  -15 },   // 0x43C
+        {   980,   8,  20,  10,    1,  -15 },   // 0x43D
+        {   992,   8,  20,  10,    1,  -15 },   // 0x43E
+        {  1004,   8,  20,  10,    1,  -15 },   // 0x43F
+        {  1016,   8,  20,  10,    1,  -15 },   // 0x440
+        {  1031,   8,  20,  10,    1,  -15 },   // 0x441
+        {  1043,   8,  20,  10,    1,  -15 },   // 0x442
+        {  1055,   8,  20,  10,    1,  -15 },   // 0x443
+        {  1070,   8,  20,  10,    1,  -15 },   // 0x444
+        {  1086,   8,  20,  10,    1,  -15 },   // 0x445
+        {  1098,   9,  20,  10,    1,  -15 },   // 0x446
+        {  1114,   8,  20,  10,    1,  -15 },   // 0x447
+        {  1126,   8,  20,  10,    1,  -15 },   // 0x448
+        {  1138,   9,  20,  10,    1,  -15 },   // 0x449
+        {  1154,   8,  20,  10,    1,  -15 },   // 0x44A
+        {  1166,   9,  20,  10,    0,  -15 },   // 0x44B
+        {  1180,   7,  20,  10,    1,  -15 },   // 0x44C
+        {  1191,   8,  20,  10,    1,  -15 },   // 0x44D
+        {  1203,   9,  20,  10,    0,  -15 },   // 0x44E
+        {  1217,   8,  20,  10,    1,  -15 },   // 0x44F
+        {  1229,   8,  20,  10,    1,  -15 },   // 0x450
+        {  1243,   8,  20,  10,    1,  -15 },   // 0x451
+        {  1257,   9,  20,  10,    0,  -15 },   // 0x452
+        {  1278,   8,  20,  10,    1,  -15 },   // 0x453
+        {  1292,   8,  20,  10,    1,  -15 },   // 0x454
+        {  1304,   8,  20,  10,    1,  -15 },   // 0x455
+        {  1316,   4,  20,  10,    3,  -15 },   // 0x456
+        {  1325,   6,  20,  10,    2,  -15 },   // 0x457
+        {  1337,   6,  20,  10,    2,  -15 },   // 0x458
+        {  1351,  10,  20,  10,    0,  -15 },   // 0x459
+        {  1366,  10,  20,  10,    0,  -15 },   // 0x45A
+        {  1381,   9,  20,  10,    0,  -15 },   // 0x45B
+        {  1399,   8,  20,  10,    1,  -15 },   // 0x45C
+        {  1413,   8,  20,  10,    1,  -15 },   // 0x45D
+        {  1427,   8,  20,  10,    1,  -15 },   // 0x45E
+        {  1444,   8,  20,  10,    1,  -15 },   // 0x45F
       },  0x00, 0x5f, 0
 
-    }, 0x400, 0x400, 0x45f
+    }, 0x400, 0x400, 0x45f, true
   },
-  // Approx. 3079 bytes
+  // Approx. 2137 bytes
 
 };
+
+const uint8_t ter_x20b_pcf20pt_index[256] = {
+  0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
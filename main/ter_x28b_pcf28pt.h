@@ -2,1504 +2,958 @@ const UnicodeFont ter_x28b_pcf28pt[] = {
   {
     {
       (uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8c, 0x06, 0x30, 0x18, 0xc0, 0x63,
-        0x01, 0x8c, 0x06, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0,
-        0x63, 0x01, 0x8c, 0x06, 0x30, 0x7f, 0xf1, 0xff, 0xc1, 0x8c, 0x06, 0x30,
-        0x18, 0xc0, 0x63, 0x01, 0x8c, 0x06, 0x30, 0x7f, 0xf1, 0xff, 0xc1, 0x8c,
-        0x06, 0x30, 0x18, 0xc0, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc0, 0x03,
-        0x00, 0x7f, 0x83, 0xff, 0x1c, 0xce, 0x63, 0x19, 0x8c, 0x06, 0x30, 0x1c,
-        0xc0, 0x3f, 0xe0, 0x7f, 0xc0, 0x33, 0x80, 0xc6, 0x03, 0x19, 0x8c, 0x67,
-        0x33, 0x8f, 0xfc, 0x1f, 0xe0, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3c, 0x31, 0xf8, 0xc6, 0x66, 0x1f, 0x98, 0x3c, 0xc0, 0x03, 0x00, 0x18,
-        0x00, 0x60, 0x03, 0x00, 0x0c, 0x00, 0x60, 0x01, 0x80, 0x0c, 0x00, 0x33,
-        0xc1, 0x9f, 0x86, 0x66, 0x31, 0xf8, 0xc3, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x0f, 0x00, 0x7e, 0x03, 0x9c, 0x0c, 0x30, 0x30, 0xc0, 0xe7, 0x01,
-        0xf8, 0x03, 0xc0, 0x0e, 0x00, 0x7c, 0x63, 0xbb, 0x9c, 0x7c, 0x60, 0xe1,
-        0x83, 0x86, 0x0e, 0x1c, 0x7c, 0x3f, 0xb8, 0x7c, 0x60, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-        0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x80, 0x0c, 0x00, 0x60, 0x01, 0x80, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0x60, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0xc0, 0x01,
-        0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x30, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x38, 0xe0, 0x77, 0x00, 0xf8, 0x01, 0xc0, 0x7f, 0xf1, 0xff, 0xc0, 0x70,
-        0x03, 0xe0, 0x1d, 0xc0, 0xe3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x7f, 0xf9, 0xff, 0xe0,
-        0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc0, 0x03,
-        0x00, 0x0c, 0x00, 0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1,
-        0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-        0x00, 0xc0, 0x06, 0x00, 0x18, 0x00, 0xc0, 0x03, 0x00, 0x18, 0x00, 0x60,
-        0x03, 0x00, 0x0c, 0x00, 0x60, 0x01, 0x80, 0x0c, 0x00, 0x30, 0x01, 0x80,
-        0x06, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-        0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x71, 0x83, 0xc6, 0x1f, 0x18,
-        0xec, 0x67, 0x31, 0xb8, 0xc7, 0xc3, 0x1e, 0x0c, 0x70, 0x31, 0x80, 0xc6,
-        0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x00, 0x1c, 0x00, 0xf0, 0x07, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c,
-        0x00, 0x30, 0x00, 0xc0, 0x1f, 0xe0, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0,
-        0x03, 0x00, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00,
-        0x70, 0x03, 0x80, 0x1c, 0x00, 0x7f, 0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x1c, 0x0f, 0xe0, 0x3f, 0x80, 0x07, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0xc0, 0x0f, 0x00, 0x7c, 0x03, 0xb0,
-        0x1c, 0xc0, 0xe3, 0x07, 0x0c, 0x38, 0x31, 0xc0, 0xc6, 0x03, 0x18, 0x0c,
-        0x7f, 0xf1, 0xff, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x00, 0x18, 0x00, 0x60,
-        0x01, 0x80, 0x06, 0x00, 0x1f, 0xf0, 0x7f, 0xe0, 0x01, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0xff, 0x87, 0x00, 0x18, 0x00,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x1f, 0xf0, 0x7f, 0xe1, 0x81, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x30, 0x01, 0x80, 0x06, 0x00, 0x30, 0x00, 0xc0, 0x06, 0x00,
-        0x18, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0xff,
-        0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f,
-        0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87,
-        0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x70, 0x30,
-        0xff, 0xc1, 0xff, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x1c,
-        0x3f, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0,
-        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
-        0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x60, 0x03, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07,
-        0x00, 0x38, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00,
-        0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc7, 0xff,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x7f, 0xf0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00,
-        0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80,
-        0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x30, 0x00, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x1f, 0xe0, 0xff, 0xc7, 0x03, 0x98, 0x06, 0x61, 0xf9,
-        0x8f, 0xe6, 0x71, 0x99, 0x86, 0x66, 0x19, 0x98, 0x66, 0x61, 0x99, 0xc6,
-        0x63, 0xf9, 0x87, 0xa6, 0x00, 0x1c, 0x00, 0x3f, 0xf8, 0x7f, 0xe0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0xff, 0xc7, 0xff, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc1, 0xff, 0x86, 0x07, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x06, 0x1f, 0xf0, 0x7f, 0xc1, 0x81, 0x86, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x1c, 0x7f, 0xe1, 0xff,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06,
-        0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0,
-        0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x01, 0xff, 0x06, 0x0e,
-        0x18, 0x18, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x06, 0x18, 0x38, 0x7f,
-        0xc1, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6,
-        0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f, 0x81,
-        0xfe, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00,
-        0x7f, 0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0xff,
-        0xc6, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f,
-        0x81, 0xfe, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
-        0x00, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0,
-        0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0x06, 0x00, 0x18, 0x00,
-        0x63, 0xf1, 0x8f, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x7f, 0xf1, 0xff, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0xc0, 0x3f, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c,
-        0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xf8, 0x07, 0xe0, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-        0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x60, 0x61,
-        0x81, 0x86, 0x06, 0x1c, 0x38, 0x3f, 0xc0, 0x7e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x60, 0x31, 0x81, 0xc6, 0x0e, 0x18, 0x70, 0x63, 0x81, 0x9c,
-        0x06, 0xe0, 0x1f, 0x00, 0x78, 0x01, 0xe0, 0x07, 0xc0, 0x1b, 0x80, 0x67,
-        0x01, 0x8e, 0x06, 0x1c, 0x18, 0x38, 0x60, 0x71, 0x80, 0xc0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01,
-        0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f, 0xf1, 0xff, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x60, 0x19, 0x80, 0x67, 0x03, 0x9e, 0x1e, 0x7c,
-        0xf9, 0xbf, 0x66, 0x79, 0x98, 0xc6, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98,
-        0x06, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80, 0x60,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x70, 0x31, 0xe0, 0xc7, 0xc3, 0x1b, 0x8c, 0x67, 0x31, 0x8e, 0xc6, 0x1f,
-        0x18, 0x3c, 0x60, 0x71, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0,
-        0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc1, 0xff, 0x86, 0x07,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x71, 0xff,
-        0x87, 0xfc, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60,
-        0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87,
-        0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x3b, 0x1c, 0x7c,
-        0x3f, 0xe0, 0x7f, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc1, 0xff,
-        0x86, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x71, 0xff, 0x87, 0xfc, 0x1f, 0x00, 0x6e, 0x01, 0x9c, 0x06, 0x38, 0x18,
-        0x70, 0x60, 0xe1, 0x81, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0,
-        0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1c, 0x00,
-        0x3f, 0xc0, 0x7f, 0x80, 0x07, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc6, 0x03,
-        0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-        0xf9, 0xff, 0xe0, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x30, 0x60, 0xc1, 0x83,
-        0x06, 0x0c, 0x18, 0x18, 0xc0, 0x63, 0x01, 0x8c, 0x06, 0x30, 0x0d, 0x80,
-        0x36, 0x00, 0xd8, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80,
-        0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80, 0x66, 0x31, 0x99, 0xe6, 0x6f,
-        0xd9, 0xf3, 0xe7, 0x87, 0x9c, 0x0e, 0x60, 0x19, 0x80, 0x60, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc3, 0x06, 0x0c, 0x18, 0x18, 0xc0,
-        0x63, 0x00, 0xd8, 0x03, 0x60, 0x07, 0x00, 0x1c, 0x00, 0xd8, 0x03, 0x60,
-        0x18, 0xc0, 0x63, 0x03, 0x06, 0x0c, 0x18, 0x60, 0x31, 0x80, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x60, 0x19, 0x80, 0x63, 0x03, 0x0c, 0x0c, 0x18,
-        0x60, 0x61, 0x80, 0xcc, 0x03, 0x30, 0x07, 0x80, 0x1e, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc0, 0x03, 0x00, 0x0c,
-        0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0,
-        0x0e, 0x00, 0x70, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f, 0xf1, 0xff,
-        0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x3f, 0x00, 0xc0, 0x03,
-        0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0f, 0xc0,
-        0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc0, 0x01, 0x80,
-        0x06, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x60, 0x01, 0x80, 0x03, 0x00, 0x0c,
-        0x00, 0x18, 0x00, 0x60, 0x00, 0xc0, 0x03, 0x00, 0x06, 0x00, 0x18, 0x00,
-        0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x3f, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x01, 0xc0, 0x0f, 0x80, 0x77,
-        0x03, 0x8e, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x7f, 0xf0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x01, 0xfe,
-        0x00, 0x1c, 0x00, 0x30, 0x7f, 0xc3, 0xff, 0x1c, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0xff, 0x07,
-        0xfe, 0x18, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x18, 0x1c, 0x7f, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-        0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60,
-        0x01, 0x80, 0x06, 0x00, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x7f, 0xc3, 0xff, 0x1c, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc7, 0xff, 0x1f,
-        0xfc, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x1f, 0xc0, 0x60, 0x01, 0x80,
-        0x06, 0x00, 0xff, 0x03, 0xfc, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60,
-        0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x7f, 0xc3, 0xff, 0x1c, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0,
-        0x7f, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x70, 0xff, 0x83, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00,
-        0x18, 0x00, 0x60, 0x01, 0xff, 0x07, 0xfe, 0x18, 0x1c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0,
-        0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01,
-        0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x1e, 0x00, 0x18, 0x00,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00,
-        0x18, 0x00, 0x60, 0x01, 0x83, 0x06, 0x0c, 0x18, 0x38, 0xe0, 0x7f, 0x00,
-        0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc1, 0xc3, 0x0e, 0x0c, 0x70,
-        0x33, 0x80, 0xdc, 0x03, 0xe0, 0x0f, 0x00, 0x3e, 0x00, 0xdc, 0x03, 0x38,
-        0x0c, 0x70, 0x30, 0xe0, 0xc1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
-        0x00, 0x3c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x87, 0xff,
-        0x18, 0xce, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c,
-        0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x60, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x07,
-        0xfe, 0x18, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-        0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0xff, 0x07, 0xfe, 0x18, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x1c, 0x7f, 0xe1, 0xff, 0x06, 0x00,
-        0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x7f, 0xc3, 0xff, 0x1c, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x9f, 0xc6, 0xff, 0x1f, 0x00, 0x78, 0x01, 0xc0, 0x06, 0x00,
-        0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x01, 0xc0, 0x03,
-        0xfc, 0x07, 0xf8, 0x00, 0x70, 0x00, 0xc0, 0x03, 0x1c, 0x1c, 0x3f, 0xe0,
-        0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x60,
-        0x01, 0x80, 0x06, 0x00, 0xff, 0x03, 0xfc, 0x01, 0x80, 0x06, 0x00, 0x18,
-        0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x07,
-        0xe0, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c,
-        0x3f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x30,
-        0x60, 0xc1, 0x83, 0x06, 0x06, 0x30, 0x18, 0xc0, 0x63, 0x00, 0xd8, 0x03,
-        0x60, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x66, 0x01, 0x98, 0x06,
-        0x60, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31,
-        0x9c, 0xce, 0x3f, 0xf0, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xc6, 0x03, 0x1c,
-        0x1c, 0x38, 0xe0, 0x77, 0x00, 0xf8, 0x01, 0xc0, 0x0f, 0x80, 0x77, 0x03,
-        0x8e, 0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x03, 0x00, 0x0c, 0x00,
-        0x70, 0xff, 0x83, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc7,
-        0xff, 0x00, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00,
-        0x70, 0x03, 0x80, 0x1c, 0x00, 0x7f, 0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0xc0, 0x0f, 0x00, 0x70, 0x01, 0x80, 0x06, 0x00, 0x18,
-        0x00, 0x60, 0x01, 0x80, 0x1c, 0x00, 0x70, 0x00, 0x60, 0x01, 0x80, 0x06,
-        0x00, 0x18, 0x00, 0x60, 0x01, 0xc0, 0x03, 0xc0, 0x07, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x78, 0x00, 0x70, 0x00, 0xc0, 0x03,
-        0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x01, 0xc0, 0x07, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x01, 0xc0, 0x1e, 0x00, 0x70, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x03, 0xc3, 0x1f, 0x8c, 0x67, 0x31, 0x8f, 0xc6, 0x1e, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x7f, 0xf1,
-        0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x7f,
-        0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00
+        0x0f, 0xff, 0x3c, 0x00, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00,
+        0xc7, 0x8f, 0x1e, 0x3c, 0x78, 0xc0, 0x0f, 0xff, 0xfc, 0x00, 0x31, 0x86,
+        0x30, 0xc6, 0x18, 0xcf, 0xff, 0xff, 0xcc, 0x61, 0x8c, 0x31, 0x86, 0x30,
+        0xc6, 0x18, 0xcf, 0xff, 0xff, 0xcc, 0x61, 0x8c, 0x31, 0x86, 0x30, 0x3f,
+        0xff, 0xff, 0x00, 0x06, 0x00, 0x60, 0x06, 0x03, 0xfc, 0x7f, 0xee, 0x67,
+        0xc6, 0x3c, 0x60, 0xc6, 0x0e, 0x60, 0x7f, 0xc3, 0xfe, 0x06, 0x70, 0x63,
+        0x06, 0x3c, 0x63, 0xe6, 0x77, 0xfe, 0x3f, 0xc0, 0x60, 0x06, 0x00, 0x60,
+        0x0f, 0xff, 0xfc, 0x00, 0x78, 0x6f, 0xc6, 0xcc, 0xcf, 0xcc, 0x79, 0x80,
+        0x18, 0x03, 0x00, 0x30, 0x06, 0x00, 0x60, 0x0c, 0x00, 0xc0, 0x18, 0x01,
+        0x9e, 0x33, 0xf3, 0x33, 0x63, 0xf6, 0x1e, 0x0f, 0xff, 0xfc, 0x00, 0x1e,
+        0x03, 0xf0, 0x73, 0x86, 0x18, 0x61, 0x87, 0x38, 0x3f, 0x01, 0xe0, 0x1c,
+        0x03, 0xe3, 0x77, 0x7e, 0x3e, 0xc1, 0xcc, 0x1c, 0xc1, 0xce, 0x3e, 0x7f,
+        0x73, 0xe3, 0x3f, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x0f, 0xff, 0xfc, 0x00,
+        0x19, 0x98, 0xcc, 0x63, 0x18, 0xc6, 0x31, 0x8c, 0x61, 0x8c, 0x30, 0xc0,
+        0x0f, 0xff, 0xfc, 0x00, 0xc3, 0x0c, 0x61, 0x8c, 0x63, 0x18, 0xc6, 0x31,
+        0x8c, 0xc6, 0x66, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x71, 0xc7, 0x70, 0x7c,
+        0x07, 0x0f, 0xff, 0xff, 0xc3, 0x80, 0xf8, 0x3b, 0x8e, 0x38, 0x01, 0xff,
+        0xe0, 0x00, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0f, 0xff, 0xff,
+        0xf0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x00, 0x3f, 0x00,
+        0x33, 0x33, 0x6c, 0x00, 0x0c, 0x00, 0x00, 0xff, 0xff, 0xfc, 0x00, 0x00,
+        0x3c, 0x00, 0xff, 0x0f, 0xff, 0xfc, 0x00, 0x00, 0xc0, 0x30, 0x18, 0x06,
+        0x03, 0x00, 0xc0, 0x60, 0x18, 0x0c, 0x03, 0x01, 0x80, 0x60, 0x30, 0x0c,
+        0x06, 0x01, 0x80, 0xc0, 0x30, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f,
+        0xfb, 0x83, 0xe0, 0x3c, 0x0f, 0x83, 0xf0, 0xfe, 0x3b, 0xce, 0x7b, 0x8f,
+        0xe1, 0xf8, 0x3e, 0x07, 0x80, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f,
+        0xff, 0xfc, 0x00, 0x18, 0x38, 0x78, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18,
+        0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0x0f, 0xff, 0xfc,
+        0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0x80, 0xc0, 0x18, 0x07,
+        0x01, 0xc0, 0x70, 0x1c, 0x07, 0x01, 0xc0, 0x70, 0x1c, 0x07, 0x00, 0xff,
+        0xff, 0xfc, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x30,
+        0x06, 0x00, 0xc0, 0x18, 0x07, 0x1f, 0xc3, 0xf8, 0x03, 0x80, 0x30, 0x06,
+        0x00, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0x00,
+        0x60, 0x1c, 0x07, 0x81, 0xf0, 0x76, 0x1c, 0xc7, 0x19, 0xc3, 0x70, 0x7c,
+        0x0f, 0x01, 0xe0, 0x3f, 0xff, 0xff, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c,
+        0x0f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0x00, 0x60, 0x0c, 0x01, 0x80,
+        0x30, 0x07, 0xfc, 0xff, 0xc0, 0x1c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xf0,
+        0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0xcf, 0xfb,
+        0x80, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x07, 0xfc, 0xff, 0xd8, 0x1f, 0x01,
+        0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff,
+        0xfc, 0x00, 0xff, 0xff, 0xff, 0x01, 0xe0, 0x3c, 0x06, 0x01, 0x80, 0x30,
+        0x0c, 0x01, 0x80, 0x60, 0x0c, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30,
+        0x06, 0x00, 0xc0, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0,
+        0x3c, 0x07, 0x80, 0xf0, 0x1f, 0x07, 0x7f, 0xcf, 0xfb, 0x83, 0xe0, 0x3c,
+        0x07, 0x80, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00,
+        0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xe0,
+        0x6f, 0xfc, 0xff, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x07, 0x7f, 0xcf,
+        0xf0, 0x00, 0x78, 0x3c, 0x00, 0xff, 0xff, 0x00, 0x78, 0x3f, 0x00, 0x33,
+        0x33, 0x33, 0x33, 0x6c, 0x07, 0xff, 0xfc, 0x00, 0x00, 0xe0, 0x38, 0x0e,
+        0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x0e, 0x00, 0xe0, 0x0e,
+        0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x00, 0x61, 0x80, 0x00,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xfc, 0x00, 0xe0, 0x0e,
+        0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x38,
+        0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x00, 0x0f, 0xff,
+        0x3c, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0x80, 0xc0, 0x38,
+        0x0e, 0x03, 0x80, 0xe0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30,
+        0x0f, 0xff, 0xfc, 0x00, 0x3f, 0xc7, 0xfe, 0xe0, 0x7c, 0x03, 0xc3, 0xfc,
+        0x7f, 0xce, 0x3c, 0xc3, 0xcc, 0x3c, 0xc3, 0xcc, 0x3c, 0xe3, 0xc7, 0xfc,
+        0x3d, 0xc0, 0x0e, 0x00, 0x7f, 0xf3, 0xff, 0x0f, 0xff, 0xfc, 0x00, 0x3f,
+        0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x7f,
+        0xff, 0xff, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0c,
+        0x0f, 0xff, 0xfc, 0x00, 0xff, 0x9f, 0xfb, 0x03, 0xe0, 0x3c, 0x07, 0x80,
+        0xf0, 0x37, 0xfc, 0xff, 0x98, 0x1b, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0,
+        0x1e, 0x07, 0xff, 0xdf, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f, 0xfb,
+        0x83, 0xe0, 0x3c, 0x07, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00,
+        0x60, 0x0c, 0x01, 0x80, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff,
+        0xfc, 0x00, 0xfe, 0x1f, 0xf3, 0x07, 0x60, 0x6c, 0x07, 0x80, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x36, 0x0e,
+        0xff, 0x9f, 0xc0, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0x00, 0x60,
+        0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xff, 0x1f, 0xe3, 0x00, 0x60, 0x0c,
+        0x01, 0x80, 0x30, 0x06, 0x00, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xfc, 0x00,
+        0xff, 0xff, 0xff, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xff,
+        0x1f, 0xe3, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18,
+        0x00, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07,
+        0x80, 0x30, 0x06, 0x00, 0xc7, 0xf8, 0xff, 0x01, 0xe0, 0x3c, 0x07, 0x80,
+        0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x78,
+        0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xff, 0xff, 0xff,
+        0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0c, 0x0f,
+        0xff, 0xfc, 0x00, 0xff, 0xf3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c,
+        0x30, 0xc3, 0x0c, 0xff, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0x03, 0xf0, 0x3f,
+        0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c,
+        0x00, 0xc0, 0x0c, 0xc0, 0xcc, 0x0c, 0xc0, 0xce, 0x1c, 0x7f, 0x83, 0xf0,
+        0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x78, 0x1f, 0x07, 0x61, 0xcc, 0x71, 0x9c,
+        0x37, 0x07, 0xc0, 0xf0, 0x1e, 0x03, 0xe0, 0x6e, 0x0c, 0xe1, 0x8e, 0x30,
+        0xe6, 0x0e, 0xc0, 0xf8, 0x0c, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x18, 0x03,
+        0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00,
+        0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xff, 0xff, 0xfc, 0x0f, 0xff,
+        0xfc, 0x00, 0xc0, 0x3c, 0x03, 0xe0, 0x7f, 0x0f, 0xf9, 0xfd, 0xfb, 0xcf,
+        0x3c, 0x63, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0,
+        0x3c, 0x03, 0xc0, 0x3c, 0x03, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x78, 0x0f,
+        0x01, 0xe0, 0x3e, 0x07, 0xe0, 0xfe, 0x1e, 0xe3, 0xce, 0x78, 0xef, 0x0f,
+        0xe0, 0xfc, 0x0f, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0c, 0x0f, 0xff,
+        0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1f, 0x07,
+        0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0x9f, 0xfb, 0x03, 0xe0,
+        0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0xff, 0xfb, 0xfe, 0x60, 0x0c,
+        0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x00, 0x0f, 0xff, 0xff, 0x00,
+        0x3f, 0x87, 0xfc, 0xe0, 0xec, 0x06, 0xc0, 0x6c, 0x06, 0xc0, 0x6c, 0x06,
+        0xc0, 0x6c, 0x06, 0xc0, 0x6c, 0x06, 0xc0, 0x6c, 0x06, 0xc7, 0x6e, 0x3e,
+        0x7f, 0xc3, 0xfc, 0x00, 0xe0, 0x07, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0x9f,
+        0xfb, 0x03, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0xff, 0xfb,
+        0xfe, 0x7c, 0x0d, 0xc1, 0x9c, 0x31, 0xc6, 0x1c, 0xc1, 0xd8, 0x1c, 0x0f,
+        0xff, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x01, 0x80, 0x30,
+        0x07, 0x00, 0x7f, 0x87, 0xf8, 0x03, 0x80, 0x30, 0x06, 0x00, 0xf0, 0x1f,
+        0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0x06,
+        0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+        0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x0f,
+        0xff, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1f,
+        0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x01,
+        0xe0, 0x36, 0x0c, 0xc1, 0x98, 0x33, 0x06, 0x31, 0x86, 0x30, 0xc6, 0x18,
+        0xc1, 0xb0, 0x36, 0x06, 0xc0, 0x70, 0x0e, 0x01, 0xc0, 0x0f, 0xff, 0xfc,
+        0x00, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c,
+        0x03, 0xc0, 0x3c, 0x03, 0xc6, 0x3c, 0xf3, 0xdf, 0xbf, 0x9f, 0xf0, 0xfe,
+        0x07, 0xc0, 0x3c, 0x03, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x78, 0x0d, 0x83,
+        0x30, 0x63, 0x18, 0x63, 0x06, 0xc0, 0xd8, 0x0e, 0x01, 0xc0, 0x6c, 0x0d,
+        0x83, 0x18, 0x63, 0x18, 0x33, 0x06, 0xc0, 0x78, 0x0c, 0x0f, 0xff, 0xfc,
+        0x00, 0xc0, 0x3c, 0x03, 0x60, 0x66, 0x06, 0x30, 0xc3, 0x0c, 0x19, 0x81,
+        0x98, 0x0f, 0x00, 0xf0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+        0x60, 0x06, 0x00, 0x60, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xfc, 0x01,
+        0x80, 0x30, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38,
+        0x0e, 0x01, 0x80, 0x30, 0x06, 0x00, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xfc,
+        0x00, 0xff, 0xfc, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c,
+        0x30, 0xff, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x30, 0x06, 0x01, 0x80,
+        0x30, 0x0c, 0x01, 0x80, 0x60, 0x0c, 0x03, 0x00, 0x60, 0x18, 0x03, 0x00,
+        0xc0, 0x18, 0x06, 0x00, 0xc0, 0x30, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xf0,
+        0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0xff, 0xf0,
+        0x3f, 0x00, 0x00, 0x00, 0x04, 0x01, 0xc0, 0x7c, 0x1d, 0xc7, 0x1d, 0xc1,
+        0xc0, 0x00, 0x00, 0x01, 0x80, 0xff, 0xff, 0xfc, 0xf0, 0x00, 0x00, 0x00,
+        0xe1, 0xc3, 0x87, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0x87, 0xf8, 0x03, 0x80,
+        0x33, 0xfe, 0xff, 0xf8, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x81, 0xbf, 0xf3,
+        0xfe, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01,
+        0xff, 0x3f, 0xf6, 0x07, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80,
+        0xf0, 0x1e, 0x07, 0xff, 0xdf, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0x8f,
+        0xfb, 0x83, 0xe0, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03,
+        0x83, 0xbf, 0xe3, 0xf8, 0x0f, 0xff, 0xfc, 0x00, 0x00, 0x60, 0x0c, 0x01,
+        0x80, 0x30, 0x06, 0x7f, 0xdf, 0xff, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0,
+        0x3c, 0x07, 0x80, 0xf0, 0x1f, 0x03, 0x7f, 0xe7, 0xfc, 0x00, 0x7f, 0xfc,
+        0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0xff, 0xff, 0xfe, 0x00,
+        0xc0, 0x18, 0x03, 0x83, 0xbf, 0xe3, 0xf8, 0x0f, 0xff, 0xfc, 0x00, 0x0f,
+        0xc7, 0xf1, 0x80, 0x60, 0x18, 0x3f, 0xcf, 0xf0, 0x60, 0x18, 0x06, 0x01,
+        0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x00, 0x00, 0x7f,
+        0xff, 0xe0, 0x3f, 0xef, 0xff, 0x81, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x81, 0xbf, 0xf3, 0xfe, 0x00, 0xc0, 0x18, 0x07,
+        0x7f, 0xcf, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60,
+        0x0c, 0x01, 0xff, 0x3f, 0xf6, 0x07, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c,
+        0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0c, 0x0e, 0x7f, 0xfc, 0x00,
+        0x30, 0xc3, 0x3c, 0xf0, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xcf, 0xff,
+        0x0e, 0x7f, 0xff, 0xe0, 0x01, 0x80, 0xc0, 0x60, 0xf0, 0x78, 0x0c, 0x06,
+        0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0xc1, 0xe0,
+        0xf8, 0xef, 0xe3, 0xe0, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x30, 0x0c, 0x03,
+        0x00, 0xc0, 0x30, 0x7c, 0x3b, 0x1c, 0xce, 0x37, 0x0f, 0x83, 0xc0, 0xf8,
+        0x37, 0x0c, 0xe3, 0x1c, 0xc3, 0xb0, 0x70, 0x0f, 0xff, 0xfc, 0x00, 0xf3,
+        0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0xff,
+        0xf0, 0x00, 0x7f, 0xfc, 0x00, 0xff, 0xcf, 0xfe, 0xc6, 0x7c, 0x63, 0xc6,
+        0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6,
+        0x30, 0x00, 0x7f, 0xfc, 0x00, 0xff, 0x9f, 0xfb, 0x03, 0xe0, 0x3c, 0x07,
+        0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x06, 0x00,
+        0x7f, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0x80, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0x00, 0x7f, 0xff,
+        0xe0, 0xff, 0x9f, 0xfb, 0x03, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03,
+        0xc0, 0x78, 0x0f, 0x03, 0xff, 0xef, 0xf9, 0x80, 0x30, 0x06, 0x00, 0xc0,
+        0x18, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x3f, 0xef, 0xff, 0x81, 0xe0, 0x3c,
+        0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x81, 0xbf, 0xf3, 0xfe,
+        0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x7f, 0xfc, 0x00, 0xcf,
+        0xfb, 0xff, 0xe0, 0x78, 0x0e, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18,
+        0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0x8f, 0xfb,
+        0x83, 0xe0, 0x0e, 0x00, 0xff, 0x0f, 0xf0, 0x07, 0x00, 0x60, 0x0f, 0x83,
+        0xbf, 0xe3, 0xf8, 0x0f, 0xff, 0xfc, 0x00, 0x18, 0x0c, 0x06, 0x03, 0x01,
+        0x87, 0xfb, 0xfc, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60,
+        0x30, 0x1f, 0x87, 0xc0, 0x00, 0x7f, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x01,
+        0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x81, 0xbf,
+        0xf3, 0xfe, 0x00, 0x7f, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x01, 0xb0, 0x66,
+        0x0c, 0xc1, 0x8c, 0x61, 0x8c, 0x31, 0x83, 0x60, 0x6c, 0x07, 0x00, 0xe0,
+        0x00, 0x7f, 0xfc, 0x00, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc6, 0x3c,
+        0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xe6, 0x77, 0xfe, 0x3f, 0xc0,
+        0x00, 0x7f, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x83, 0xb8, 0xe3, 0xb8, 0x3e,
+        0x03, 0x80, 0xf8, 0x3b, 0x8e, 0x3b, 0x83, 0xe0, 0x3c, 0x06, 0x00, 0x7f,
+        0xff, 0xe0, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x81, 0xbf, 0xf3, 0xfe, 0x00, 0xc0, 0x18, 0x07,
+        0x7f, 0xcf, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0xff, 0xff, 0xfc, 0x03, 0x80,
+        0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0x7f, 0xff,
+        0xfe, 0x0f, 0xff, 0xfc, 0x00, 0x0e, 0x3c, 0xe1, 0x83, 0x06, 0x0c, 0x18,
+        0xe1, 0xc0, 0xc1, 0x83, 0x06, 0x0c, 0x1c, 0x1e, 0x1c, 0x0f, 0xff, 0xfc,
+        0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xe1, 0xe0,
+        0xe0, 0xc1, 0x83, 0x06, 0x0c, 0x0e, 0x1c, 0x60, 0xc1, 0x83, 0x06, 0x1c,
+        0xf1, 0xc0, 0x3e, 0x00, 0x00, 0x00, 0x78, 0x7f, 0x8f, 0x39, 0xe3, 0xfc,
+        0x3c, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0x01, 0xe0, 0x3c, 0x07,
+        0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80,
+        0xf0, 0x1e, 0x03, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xff,
+        0xff, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f,
+        0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xff, 0xff, 0xfc
       },
       (GFXglyph[]){
-        {     0,   9,  28,   9,    0,  -21 },   // 0x20 ' '
-        {    49,  14,  28,  14,    0,  -21 },   // 0x21 '!'
-        {    98,  14,  28,  14,    0,  -21 },   // 0x22 '"'
-        {   147,  14,  28,  14,    0,  -21 },   // 0x23 '#'
-        {   196,  14,  28,  14,    0,  -21 },   // 0x24 '$'
-        {   245,  14,  28,  14,    0,  -21 },   // 0x25 '%'
-        {   294,  14,  28,  14,    0,  -21 },   // 0x26 '&'
-        {   343,  14,  28,  14,    0,  -21 },   // 0x27 '''
-        {   392,  14,  28,  14,    0,  -21 },   // 0x28 '('
-        {   441,  14,  28,  14,    0,  -21 },   // 0x29 ')'
-        {   490,  14,  28,  14,    0,  -21 },   // 0x2A '*'
-        {   539,  14,  28,  14,    0,  -21 },   // 0x2B '+'
-        {   588,  14,  28,  14,    0,  -21 },   // 0x2C ','
-        {   637,  14,  28,  14,    0,  -21 },   // 0x2D '-'
-        {   686,  14,  28,  14,    0,  -21 },   // 0x2E '.'
-        {   735,  14,  28,  14,    0,  -21 },   // 0x2F '/'
-        {   784,  14,  28,  14,    0,  -21 },   // 0x30 '0'
-        {   833,  14,  28,  14,    0,  -21 },   // 0x31 '1'
-        {   882,  14,  28,  14,    0,  -21 },   // 0x32 '2'
-        {   931,  14,  28,  14,    0,  -21 },   // 0x33 '3'
-        {   980,  14,  28,  14,    0,  -21 },   // 0x34 '4'
-        {  1029,  14,  28,  14,    0,  -21 },   // 0x35 '5'
-        {  1078,  14,  28,  14,    0,  -21 },   // 0x36 '6'
-        {  1127,  14,  28,  14,    0,  -21 },   // 0x37 '7'
-        {  1176,  14,  28,  14,    0,  -21 },   // 0x38 '8'
-        {  1225,  14,  28,  14,    0,  -21 },   // 0x39 '9'
-        {  1274,  14,  28,  14,    0,  -21 },   // 0x3A ':'
-        {  1323,  14,  28,  14,    0,  -21 },   // 0x3B ';'
-        {  1372,  14,  28,  14,    0,  -21 },   // 0x3C '<'
-        {  1421,  14,  28,  14,    0,  -21 },   // 0x3D '='
-        {  1470,  14,  28,  14,    0,  -21 },   // 0x3E '>'
-        {  1519,  14,  28,  14,    0,  -21 },   // 0x3F '?'
-        {  1568,  14,  28,  14,    0,  -21 },   // 0x40 '@'
-        {  1617,  14,  28,  14,    0,  -21 },   // 0x41 'A'
-        {  1666,  14,  28,  14,    0,  -21 },   // 0x42 'B'
-        {  1715,  14,  28,  14,    0,  -21 },   // 0x43 'C'
-        {  1764,  14,  28,  14,    0,  -21 },   // 0x44 'D'
-        {  1813,  14,  28,  14,    0,  -21 },   // 0x45 'E'
-        {  1862,  14,  28,  14,    0,  -21 },   // 0x46 'F'
-        {  1911,  14,  28,  14,    0,  -21 },   // 0x47 'G'
-        {  1960,  14,  28,  14,    0,  -21 },   // 0x48 'H'
-        {  2009,  14,  28,  14,    0,  -21 },   // 0x49 'I'
-        {  2058,  14,  28,  14,    0,  -21 },   // 0x4A 'J'
-        {  2107,  14,  28,  14,    0,  -21 },   // 0x4B 'K'
-        {  2156,  14,  28,  14,    0,  -21 },   // 0x4C 'L'
-        {  2205,  14,  28,  14,    0,  -21 },   // 0x4D 'M'
-        {  2254,  14,  28,  14,    0,  -21 },   // 0x4E 'N'
-        {  2303,  14,  28,  14,    0,  -21 },   // 0x4F 'O'
-        {  2352,  14,  28,  14,    0,  -21 },   // 0x50 'P'
-        {  2401,  14,  28,  14,    0,  -21 },   // 0x51 'Q'
-        {  2450,  14,  28,  14,    0,  -21 },   // 0x52 'R'
-        {  2499,  14,  28,  14,    0,  -21 },   // 0x53 'S'
-        {  2548,  14,  28,  14,    0,  -21 },   // 0x54 'T'
-        {  2597,  14,  28,  14,    0,  -21 },   // 0x55 'U'
-        {  2646,  14,  28,  14,    0,  -21 },   // 0x56 'V'
-        {  2695,  14,  28,  14,    0,  -21 },   // 0x57 'W'
-        {  2744,  14,  28,  14,    0,  -21 },   // 0x58 'X'
-        {  2793,  14,  28,  14,    0,  -21 },   // 0x59 'Y'
-        {  2842,  14,  28,  14,    0,  -21 },   // 0x5A 'Z'
-        {  2891,  14,  28,  14,    0,  -21 },   // 0x5B '['
-        {  2940,  14,  28,  14,    0,  -21 },   // 0x5C '\'
-        {  2989,  14,  28,  14,    0,  -21 },   // 0x5D ']'
-        {  3038,  14,  28,  14,    0,  -21 },   // 0x5E '^'
-        {  3087,  14,  28,  14,    0,  -21 },   // 0x5F '_'
-        {  3136,  14,  28,  14,    0,  -21 },   // 0x60 '`'
-        {  3185,  14,  28,  14,    0,  -21 },   // 0x61 'a'
-        {  3234,  14,  28,  14,    0,  -21 },   // 0x62 'b'
-        {  3283,  14,  28,  14,    0,  -21 },   // 0x63 'c'
-        {  3332,  14,  28,  14,    0,  -21 },   // 0x64 'd'
-        {  3381,  14,  28,  14,    0,  -21 },   // 0x65 'e'
-        {  3430,  14,  28,  14,    0,  -21 },   // 0x66 'f'
-        {  3479,  14,  28,  14,    0,  -21 },   // 0x67 'g'
-        {  3528,  14,  28,  14,    0,  -21 },   // 0x68 'h'
-        {  3577,  14,  28,  14,    0,  -21 },   // 0x69 'i'
-        {  3626,  14,  28,  14,    0,  -21 },   // 0x6A 'j'
-        {  3675,  14,  28,  14,    0,  -21 },   // 0x6B 'k'
-        {  3724,  14,  28,  14,    0,  -21 },   // 0x6C 'l'
-        {  3773,  14,  28,  14,    0,  -21 },   // 0x6D 'm'
-        {  3822,  14,  28,  14,    0,  -21 },   // 0x6E 'n'
-        {  3871,  14,  28,  14,    0,  -21 },   // 0x6F 'o'
-        {  3920,  14,  28,  14,    0,  -21 },   // 0x70 'p'
-        {  3969,  14,  28,  14,    0,  -21 },   // 0x71 'q'
-        {  4018,  14,  28,  14,    0,  -21 },   // 0x72 'r'
-        {  4067,  14,  28,  14,    0,  -21 },   // 0x73 's'
-        {  4116,  14,  28,  14,    0,  -21 },   // 0x74 't'
-        {  4165,  14,  28,  14,    0,  -21 },   // 0x75 'u'
-        {  4214,  14,  28,  14,    0,  -21 },   // 0x76 'v'
-        {  4263,  14,  28,  14,    0,  -21 },   // 0x77 'w'
-        {  4312,  14,  28,  14,    0,  -21 },   // 0x78 'x'
-        {  4361,  14,  28,  14,    0,  -21 },   // 0x79 'y'
-        {  4410,  14,  28,  14,    0,  -21 },   // 0x7A 'z'
-        {  4459,  14,  28,  14,    0,  -21 },   // 0x7B '{'
-        {  4508,  14,  28,  14,    0,  -21 },   // 0x7C '|'
-        {  4557,  14,  28,  14,    0,  -21 },   // 0x7D '}'
-        {  4606,  14,  28,  14,    0,  -21 },   // 0x7E '~'
-        {  4655,  14,  28,  14,    0,  -21 },   // 0x7F
-        {  4704,  14,  28,  14,    0,  -21 },   // 0x80
+        {     0,   0,  28,   9,    0,  -21 },   // 0x20 ' '
+        {     0,   2,  28,  14,    6,  -21 },   // 0x21 '!'
+        {     8,   7,  28,  14,    3,  -21 },   // 0x22 '"'
+        {    18,  11,  28,  14,    1,  -21 },   // 0x23 '#'
+        {    47,  12,  28,  14,    1,  -21 },   // 0x24 '$'
+        {    84,  12,  28,  14,    1,  -21 },   // 0x25 '%'
+        {   115,  12,  28,  14,    1,  -21 },   // 0x26 '&'
+        {   146,   2,  28,  14,    6,  -21 },   // 0x27 '''
+        {   152,   5,  28,  14,    4,  -21 },   // 0x28 '('
+        {   168,   5,  28,  14,    4,  -21 },   // 0x29 ')'
+        {   184,  11,  28,  14,    1,  -21 },   // 0x2A '*'
+        {   202,  12,  28,  14,    1,  -21 },   // 0x2B '+'
+        {   224,   4,  28,  14,    4,  -21 },   // 0x2C ','
+        {   231,  11,  28,  14,    1,  -21 },   // 0x2D '-'
+        {   238,   2,  28,  14,    6,  -21 },   // 0x2E '.'
+        {   243,  10,  28,  14,    2,  -21 },   // 0x2F '/'
+        {   270,  11,  28,  14,    1,  -21 },   // 0x30 '0'
+        {   299,   8,  28,  14,    3,  -21 },   // 0x31 '1'
+        {   321,  11,  28,  14,    1,  -21 },   // 0x32 '2'
+        {   350,  11,  28,  14,    1,  -21 },   // 0x33 '3'
+        {   379,  11,  28,  14,    1,  -21 },   // 0x34 '4'
+        {   408,  11,  28,  14,    1,  -21 },   // 0x35 '5'
+        {   437,  11,  28,  14,    1,  -21 },   // 0x36 '6'
+        {   466,  11,  28,  14,    1,  -21 },   // 0x37 '7'
+        {   495,  11,  28,  14,    1,  -21 },   // 0x38 '8'
+        {   524,  11,  28,  14,    1,  -21 },   // 0x39 '9'
+        {   553,   2,  28,  14,    6,  -21 },   // 0x3A ':'
+        {   559,   4,  28,  14,    4,  -21 },   // 0x3B ';'
+        {   568,  11,  28,  14,    1,  -21 },   // 0x3C '<'
+        {   596,  11,  28,  14,    1,  -21 },   // 0x3D '='
+        {   606,  11,  28,  14,    1,  -21 },   // 0x3E '>'
+        {   634,  11,  28,  14,    1,  -21 },   // 0x3F '?'
+        {   660,  12,  28,  14,    1,  -21 },   // 0x40 '@'
+        {   691,  11,  28,  14,    1,  -21 },   // 0x41 'A'
+        {   720,  11,  28,  14,    1,  -21 },   // 0x42 'B'
+        {   749,  11,  28,  14,    1,  -21 },   // 0x43 'C'
+        {   778,  11,  28,  14,    1,  -21 },   // 0x44 'D'
+        {   807,  11,  28,  14,    1,  -21 },   // 0x45 'E'
+        {   836,  11,  28,  14,    1,  -21 },   // 0x46 'F'
+        {   865,  11,  28,  14,    1,  -21 },   // 0x47 'G'
+        {   894,  11,  28,  14,    1,  -21 },   // 0x48 'H'
+        {   923,   6,  28,  14,    4,  -21 },   // 0x49 'I'
+        {   941,  12,  28,  14,    1,  -21 },   // 0x4A 'J'
+        {   972,  11,  28,  14,    1,  -21 },   // 0x4B 'K'
+        {  1001,  11,  28,  14,    1,  -21 },   // 0x4C 'L'
+        {  1030,  12,  28,  14,    1,  -21 },   // 0x4D 'M'
+        {  1061,  11,  28,  14,    1,  -21 },   // 0x4E 'N'
+        {  1090,  11,  28,  14,    1,  -21 },   // 0x4F 'O'
+        {  1119,  11,  28,  14,    1,  -21 },   // 0x50 'P'
+        {  1148,  12,  28,  14,    1,  -21 },   // 0x51 'Q'
+        {  1182,  11,  28,  14,    1,  -21 },   // 0x52 'R'
+        {  1211,  11,  28,  14,    1,  -21 },   // 0x53 'S'
+        {  1240,  12,  28,  14,    1,  -21 },   // 0x54 'T'
+        {  1271,  11,  28,  14,    1,  -21 },   // 0x55 'U'
+        {  1300,  11,  28,  14,    1,  -21 },   // 0x56 'V'
+        {  1329,  12,  28,  14,    1,  -21 },   // 0x57 'W'
+        {  1360,  11,  28,  14,    1,  -21 },   // 0x58 'X'
+        {  1389,  12,  28,  14,    1,  -21 },   // 0x59 'Y'
+        {  1420,  11,  28,  14,    1,  -21 },   // 0x5A 'Z'
+        {  1449,   6,  28,  14,    4,  -21 },   // 0x5B '['
+        {  1467,  10,  28,  14,    2,  -21 },   // 0x5C '\'
+        {  1494,   6,  28,  14,    4,  -21 },   // 0x5D ']'
+        {  1512,  11,  28,  14,    1,  -21 },   // 0x5E '^'
+        {  1525,  11,  28,  14,    1,  -21 },   // 0x5F '_'
+        {  1532,   6,  28,  14,    2,  -21 },   // 0x60 '`'
+        {  1539,  11,  28,  14,    1,  -21 },   // 0x61 'a'
+        {  1561,  11,  28,  14,    1,  -21 },   // 0x62 'b'
+        {  1590,  11,  28,  14,    1,  -21 },   // 0x63 'c'
+        {  1612,  11,  28,  14,    1,  -21 },   // 0x64 'd'
+        {  1641,  11,  28,  14,    1,  -21 },   // 0x65 'e'
+        {  1663,  10,  28,  14,    2,  -21 },   // 0x66 'f'
+        {  1690,  11,  28,  14,    1,  -21 },   // 0x67 'g'
+        {  1719,  11,  28,  14,    1,  -21 },   // 0x68 'h'
+        {  1748,   6,  28,  14,    4,  -21 },   // 0x69 'i'
+        {  1764,   9,  28,  14,    2,  -21 },   // 0x6A 'j'
+        {  1792,  10,  28,  14,    2,  -21 },   // 0x6B 'k'
+        {  1819,   6,  28,  14,    4,  -21 },   // 0x6C 'l'
+        {  1837,  12,  28,  14,    1,  -21 },   // 0x6D 'm'
+        {  1861,  11,  28,  14,    1,  -21 },   // 0x6E 'n'
+        {  1883,  11,  28,  14,    1,  -21 },   // 0x6F 'o'
+        {  1905,  11,  28,  14,    1,  -21 },   // 0x70 'p'
+        {  1934,  11,  28,  14,    1,  -21 },   // 0x71 'q'
+        {  1963,  11,  28,  14,    1,  -21 },   // 0x72 'r'
+        {  1985,  11,  28,  14,    1,  -21 },   // 0x73 's'
+        {  2007,   9,  28,  14,    2,  -21 },   // 0x74 't'
+        {  2032,  11,  28,  14,    1,  -21 },   // 0x75 'u'
+        {  2054,  11,  28,  14,    1,  -21 },   // 0x76 'v'
+        {  2076,  12,  28,  14,    1,  -21 },   // 0x77 'w'
+        {  2100,  11,  28,  14,    1,  -21 },   // 0x78 'x'
+        {  2122,  11,  28,  14,    1,  -21 },   // 0x79 'y'
+        {  2151,  11,  28,  14,    1,  -21 },   // 0x7A 'z'
+        {  2173,   7,  28,  14,    3,  -21 },   // 0x7B '{'
+        {  2193,   2,  28,  14,    6,  -21 },   // 0x7C '|'
+        {  2202,   7,  28,  14,    3,  -21 },   // 0x7D '}'
+        {  2222,  11,  28,  14,    1,  -21 },   // 0x7E '~'
+        {  2233,  11,  28,  14,    1,  -21 },   // 0x7F
+        {  2262,  11,  28,  14,    1,  -21 },   // 0x80
       },  0x20, 0x80, 0
 
-    }, 0x0, 0x20, 0x80
+    }, 0x0, 0x20, 0x80, true
   },
-  // Approx. 5439 bytes
+  // Approx. 2977 bytes
 
   {
     {
       (uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x3f, 0x01, 0xfe, 0x0c, 0xcc, 0x33,
-        0x00, 0xcc, 0x03, 0x30, 0x0c, 0xc0, 0x33, 0x00, 0xcc, 0x03, 0x30, 0x0c,
-        0xcc, 0x1f, 0xe0, 0x3f, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80,
-        0x3f, 0x01, 0xc6, 0x06, 0x18, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00,
-        0x3f, 0x80, 0xfe, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x83,
-        0x06, 0x0c, 0x3f, 0xf0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x18, 0x06, 0x70, 0x38, 0xff, 0xc1, 0xfe, 0x0e,
-        0x1c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0e, 0x1c, 0x1f, 0xe0, 0xff, 0xc7,
-        0x03, 0x98, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x60, 0x19, 0x80, 0x63, 0x03, 0x0c, 0x0c, 0x18, 0x60, 0x61, 0x80, 0xcc,
-        0x03, 0x30, 0x07, 0x80, 0x0c, 0x03, 0xff, 0x0f, 0xfc, 0x03, 0x00, 0x0c,
-        0x03, 0xff, 0x0f, 0xfc, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0xe0, 0x0f, 0xc0, 0x73, 0x81, 0x80, 0x07, 0x00, 0x0f, 0x00, 0x3e,
-        0x01, 0x9c, 0x06, 0x38, 0x18, 0x60, 0x61, 0x81, 0xc6, 0x03, 0x98, 0x07,
-        0xc0, 0x0f, 0x00, 0x0e, 0x00, 0x18, 0x1c, 0xe0, 0x3f, 0x00, 0x78, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x63, 0x01,
-        0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x7f,
-        0xf3, 0x80, 0xec, 0xf9, 0xb7, 0xf6, 0xd8, 0xdb, 0x60, 0x6d, 0x81, 0xb6,
-        0x36, 0xdf, 0xdb, 0x3e, 0x6e, 0x03, 0x9f, 0xfc, 0x3f, 0xe0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0x01, 0xfe, 0x00, 0x1c, 0x0f, 0xf0, 0x7f, 0xc3, 0x83, 0x0c, 0x0c,
-        0x38, 0x30, 0x7f, 0xc0, 0xff, 0x00, 0x00, 0x3f, 0xf0, 0xff, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x0e, 0x70, 0x73, 0x83, 0x9c, 0x1c, 0xe0, 0xe7, 0x07,
-        0x38, 0x39, 0xc0, 0x73, 0x80, 0xe7, 0x01, 0xce, 0x03, 0x9c, 0x07, 0x38,
-        0x0e, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0x1f, 0xfc, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0,
-        0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x0f, 0xf8, 0x7f, 0xf3, 0x80, 0xed, 0xf9, 0xb7, 0xf6, 0xd8,
-        0xdb, 0x63, 0x6d, 0xf9, 0xb7, 0xc6, 0xd9, 0x9b, 0x63, 0x6e, 0x03, 0x9f,
-        0xfc, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x1f, 0xc0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x07, 0xf0, 0x18,
-        0xc0, 0x63, 0x01, 0x8c, 0x07, 0xf0, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x1f, 0xfe, 0x7f, 0xf8, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x07,
-        0xf0, 0x18, 0xc0, 0x03, 0x00, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01,
-        0xfc, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8,
-        0x07, 0xf0, 0x00, 0xc0, 0x03, 0x00, 0x78, 0x01, 0xf0, 0x00, 0xc0, 0x03,
-        0x01, 0xfc, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x0e, 0x00,
-        0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x81, 0xc6, 0x0f, 0x18, 0x7c, 0x7f, 0xb1, 0xfc, 0xc6,
-        0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf9, 0xff, 0xe6, 0x31, 0x98, 0xc6,
-        0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0xfc, 0x63, 0xf1,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x30, 0x01, 0x80, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x01, 0xc0, 0x0f, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0xfc, 0x03, 0xf0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0xfe, 0x0e, 0x1c, 0x30, 0x30, 0xc0,
-        0xc3, 0x03, 0x0c, 0x0c, 0x38, 0x70, 0x7f, 0x80, 0xfc, 0x00, 0x00, 0x3f,
-        0xf0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9c, 0x07, 0x38, 0x0e, 0x70,
-        0x1c, 0xe0, 0x39, 0xc0, 0x73, 0x80, 0xe7, 0x07, 0x38, 0x39, 0xc1, 0xce,
-        0x0e, 0x70, 0x73, 0x83, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-        0x00, 0xe0, 0x07, 0x80, 0x06, 0x06, 0x18, 0x38, 0x61, 0xc1, 0x8e, 0x06,
-        0x70, 0x03, 0x80, 0x1c, 0xc0, 0xe7, 0x07, 0x3c, 0x39, 0xb1, 0xcc, 0xc6,
-        0x7f, 0x01, 0xfc, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x18, 0x00, 0xe0, 0x07, 0x81, 0x86, 0x0e, 0x18, 0x70, 0x63, 0x81, 0x9c,
-        0x06, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xdf, 0x0e, 0xfe, 0x73, 0x19, 0x80,
-        0xc0, 0x06, 0x00, 0x30, 0x01, 0xf8, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x3e, 0x01, 0xfc, 0x00, 0x30, 0x07, 0x80, 0x1f, 0x18, 0x0c, 0xe7,
-        0xf7, 0x0f, 0xb8, 0x01, 0xc0, 0x0e, 0x60, 0x73, 0x83, 0x9e, 0x1c, 0xd8,
-        0xe6, 0x67, 0x3f, 0x98, 0xfe, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00,
-        0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0c, 0x00, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00,
-        0x70, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0xff, 0xc7, 0xff, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x0e,
-        0x00, 0x70, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0xff, 0xc7, 0xff, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-        0x3e, 0x01, 0xdc, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0xff, 0xc7, 0xff,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
-        0x60, 0xff, 0x83, 0x3c, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0xff, 0xc7,
-        0xff, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x18, 0xc0, 0x63, 0x01, 0x8c, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0xff,
-        0xc7, 0xff, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x07, 0x80, 0x33, 0x00, 0xcc, 0x01, 0xe0, 0x1f, 0xc0, 0xff, 0x87,
-        0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0xff, 0xc7, 0xff, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf9, 0xff,
-        0xee, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xff,
-        0xf3, 0xff, 0xcc, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30,
-        0xc0, 0xc3, 0xfb, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0,
-        0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0x06, 0x00, 0x18, 0x00,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0xc6, 0x03,
-        0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x30,
-        0x01, 0x80, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x7f,
-        0xf1, 0xff, 0xc6, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
-        0x00, 0x7f, 0x81, 0xfe, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06,
-        0x00, 0x18, 0x00, 0x7f, 0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x00, 0x00,
-        0x7f, 0xf1, 0xff, 0xc6, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00,
-        0x18, 0x00, 0x7f, 0x81, 0xfe, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-        0x06, 0x00, 0x18, 0x00, 0x7f, 0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x3e, 0x01, 0xdc, 0x00,
-        0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06,
-        0x00, 0x18, 0x00, 0x7f, 0x81, 0xfe, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01,
-        0x80, 0x06, 0x00, 0x18, 0x00, 0x7f, 0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x63, 0x01, 0x8c,
-        0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-        0x06, 0x00, 0x18, 0x00, 0x7f, 0x81, 0xfe, 0x06, 0x00, 0x18, 0x00, 0x60,
-        0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f, 0xf1, 0xff, 0xc0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1c, 0x00,
-        0x38, 0x00, 0x00, 0x0f, 0xc0, 0x3f, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x0e,
-        0x00, 0x70, 0x00, 0x00, 0x0f, 0xc0, 0x3f, 0x00, 0x30, 0x00, 0xc0, 0x03,
-        0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-        0x3e, 0x01, 0xdc, 0x00, 0x00, 0x0f, 0xc0, 0x3f, 0x00, 0x30, 0x00, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
-        0xc0, 0x63, 0x01, 0x8c, 0x00, 0x00, 0x0f, 0xc0, 0x3f, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0,
-        0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x01, 0xff, 0x06, 0x0e,
-        0x18, 0x18, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0xfe, 0x33, 0xf8,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x06, 0x18, 0x38, 0x7f,
-        0xc1, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1e, 0x60, 0xff, 0x83, 0x3c, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x70, 0x31, 0xe0, 0xc7, 0xc3, 0x1b, 0x8c, 0x67, 0x31,
-        0x8e, 0xc6, 0x1f, 0x18, 0x3c, 0x60, 0x71, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x1f, 0xc0, 0xff,
-        0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c,
-        0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x00, 0x00, 0x1f, 0xc0,
-        0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x3e, 0x01, 0xdc, 0x00, 0x00, 0x1f,
-        0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x60, 0xff, 0x83, 0x3c, 0x00, 0x00,
-        0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x63, 0x01, 0x8c, 0x00,
-        0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x31, 0xc1,
-        0xc3, 0x8e, 0x07, 0x70, 0x0f, 0x80, 0x1c, 0x00, 0xf8, 0x07, 0x70, 0x38,
-        0xe1, 0xc1, 0xc6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0e, 0x60, 0x79,
-        0x83, 0xc6, 0x1f, 0x18, 0xec, 0x67, 0x31, 0xb8, 0xc7, 0xc3, 0x1e, 0x0c,
-        0x70, 0x33, 0x80, 0xce, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38,
-        0x00, 0x70, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0,
-        0x0e, 0x00, 0x70, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-        0x00, 0x3e, 0x01, 0xdc, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0,
-        0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x18, 0xc0, 0x63, 0x01, 0x8c, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f,
-        0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x00, 0x00, 0x60, 0x19, 0x80, 0x63,
-        0x03, 0x0c, 0x0c, 0x18, 0x60, 0x61, 0x80, 0xcc, 0x03, 0x30, 0x07, 0x80,
-        0x1e, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80,
-        0x06, 0x00, 0x1f, 0xf0, 0x7f, 0xe1, 0x81, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x1c, 0x7f, 0xe1, 0xff, 0x06, 0x00, 0x18,
-        0x00, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x81,
-        0xff, 0x06, 0x0e, 0x18, 0x18, 0x60, 0x61, 0x81, 0x86, 0x0c, 0x1f, 0xf0,
-        0x7f, 0xe1, 0x81, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc7, 0x03,
-        0x1e, 0x1c, 0x6f, 0xe1, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0x00, 0x7f, 0x01, 0xfe, 0x00,
-        0x1c, 0x00, 0x30, 0x7f, 0xc3, 0xff, 0x1c, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x00, 0x00, 0x7f, 0x01, 0xfe,
-        0x00, 0x1c, 0x00, 0x30, 0x7f, 0xc3, 0xff, 0x1c, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x1c, 0x00, 0xf8, 0x07, 0x70, 0x00, 0x00, 0x7f, 0x01,
-        0xfe, 0x00, 0x1c, 0x00, 0x30, 0x7f, 0xc3, 0xff, 0x1c, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x79, 0x83, 0xfe, 0x0c, 0xf0, 0x00, 0x00, 0x7f,
-        0x01, 0xfe, 0x00, 0x1c, 0x00, 0x30, 0x7f, 0xc3, 0xff, 0x1c, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x01, 0x8c, 0x06, 0x30, 0x00, 0x00,
-        0x7f, 0x01, 0xfe, 0x00, 0x1c, 0x00, 0x30, 0x7f, 0xc3, 0xff, 0x1c, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0xcc, 0x03, 0x30, 0x07,
-        0x80, 0x7f, 0x01, 0xfe, 0x00, 0x1c, 0x00, 0x30, 0x7f, 0xc3, 0xff, 0x1c,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0xf7, 0x87, 0xff, 0x01, 0xce, 0x03, 0x18, 0xfc, 0x67, 0xff,
-        0xb8, 0xfe, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x38, 0xe6, 0x7f, 0xf8, 0xfb,
-        0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x01, 0x80, 0x06,
-        0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1c, 0x1c, 0x3f, 0xe0,
-        0x7f, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x30, 0x01, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0,
-        0x01, 0xc0, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31, 0x80,
-        0xc7, 0xff, 0x1f, 0xfc, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1c, 0x1c, 0x3f,
-        0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00,
-        0x38, 0x01, 0xc0, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31,
-        0x80, 0xc7, 0xff, 0x1f, 0xfc, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1c, 0x1c,
-        0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
-        0x00, 0xf8, 0x07, 0x70, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60,
-        0x31, 0x80, 0xc7, 0xff, 0x1f, 0xfc, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1c,
-        0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x63, 0x01, 0x8c, 0x06, 0x30, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c,
-        0x60, 0x31, 0x80, 0xc7, 0xff, 0x1f, 0xfc, 0x60, 0x01, 0x80, 0x06, 0x00,
-        0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0x00, 0x3c, 0x00, 0xf0, 0x00,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x00, 0x00, 0x3c, 0x00, 0xf0,
-        0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c,
-        0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x1c, 0x00, 0xf8, 0x07, 0x70, 0x00, 0x00, 0x3c, 0x00,
-        0xf0, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x63, 0x01, 0x8c, 0x06, 0x30, 0x00, 0x00, 0x3c,
-        0x00, 0xf0, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03,
-        0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x39, 0x80, 0x7c, 0x01, 0xe0, 0x0d, 0xc0, 0x03, 0x80,
-        0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x87, 0xfe, 0x18, 0xf0, 0x00,
-        0x01, 0xff, 0x07, 0xfe, 0x18, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
-        0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x01,
-        0xc0, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0,
-        0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0xf8,
-        0x07, 0x70, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f,
-        0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x83,
-        0xfe, 0x0c, 0xf0, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x1c,
-        0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63,
-        0x01, 0x8c, 0x06, 0x30, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c,
-        0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xf9, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x63, 0xff, 0x98,
-        0x1c, 0x60, 0xf1, 0x87, 0xc6, 0x3b, 0x19, 0xcc, 0x6e, 0x31, 0xf0, 0xc7,
-        0x83, 0x1c, 0x0c, 0xff, 0xe3, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0x01, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x00, 0x01, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0xf8, 0x07, 0x70, 0x00, 0x01, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x01, 0x8c, 0x06, 0x30, 0x00, 0x01,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x00,
-        0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x70, 0xff, 0x83, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00,
-        0x60, 0x01, 0xff, 0x07, 0xfe, 0x18, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x1c, 0x7f, 0xe1, 0xff,
-        0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x01, 0x8c, 0x06,
-        0x30, 0x00, 0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0,
-        0x7f, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x70, 0xff, 0x83, 0xfc, 0x00, 0x00
+        0x0f, 0x3f, 0xfc, 0x00, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0x00,
+        0x0c, 0x03, 0x03, 0xf1, 0xfe, 0xcc, 0xf3, 0x0c, 0xc3, 0x30, 0xcc, 0x33,
+        0x0c, 0xc3, 0x30, 0xcc, 0xdf, 0xe3, 0xf0, 0x30, 0x0c, 0x00, 0x0f, 0xff,
+        0xfc, 0x00, 0x1e, 0x0f, 0xc7, 0x19, 0x86, 0x60, 0x18, 0x06, 0x01, 0x80,
+        0xfe, 0x3f, 0x86, 0x01, 0x80, 0x60, 0x18, 0x06, 0x0d, 0x83, 0xff, 0xff,
+        0xf0, 0x01, 0xff, 0xf0, 0x00, 0xc0, 0x3e, 0x07, 0x7f, 0xe3, 0xfc, 0x70,
+        0xe6, 0x06, 0x60, 0x66, 0x06, 0x70, 0xe3, 0xfc, 0x7f, 0xee, 0x07, 0xc0,
+        0x30, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x3c, 0x03, 0x60, 0x66, 0x06, 0x30,
+        0xc3, 0x0c, 0x19, 0x81, 0x98, 0x0f, 0x00, 0x60, 0x7f, 0xe7, 0xfe, 0x06,
+        0x00, 0x60, 0x7f, 0xe7, 0xfe, 0x06, 0x00, 0x60, 0x0f, 0xe1, 0xfc, 0x00,
+        0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xfe, 0x00, 0x3c, 0x7e, 0xe7, 0xc0,
+        0xe0, 0x78, 0x7c, 0xce, 0xc7, 0xc3, 0xc3, 0xe3, 0x73, 0x3e, 0x1e, 0x07,
+        0x03, 0xe7, 0x7e, 0x3c, 0xe0, 0x00, 0x00, 0x00, 0xc7, 0x8f, 0x18, 0x01,
+        0xff, 0xf8, 0x00, 0x3f, 0xe3, 0xff, 0xb8, 0x0f, 0x9f, 0x3d, 0xfd, 0xec,
+        0x6f, 0x60, 0x7b, 0x03, 0xd8, 0xde, 0xfe, 0xf3, 0xe7, 0xc0, 0x77, 0xff,
+        0x1f, 0xf0, 0x7f, 0xec, 0x00, 0x00, 0x7f, 0x1f, 0xe0, 0x1c, 0xff, 0x7f,
+        0xf8, 0x3c, 0x0f, 0x83, 0x7f, 0xcf, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xfc,
+        0x00, 0x03, 0x9c, 0x1c, 0xe0, 0xe7, 0x07, 0x38, 0x39, 0xc1, 0xce, 0x0e,
+        0x70, 0x1c, 0xe0, 0x39, 0xc0, 0x73, 0x80, 0xe7, 0x01, 0xce, 0x03, 0x9c,
+        0x00, 0x3f, 0x80, 0x00, 0xff, 0xff, 0xfc, 0x01, 0x80, 0x30, 0x06, 0x00,
+        0xc0, 0x18, 0x00, 0x0c, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xf8,
+        0x00, 0x3f, 0xe3, 0xff, 0xb8, 0x0f, 0xbf, 0x3d, 0xfd, 0xec, 0x6f, 0x63,
+        0x7b, 0xf3, 0xdf, 0x1e, 0xcc, 0xf6, 0x37, 0xc0, 0x77, 0xff, 0x1f, 0xf0,
+        0xc0, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x3f, 0x80, 0x00, 0x00, 0x7d, 0xff,
+        0x1e, 0x3c, 0x7f, 0xdf, 0x00, 0x03, 0xff, 0xcc, 0x00, 0x06, 0x00, 0x60,
+        0x06, 0x00, 0x60, 0x06, 0x0f, 0xff, 0xff, 0xf0, 0x60, 0x06, 0x00, 0x60,
+        0x06, 0x00, 0x60, 0xff, 0xff, 0xff, 0x3f, 0xf0, 0x00, 0x00, 0x7d, 0xff,
+        0x18, 0x30, 0xe3, 0x8e, 0x38, 0xff, 0xfc, 0x3f, 0xf0, 0x00, 0x00, 0x7d,
+        0xfc, 0x18, 0x33, 0xc7, 0xc1, 0x83, 0xfe, 0xf8, 0xe0, 0x00, 0x00, 0x00,
+        0x3b, 0xb8, 0x00, 0x7f, 0xff, 0xe0, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c,
+        0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0xf8, 0x3f, 0x0f, 0xff, 0xbf, 0xe7,
+        0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x7f,
+        0xff, 0xff, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6,
+        0x3f, 0xe3, 0x7e, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06,
+        0x30, 0x63, 0x00, 0x0f, 0x00, 0x00, 0xff, 0x00, 0x00, 0x03, 0xe0, 0x33,
+        0x36, 0xc0, 0x3f, 0xf0, 0x00, 0x00, 0x31, 0xcf, 0x0c, 0x30, 0xc3, 0x0c,
+        0xff, 0xf0, 0x7f, 0xec, 0x00, 0x00, 0x3f, 0x1f, 0xee, 0x1f, 0x03, 0xc0,
+        0xf0, 0x3c, 0x0f, 0x87, 0x7f, 0x8f, 0xcf, 0xff, 0xff, 0x00, 0x7f, 0xfc,
+        0x00, 0xe7, 0x01, 0xce, 0x03, 0x9c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0,
+        0x39, 0xc1, 0xce, 0x0e, 0x70, 0x73, 0x83, 0x9c, 0x1c, 0xe0, 0xe7, 0x00,
+        0x0f, 0xff, 0xfc, 0x00, 0x30, 0x07, 0x00, 0xf0, 0x03, 0x03, 0x30, 0x73,
+        0x0e, 0x31, 0xc3, 0x38, 0x07, 0x00, 0xe6, 0x1c, 0xe3, 0x9e, 0x73, 0x6e,
+        0x66, 0xcf, 0xe0, 0xfe, 0x00, 0x60, 0x06, 0x0f, 0xff, 0xfc, 0x00, 0x30,
+        0x07, 0x00, 0xf0, 0x33, 0x07, 0x30, 0xe3, 0x1c, 0x33, 0x83, 0x70, 0x0e,
+        0x01, 0xc0, 0x3b, 0xe7, 0x7f, 0xe6, 0x3c, 0x06, 0x00, 0xc0, 0x18, 0x03,
+        0xf0, 0x7f, 0x0f, 0xff, 0xfc, 0x00, 0x7c, 0x0f, 0xe0, 0x06, 0x03, 0xc0,
+        0x3e, 0x30, 0x67, 0xfe, 0xe7, 0xdc, 0x03, 0x80, 0x73, 0x0e, 0x71, 0xcf,
+        0x39, 0xb7, 0x33, 0xe7, 0xfc, 0x7f, 0x00, 0x30, 0x03, 0x0f, 0x3f, 0xfc,
+        0x00, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0xc0,
+        0x30, 0x0c, 0x03, 0x01, 0xe0, 0x3c, 0x07, 0xc1, 0xdf, 0xf1, 0xfc, 0xef,
+        0xff, 0xfc, 0x00, 0x38, 0x03, 0x80, 0x38, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3f, 0xff, 0xff, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x06, 0xef, 0xff, 0xfc, 0x00,
+        0x03, 0x80, 0xe0, 0x38, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xc0,
+        0x78, 0x0f, 0x01, 0xe0, 0x3f, 0xff, 0xff, 0xf0, 0x1e, 0x03, 0xc0, 0x78,
+        0x0f, 0x01, 0xe0, 0x3c, 0x06, 0xef, 0xff, 0xfc, 0x00, 0x0e, 0x03, 0xe0,
+        0xee, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01,
+        0xe0, 0x3f, 0xff, 0xff, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0,
+        0x3c, 0x06, 0xef, 0xff, 0xfc, 0x00, 0x3c, 0xcf, 0xf9, 0x9e, 0x1f, 0xc7,
+        0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3f, 0xff,
+        0xff, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x06, 0xef,
+        0xff, 0xfc, 0x00, 0x31, 0x86, 0x30, 0xc6, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3f, 0xff, 0xff, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x06, 0xff, 0xff, 0xfc, 0x00,
+        0x0f, 0x03, 0x30, 0x66, 0x07, 0x83, 0xf8, 0xff, 0xb8, 0x3e, 0x03, 0xc0,
+        0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xff, 0xff, 0xfe, 0x03, 0xc0, 0x78,
+        0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xc0, 0x0f, 0xff, 0xfc, 0x00, 0x3f,
+        0xfb, 0xff, 0xf8, 0xc1, 0x86, 0x0c, 0x30, 0x61, 0x83, 0x0c, 0x18, 0x60,
+        0xff, 0xf7, 0xff, 0xb0, 0xc1, 0x86, 0x0c, 0x30, 0x61, 0x83, 0x0c, 0x18,
+        0x60, 0xc3, 0xfe, 0x1f, 0xc0, 0x0f, 0xff, 0xff, 0xe0, 0x3f, 0x8f, 0xfb,
+        0x83, 0xe0, 0x3c, 0x07, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00,
+        0x60, 0x0c, 0x01, 0x80, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x30, 0x06,
+        0x00, 0xc0, 0x30, 0x0c, 0x00, 0xef, 0xff, 0xfc, 0x00, 0x38, 0x03, 0x80,
+        0x38, 0x7f, 0xff, 0xff, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00,
+        0x7f, 0x8f, 0xf1, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x7f,
+        0xff, 0xfe, 0xef, 0xff, 0xfc, 0x00, 0x03, 0x80, 0xe0, 0x38, 0x7f, 0xff,
+        0xff, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0x8f, 0xf1,
+        0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0xff, 0xfe, 0xef,
+        0xff, 0xfc, 0x00, 0x0e, 0x03, 0xe0, 0xee, 0x7f, 0xff, 0xff, 0x80, 0x30,
+        0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0x8f, 0xf1, 0x80, 0x30, 0x06,
+        0x00, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0xff, 0xfe, 0xef, 0xff, 0xfc, 0x00,
+        0x31, 0x86, 0x30, 0xc6, 0x7f, 0xff, 0xff, 0x80, 0x30, 0x06, 0x00, 0xc0,
+        0x18, 0x03, 0x00, 0x7f, 0x8f, 0xf1, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18,
+        0x03, 0x00, 0x7f, 0xff, 0xfe, 0xef, 0xff, 0xfc, 0x00, 0xe1, 0xc3, 0xbf,
+        0xfc, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x3f,
+        0xfc, 0xef, 0xff, 0xfc, 0x00, 0x1c, 0xe7, 0x3f, 0xfc, 0xc3, 0x0c, 0x30,
+        0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x3f, 0xfc, 0xef, 0xff, 0xfc,
+        0x00, 0x38, 0xfb, 0xbb, 0xf7, 0xe3, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1,
+        0x83, 0x06, 0x0c, 0x18, 0x30, 0x63, 0xf7, 0xe0, 0xef, 0xff, 0xfc, 0x00,
+        0xc7, 0x8f, 0x1b, 0xf7, 0xe3, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83,
+        0x06, 0x0c, 0x18, 0x30, 0x63, 0xf7, 0xe0, 0x0f, 0xff, 0xfc, 0x00, 0x7f,
+        0x07, 0xfc, 0x60, 0xe6, 0x06, 0x60, 0x36, 0x03, 0x60, 0x36, 0x03, 0xfe,
+        0x3f, 0xe3, 0x60, 0x36, 0x03, 0x60, 0x36, 0x03, 0x60, 0x66, 0x0e, 0x7f,
+        0xc7, 0xf0, 0xef, 0xff, 0xfc, 0x00, 0x3c, 0xcf, 0xf9, 0x9e, 0x60, 0x3c,
+        0x07, 0x80, 0xf0, 0x1f, 0x03, 0xf0, 0x7f, 0x0f, 0x71, 0xe7, 0x3c, 0x77,
+        0x87, 0xf0, 0x7e, 0x07, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x06, 0xef,
+        0xff, 0xfc, 0x00, 0x38, 0x03, 0x80, 0x38, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0xef, 0xff, 0xfc, 0x00,
+        0x03, 0x80, 0xe0, 0x38, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xc0,
+        0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78,
+        0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0xef, 0xff, 0xfc, 0x00, 0x0e, 0x03, 0xe0,
+        0xee, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01,
+        0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x83, 0xbf,
+        0xe3, 0xf8, 0xef, 0xff, 0xfc, 0x00, 0x3c, 0xcf, 0xf9, 0x9e, 0x1f, 0xc7,
+        0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07,
+        0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0xef,
+        0xff, 0xfc, 0x00, 0x31, 0x86, 0x30, 0xc6, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0x00, 0xff, 0xe0, 0x00,
+        0xc0, 0x7c, 0x1d, 0xc7, 0x1d, 0xc1, 0xf0, 0x1c, 0x07, 0xc1, 0xdc, 0x71,
+        0xdc, 0x1f, 0x01, 0x80, 0x0f, 0xff, 0xfc, 0x00, 0x1f, 0xc1, 0xff, 0x1c,
+        0x1c, 0xc0, 0x76, 0x07, 0xb0, 0x79, 0x87, 0xcc, 0x76, 0x67, 0x33, 0x71,
+        0x9f, 0x0c, 0xf0, 0x67, 0x03, 0x70, 0x1b, 0x80, 0xce, 0x0e, 0x3f, 0xe0,
+        0xfe, 0x00, 0xef, 0xff, 0xfc, 0x00, 0x38, 0x03, 0x80, 0x38, 0x60, 0x3c,
+        0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07,
+        0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0xef,
+        0xff, 0xfc, 0x00, 0x03, 0x80, 0xe0, 0x38, 0x60, 0x3c, 0x07, 0x80, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0xef, 0xff, 0xfc, 0x00,
+        0x0e, 0x03, 0xe0, 0xee, 0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0,
+        0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78,
+        0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0xef, 0xff, 0xfc, 0x00, 0x31, 0x86, 0x30,
+        0xc6, 0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01,
+        0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x83, 0xbf,
+        0xe3, 0xf8, 0xef, 0xff, 0xfc, 0x00, 0x03, 0x80, 0x70, 0x0e, 0x0c, 0x03,
+        0xc0, 0x36, 0x06, 0x60, 0x63, 0x0c, 0x30, 0xc1, 0x98, 0x19, 0x80, 0xf0,
+        0x0f, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+        0x06, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0xcf,
+        0xfd, 0x81, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x7f, 0xfd,
+        0xff, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x7f,
+        0x1f, 0xf3, 0x07, 0x60, 0x6c, 0x0d, 0x81, 0xb0, 0x67, 0xfc, 0xff, 0xd8,
+        0x1f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf8, 0x1f, 0x87, 0xdf, 0xd9, 0xf0,
+        0x07, 0x7f, 0xfc, 0x00, 0x38, 0x03, 0x80, 0x38, 0x1f, 0xc3, 0xfc, 0x01,
+        0xc0, 0x19, 0xff, 0x7f, 0xfc, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xc0, 0xdf,
+        0xf9, 0xff, 0x07, 0x7f, 0xfc, 0x00, 0x03, 0x80, 0xe0, 0x38, 0x1f, 0xc3,
+        0xfc, 0x01, 0xc0, 0x19, 0xff, 0x7f, 0xfc, 0x0f, 0x01, 0xe0, 0x3c, 0x07,
+        0xc0, 0xdf, 0xf9, 0xff, 0x07, 0x7f, 0xfc, 0x00, 0x0e, 0x03, 0xe0, 0xee,
+        0x1f, 0xc3, 0xfc, 0x01, 0xc0, 0x19, 0xff, 0x7f, 0xfc, 0x0f, 0x01, 0xe0,
+        0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x07, 0x7f, 0xfc, 0x00, 0x3c, 0xcf,
+        0xf9, 0x9e, 0x1f, 0xc3, 0xfc, 0x01, 0xc0, 0x19, 0xff, 0x7f, 0xfc, 0x0f,
+        0x01, 0xe0, 0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x07, 0x7f, 0xfc, 0x00,
+        0x31, 0x86, 0x30, 0xc6, 0x1f, 0xc3, 0xfc, 0x01, 0xc0, 0x19, 0xff, 0x7f,
+        0xfc, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x07, 0xff,
+        0xfc, 0x00, 0x0f, 0x03, 0x30, 0x66, 0x07, 0x83, 0xf8, 0x7f, 0x80, 0x38,
+        0x03, 0x3f, 0xef, 0xff, 0x81, 0xe0, 0x3c, 0x07, 0x80, 0xf8, 0x1b, 0xff,
+        0x3f, 0xe0, 0x00, 0x7f, 0xfc, 0x00, 0x7d, 0xe3, 0xff, 0x81, 0xce, 0x06,
+        0x33, 0xf1, 0xbf, 0xff, 0x8f, 0xf8, 0x60, 0xc3, 0x06, 0x18, 0x38, 0xe6,
+        0xff, 0xf3, 0xef, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x3f, 0x8f, 0xfb, 0x83,
+        0xe0, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x83, 0xbf,
+        0xe3, 0xf8, 0x18, 0x03, 0x00, 0x60, 0x18, 0x06, 0x00, 0x07, 0x7f, 0xfc,
+        0x00, 0x38, 0x03, 0x80, 0x38, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0, 0x1e, 0x03,
+        0xff, 0xff, 0xff, 0x00, 0x60, 0x0c, 0x01, 0xc1, 0xdf, 0xf1, 0xfc, 0x07,
+        0x7f, 0xfc, 0x00, 0x03, 0x80, 0xe0, 0x38, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0,
+        0x1e, 0x03, 0xff, 0xff, 0xff, 0x00, 0x60, 0x0c, 0x01, 0xc1, 0xdf, 0xf1,
+        0xfc, 0x07, 0x7f, 0xfc, 0x00, 0x0e, 0x03, 0xe0, 0xee, 0x1f, 0xc7, 0xfd,
+        0xc1, 0xf0, 0x1e, 0x03, 0xff, 0xff, 0xff, 0x00, 0x60, 0x0c, 0x01, 0xc1,
+        0xdf, 0xf1, 0xfc, 0x07, 0x7f, 0xfc, 0x00, 0x31, 0x86, 0x30, 0xc6, 0x1f,
+        0xc7, 0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xff, 0xff, 0xff, 0x00, 0x60, 0x0c,
+        0x01, 0xc1, 0xdf, 0xf1, 0xfc, 0x07, 0x7f, 0xfc, 0x00, 0xe0, 0xe0, 0xe3,
+        0xc7, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x1f, 0xbf, 0x07,
+        0x7f, 0xfc, 0x00, 0x1c, 0xe7, 0x3c, 0xf0, 0xc3, 0x0c, 0x30, 0xc3, 0x0c,
+        0x30, 0xcf, 0xff, 0x07, 0x7f, 0xfc, 0x00, 0x38, 0xfb, 0xbb, 0xc7, 0x83,
+        0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x1f, 0xbf, 0x07, 0x7f, 0xfc,
+        0x00, 0xc7, 0x8f, 0x1b, 0xc7, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1,
+        0x83, 0x1f, 0xbf, 0x0f, 0xff, 0xfc, 0x00, 0x73, 0x07, 0xc0, 0xf0, 0x37,
+        0x00, 0x70, 0x7f, 0x1f, 0xf7, 0x07, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c,
+        0x07, 0x80, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x07, 0x7f, 0xfc, 0x00,
+        0x78, 0xdf, 0xfb, 0x1e, 0x7f, 0xcf, 0xfd, 0x81, 0xf0, 0x1e, 0x03, 0xc0,
+        0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0x07, 0x7f,
+        0xfc, 0x00, 0x38, 0x03, 0x80, 0x38, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xc1, 0xdf, 0xf1, 0xfc,
+        0x07, 0x7f, 0xfc, 0x00, 0x03, 0x80, 0xe0, 0x38, 0x1f, 0xc7, 0xfd, 0xc1,
+        0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xc1, 0xdf,
+        0xf1, 0xfc, 0x07, 0x7f, 0xfc, 0x00, 0x0e, 0x03, 0xe0, 0xee, 0x1f, 0xc7,
+        0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07,
+        0xc1, 0xdf, 0xf1, 0xfc, 0x07, 0x7f, 0xfc, 0x00, 0x3c, 0xcf, 0xf9, 0x9e,
+        0x1f, 0xc7, 0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0,
+        0x3c, 0x07, 0xc1, 0xdf, 0xf1, 0xfc, 0x07, 0x7f, 0xfc, 0x00, 0x31, 0x86,
+        0x30, 0xc6, 0x1f, 0xc7, 0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f,
+        0x01, 0xe0, 0x3c, 0x07, 0xc1, 0xdf, 0xf1, 0xfc, 0x03, 0xcc, 0xf0, 0x00,
+        0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0xff, 0xff, 0xff, 0x06, 0x00, 0x60,
+        0x06, 0x00, 0x60, 0x00, 0x7f, 0xfc, 0x00, 0x1f, 0xd9, 0xff, 0xd8, 0x1c,
+        0xc1, 0xe6, 0x1f, 0x31, 0xd9, 0x9c, 0xcd, 0xc6, 0x7c, 0x33, 0xc1, 0x9c,
+        0x0d, 0xff, 0xcd, 0xfc, 0x00, 0x07, 0x7f, 0xfc, 0x00, 0x38, 0x03, 0x80,
+        0x38, 0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01,
+        0xe0, 0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x07, 0x7f, 0xfc, 0x00, 0x03,
+        0x80, 0xe0, 0x38, 0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78,
+        0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x07, 0x7f, 0xfc,
+        0x00, 0x0e, 0x03, 0xe0, 0xee, 0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03,
+        0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x07,
+        0x7f, 0xfc, 0x00, 0x31, 0x86, 0x30, 0xc6, 0x60, 0x3c, 0x07, 0x80, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xc0, 0xdf, 0xf9,
+        0xff, 0x07, 0x7f, 0xff, 0xe0, 0x03, 0x80, 0xe0, 0x38, 0x60, 0x3c, 0x07,
+        0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xc0,
+        0xdf, 0xf9, 0xff, 0x00, 0x60, 0x0c, 0x03, 0xbf, 0xe7, 0xf8, 0x0f, 0xff,
+        0xff, 0xe0, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0xff, 0x3f, 0xf6,
+        0x07, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x07,
+        0xff, 0xdf, 0xf3, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x00, 0x07, 0x7f,
+        0xff, 0xe0, 0x31, 0x86, 0x30, 0xc6, 0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff,
+        0x00, 0x60, 0x0c, 0x03, 0xbf, 0xe7, 0xf8
       },
       (GFXglyph[]){
-        {     0,  14,  28,  14,    0,  -21 },   // 0xA0
-        {    49,  14,  28,  14,    0,  -21 },   // 0xA1
-        {    98,  14,  28,  14,    0,  -21 },   // 0xA2
-        {   147,  14,  28,  14,    0,  -21 },   // 0xA3
-        {   196,  14,  28,  14,    0,  -21 },   // 0xA4
-        {   245,  14,  28,  14,    0,  -21 },   // 0xA5
-        {   294,  14,  28,  14,    0,  -21 },   // 0xA6
-        {   343,  14,  28,  14,    0,  -21 },   // 0xA7
-        {   392,  14,  28,  14,    0,  -21 },   // 0xA8
-        {   441,  14,  28,  14,    0,  -21 },   // 0xA9
-        {   490,  14,  28,  14,    0,  -21 },   // 0xAA
-        {   539,  14,  28,  14,    0,  -21 },   // 0xAB
-        {   588,  14,  28,  14,    0,  -21 },   // 0xAC
-        {   637,  14,  28,  14,    0,  -21 },   // 0xAD
-        {   686,  14,  28,  14,    0,  -21 },   // 0xAE
-        {   735,  14,  28,  14,    0,  -21 },   // 0xAF
-        {   784,  14,  28,  14,    0,  -21 },   // 0xB0
-        {   833,  14,  28,  14,    0,  -21 },   // 0xB1
-        {   882,  14,  28,  14,    0,  -21 },   // 0xB2
-        {   931,  14,  28,  14,    0,  -21 },   // 0xB3
-        {   980,  14,  28,  14,    0,  -21 },   // 0xB4
-        {  1029,  14,  28,  14,    0,  -21 },   // 0xB5
-        {  1078,  14,  28,  14,    0,  -21 },   // 0xB6
-        {  1127,  14,  28,  14,    0,  -21 },   // 0xB7
-        {  1176,  14,  28,  14,    0,  -21 },   // 0xB8
-        {  1225,  14,  28,  14,    0,  -21 },   // 0xB9
-        {  1274,  14,  28,  14,    0,  -21 },   // 0xBA
-        {  1323,  14,  28,  14,    0,  -21 },   // 0xBB
-        {  1372,  14,  28,  14,    0,  -21 },   // 0xBC
-        {  1421,  14,  28,  14,    0,  -21 },   // 0xBD
-        {  1470,  14,  28,  14,    0,  -21 },   // 0xBE
-        {  1519,  14,  28,  14,    0,  -21 },   // 0xBF
-        {  1568,  14,  28,  14,    0,  -21 },   // 0xC0
-        {  1617,  14,  28,  14,    0,  -21 },   // 0xC1
-        {  1666,  14,  28,  14,    0,  -21 },   // 0xC2
-        {  1715,  14,  28,  14,    0,  -21 },   // 0xC3
-        {  1764,  14,  28,  14,    0,  -21 },   // 0xC4
-        {  1813,  14,  28,  14,    0,  -21 },   // 0xC5
-        {  1862,  14,  28,  14,    0,  -21 },   // 0xC6
-        {  1911,  14,  28,  14,    0,  -21 },   // 0xC7
-        {  1960,  14,  28,  14,    0,  -21 },   // 0xC8
-        {  2009,  14,  28,  14,    0,  -21 },   // 0xC9
-        {  2058,  14,  28,  14,    0,  -21 },   // 0xCA
-        {  2107,  14,  28,  14,    0,  -21 },   // 0xCB
-        {  2156,  14,  28,  14,    0,  -21 },   // 0xCC
-        {  2205,  14,  28,  14,    0,  -21 },   // 0xCD
-        {  2254,  14,  28,  14,    0,  -21 },   // 0xCE
-        {  2303,  14,  28,  14,    0,  -21 },   // 0xCF
-        {  2352,  14,  28,  14,    0,  -21 },   // 0xD0
-        {  2401,  14,  28,  14,    0,  -21 },   // 0xD1
-        {  2450,  14,  28,  14,    0,  -21 },   // 0xD2
-        {  2499,  14,  28,  14,    0,  -21 },   // 0xD3
-        {  2548,  14,  28,  14,    0,  -21 },   // 0xD4
-        {  2597,  14,  28,  14,    0,  -21 },   // 0xD5
-        {  2646,  14,  28,  14,    0,  -21 },   // 0xD6
-        {  2695,  14,  28,  14,    0,  -21 },   // 0xD7
-        {  2744,  14,  28,  14,    0,  -21 },   // 0xD8
-        {  2793,  14,  28,  14,    0,  -21 },   // 0xD9
-        {  2842,  14,  28,  14,    0,  -21 },   // 0xDA
-        {  2891,  14,  28,  14,    0,  -21 },   // 0xDB
-        {  2940,  14,  28,  14,    0,  -21 },   // 0xDC
-        {  2989,  14,  28,  14,    0,  -21 },   // 0xDD
-        {  3038,  14,  28,  14,    0,  -21 },   // 0xDE
-        {  3087,  14,  28,  14,    0,  -21 },   // 0xDF
-        {  3136,  14,  28,  14,    0,  -21 },   // 0xE0
-        {  3185,  14,  28,  14,    0,  -21 },   // 0xE1
-        {  3234,  14,  28,  14,    0,  -21 },   // 0xE2
-        {  3283,  14,  28,  14,    0,  -21 },   // 0xE3
-        {  3332,  14,  28,  14,    0,  -21 },   // 0xE4
-        {  3381,  14,  28,  14,    0,  -21 },   // 0xE5
-        {  3430,  14,  28,  14,    0,  -21 },   // 0xE6
-        {  3479,  14,  28,  14,    0,  -21 },   // 0xE7
-        {  3528,  14,  28,  14,    0,  -21 },   // 0xE8
-        {  3577,  14,  28,  14,    0,  -21 },   // 0xE9
-        {  3626,  14,  28,  14,    0,  -21 },   // 0xEA
-        {  3675,  14,  28,  14,    0,  -21 },   // 0xEB
-        {  3724,  14,  28,  14,    0,  -21 },   // 0xEC
-        {  3773,  14,  28,  14,    0,  -21 },   // 0xED
-        {  3822,  14,  28,  14,    0,  -21 },   // 0xEE
-        {  3871,  14,  28,  14,    0,  -21 },   // 0xEF
-        {  3920,  14,  28,  14,    0,  -21 },   // 0xF0
-        {  3969,  14,  28,  14,    0,  -21 },   // 0xF1
-        {  4018,  14,  28,  14,    0,  -21 },   // 0xF2
-        {  4067,  14,  28,  14,    0,  -21 },   // 0xF3
-        {  4116,  14,  28,  14,    0,  -21 },   // 0xF4
-        {  4165,  14,  28,  14,    0,  -21 },   // 0xF5
-        {  4214,  14,  28,  14,    0,  -21 },   // 0xF6
-        {  4263,  14,  28,  14,    0,  -21 },   // 0xF7
-        {  4312,  14,  28,  14,    0,  -21 },   // 0xF8
-        {  4361,  14,  28,  14,    0,  -21 },   // 0xF9
-        {  4410,  14,  28,  14,    0,  -21 },   // 0xFA
-        {  4459,  14,  28,  14,    0,  -21 },   // 0xFB
-        {  4508,  14,  28,  14,    0,  -21 },   // 0xFC
-        {  4557,  14,  28,  14,    0,  -21 },   // 0xFD
-        {  4606,  14,  28,  14,    0,  -21 },   // 0xFE
-        {  4655,  14,  28,  14,    0,  -21 },   // 0xFF
+        {     0,   0,  28,  14,    0,  -21 },   // 0xA0
+        {     0,   2,  28,  14,    6,  -21 },   // 0xA1
+        {     8,  10,  28,  14,    2,  -21 },   // 0xA2
+        {    34,  10,  28,  14,    2,  -21 },   // 0xA3
+        {    61,  12,  28,  14,    1,  -21 },   // 0xA4
+        {    85,  12,  28,  14,    1,  -21 },   // 0xA5
+        {   116,   2,  28,  14,    6,  -21 },   // 0xA6
+        {   124,   8,  28,  14,    3,  -21 },   // 0xA7
+        {   148,   7,  28,  14,    3,  -21 },   // 0xA8
+        {   155,  13,  28,  14,    0,  -21 },   // 0xA9
+        {   182,  10,  28,  14,    2,  -21 },   // 0xAA
+        {   201,  14,  28,  14,    0,  -21 },   // 0xAB
+        {   228,  11,  28,  14,    1,  -21 },   // 0xAC
+        {   242,  10,  28,  14,    2,  -21 },   // 0xAD
+        {   249,  13,  28,  14,    0,  -21 },   // 0xAE
+        {   276,   7,  28,  14,    3,  -21 },   // 0xAF
+        {   282,   7,  28,  14,    3,  -21 },   // 0xB0
+        {   293,  12,  28,  14,    1,  -21 },   // 0xB1
+        {   318,   7,  28,  14,    3,  -21 },   // 0xB2
+        {   331,   7,  28,  14,    3,  -21 },   // 0xB3
+        {   344,   5,  28,  14,    5,  -21 },   // 0xB4
+        {   350,  11,  28,  14,    1,  -21 },   // 0xB5
+        {   379,  12,  28,  14,    1,  -21 },   // 0xB6
+        {   410,   2,  28,  14,    6,  -21 },   // 0xB7
+        {   415,   4,  28,  14,    3,  -21 },   // 0xB8
+        {   422,   6,  28,  14,    4,  -21 },   // 0xB9
+        {   434,  10,  28,  14,    2,  -21 },   // 0xBA
+        {   453,  14,  28,  14,    0,  -21 },   // 0xBB
+        {   480,  12,  28,  14,    1,  -21 },   // 0xBC
+        {   511,  12,  28,  14,    1,  -21 },   // 0xBD
+        {   542,  12,  28,  14,    1,  -21 },   // 0xBE
+        {   573,  11,  28,  14,    1,  -21 },   // 0xBF
+        {   599,  11,  28,  14,    1,  -21 },   // 0xC0
+        {   632,  11,  28,  14,    1,  -21 },   // 0xC1
+        {   665,  11,  28,  14,    1,  -21 },   // 0xC2
+        {   698,  11,  28,  14,    1,  -21 },   // 0xC3
+        {   731,  11,  28,  14,    1,  -21 },   // 0xC4
+        {   764,  11,  28,  14,    1,  -21 },   // 0xC5
+        {   799,  13,  28,  14,    0,  -21 },   // 0xC6
+        {   833,  11,  28,  14,    1,  -21 },   // 0xC7
+        {   869,  11,  28,  14,    1,  -21 },   // 0xC8
+        {   902,  11,  28,  14,    1,  -21 },   // 0xC9
+        {   935,  11,  28,  14,    1,  -21 },   // 0xCA
+        {   968,  11,  28,  14,    1,  -21 },   // 0xCB
+        {  1001,   6,  28,  14,    4,  -21 },   // 0xCC
+        {  1021,   6,  28,  14,    4,  -21 },   // 0xCD
+        {  1041,   7,  28,  14,    3,  -21 },   // 0xCE
+        {  1064,   7,  28,  14,    3,  -21 },   // 0xCF
+        {  1087,  12,  28,  14,    0,  -21 },   // 0xD0
+        {  1118,  11,  28,  14,    1,  -21 },   // 0xD1
+        {  1151,  11,  28,  14,    1,  -21 },   // 0xD2
+        {  1184,  11,  28,  14,    1,  -21 },   // 0xD3
+        {  1217,  11,  28,  14,    1,  -21 },   // 0xD4
+        {  1250,  11,  28,  14,    1,  -21 },   // 0xD5
+        {  1283,  11,  28,  14,    1,  -21 },   // 0xD6
+        {  1316,  11,  28,  14,    1,  -21 },   // 0xD7
+        {  1336,  13,  28,  14,    0,  -21 },   // 0xD8
+        {  1370,  11,  28,  14,    1,  -21 },   // 0xD9
+        {  1403,  11,  28,  14,    1,  -21 },   // 0xDA
+        {  1436,  11,  28,  14,    1,  -21 },   // 0xDB
+        {  1469,  11,  28,  14,    1,  -21 },   // 0xDC
+        {  1502,  12,  28,  14,    1,  -21 },   // 0xDD
+        {  1538,  11,  28,  14,    1,  -21 },   // 0xDE
+        {  1567,  11,  28,  14,    1,  -21 },   // 0xDF
+        {  1596,  11,  28,  14,    1,  -21 },   // 0xE0
+        {  1622,  11,  28,  14,    1,  -21 },   // 0xE1
+        {  1648,  11,  28,  14,    1,  -21 },   // 0xE2
+        {  1674,  11,  28,  14,    1,  -21 },   // 0xE3
+        {  1700,  11,  28,  14,    1,  -21 },   // 0xE4
+        {  1726,  11,  28,  14,    1,  -21 },   // 0xE5
+        {  1754,  13,  28,  14,    0,  -21 },   // 0xE6
+        {  1780,  11,  28,  14,    1,  -21 },   // 0xE7
+        {  1809,  11,  28,  14,    1,  -21 },   // 0xE8
+        {  1835,  11,  28,  14,    1,  -21 },   // 0xE9
+        {  1861,  11,  28,  14,    1,  -21 },   // 0xEA
+        {  1887,  11,  28,  14,    1,  -21 },   // 0xEB
+        {  1913,   7,  28,  14,    3,  -21 },   // 0xEC
+        {  1931,   6,  28,  14,    4,  -21 },   // 0xED
+        {  1947,   7,  28,  14,    3,  -21 },   // 0xEE
+        {  1965,   7,  28,  14,    3,  -21 },   // 0xEF
+        {  1983,  11,  28,  14,    1,  -21 },   // 0xF0
+        {  2012,  11,  28,  14,    1,  -21 },   // 0xF1
+        {  2038,  11,  28,  14,    1,  -21 },   // 0xF2
+        {  2064,  11,  28,  14,    1,  -21 },   // 0xF3
+        {  2090,  11,  28,  14,    1,  -21 },   // 0xF4
+        {  2116,  11,  28,  14,    1,  -21 },   // 0xF5
+        {  2142,  11,  28,  14,    1,  -21 },   // 0xF6
+        {  2168,  12,  28,  14,    1,  -21 },   // 0xF7
+        {  2187,  13,  28,  14,    0,  -21 },   // 0xF8
+        {  2213,  11,  28,  14,    1,  -21 },   // 0xF9
+        {  2239,  11,  28,  14,    1,  -21 },   // 0xFA
+        {  2265,  11,  28,  14,    1,  -21 },   // 0xFB
+        {  2291,  11,  28,  14,    1,  -21 },   // 0xFC
+        {  2317,  11,  28,  14,    1,  -21 },   // 0xFD
+        {  2350,  11,  28,  14,    1,  -21 },   // 0xFE
+        {  2386,  11,  28,  14,    1,  -21 },   // 0xFF
       },  0x20, 0x7f, 0
 
-    }, 0x80, 0xa0, 0xff
+    }, 0x80, 0xa0, 0xff, true
   },
-  // Approx. 5383 bytes
+  // Approx. 3098 bytes
 
   {
     {
       (uint8_t[]){
-        0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x00,
-        0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f, 0x81, 0xfe,
-        0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f,
-        0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x18, 0xc0, 0x63, 0x01, 0x8c, 0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6,
-        0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f, 0x81,
-        0xfe, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00,
-        0x7f, 0xf1, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xf0,
-        0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0xfc, 0x0f, 0xf8, 0x30,
-        0x70, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c,
-        0x1c, 0x31, 0xe0, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x00, 0x00, 0x7f, 0xf1,
-        0xff, 0xc6, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00,
-        0x18, 0x00, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-        0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
-        0x00, 0x7f, 0x81, 0xfe, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06,
-        0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x01, 0x80, 0x06, 0x00,
-        0x1c, 0x00, 0x3f, 0xc0, 0x7f, 0x80, 0x07, 0x00, 0x0c, 0x00, 0x30, 0x00,
-        0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x0f, 0xc0, 0x3f, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc0, 0x63, 0x01, 0x8c,
-        0x00, 0x00, 0x0f, 0xc0, 0x3f, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c,
-        0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03,
-        0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0xf8, 0x07, 0xe0, 0x06, 0x00, 0x18, 0x00, 0x60,
-        0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
-        0x60, 0x61, 0x81, 0x86, 0x06, 0x1c, 0x38, 0x3f, 0xc0, 0x7e, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0xfc, 0x07, 0x30, 0x18, 0xc0, 0x63,
-        0x01, 0x8c, 0x06, 0x30, 0x18, 0xf8, 0x63, 0xf1, 0x8c, 0xe6, 0x31, 0x98,
-        0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xce, 0xe3, 0xf3, 0x0f, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x01, 0x8c, 0x06, 0x30, 0x18, 0xc0,
-        0x63, 0x01, 0x8c, 0x06, 0x30, 0x18, 0xf8, 0x7f, 0xf1, 0xfc, 0xe6, 0x31,
-        0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xce, 0x63, 0xf1, 0x8f,
-        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x03, 0xf0, 0x03, 0x00, 0x0c,
-        0x00, 0x30, 0x00, 0xc0, 0x03, 0xfc, 0x0f, 0xf8, 0x30, 0x70, 0xc0, 0xc3,
-        0x03, 0x0c, 0x0c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c, 0x0c, 0x30, 0x30,
-        0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0xc0, 0x0e, 0x00, 0x70, 0x00, 0x00, 0x60, 0x31, 0x81, 0xc6, 0x0e,
-        0x18, 0x70, 0x63, 0x81, 0x9c, 0x06, 0xe0, 0x1f, 0x00, 0x78, 0x01, 0xe0,
-        0x07, 0xc0, 0x1b, 0x80, 0x67, 0x01, 0x8e, 0x06, 0x1c, 0x18, 0x38, 0x60,
-        0x71, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x71, 0x83, 0xc6, 0x1f, 0x18, 0xec, 0x67, 0x31,
-        0xb8, 0xc7, 0xc3, 0x1e, 0x0c, 0x70, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x18, 0xc0, 0x7f, 0x00, 0xf8, 0x00, 0x00, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x70,
-        0x30, 0xff, 0xc1, 0xff, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x1c, 0x3f, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x19,
-        0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06,
-        0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80, 0x66, 0x01,
-        0x98, 0x06, 0x7f, 0xf9, 0xff, 0xe0, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f,
-        0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0xff, 0xc7, 0xff, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xe1, 0xff, 0x86, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00,
-        0x1f, 0xf0, 0x7f, 0xe1, 0x81, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x1c, 0x7f, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x7f, 0xc1, 0xff, 0x86, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x06, 0x1f, 0xf0, 0x7f, 0xc1, 0x81, 0x86, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x18, 0x1c, 0x7f, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-        0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60,
-        0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x07, 0xf0, 0x3f, 0xc1, 0xc3, 0x06, 0x0c, 0x18, 0x30,
-        0x60, 0xc1, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x0c,
-        0x18, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x0c, 0x3f, 0xf1, 0xff, 0xe6, 0x01,
-        0x98, 0x06, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x00, 0x18, 0x00, 0x60,
-        0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f, 0x81, 0xfe, 0x06, 0x00, 0x18,
-        0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x7f, 0xf1, 0xff, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6,
-        0x63, 0x19, 0xcc, 0xe3, 0xb7, 0x07, 0xf8, 0x0f, 0xc0, 0x7f, 0x83, 0xb7,
-        0x1c, 0xce, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c,
-        0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x1c, 0x0f, 0xe0, 0x3f, 0x80,
-        0x07, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0,
-        0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x71, 0x83, 0xc6, 0x1f, 0x18, 0xec, 0x67, 0x31, 0xb8,
-        0xc7, 0xc3, 0x1e, 0x0c, 0x70, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x18, 0xc0, 0x7f, 0x00, 0xf8, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x71, 0x83, 0xc6, 0x1f, 0x18, 0xec, 0x67, 0x31,
-        0xb8, 0xc7, 0xc3, 0x1e, 0x0c, 0x70, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x31, 0x81,
-        0xc6, 0x0e, 0x18, 0x70, 0x63, 0x81, 0x9c, 0x06, 0xe0, 0x1f, 0x00, 0x78,
-        0x01, 0xe0, 0x07, 0xc0, 0x1b, 0x80, 0x67, 0x01, 0x8e, 0x06, 0x1c, 0x18,
-        0x38, 0x60, 0x71, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0,
-        0x3f, 0xc1, 0xc3, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x0c,
-        0x18, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83,
-        0x06, 0x0c, 0x38, 0x31, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
-        0x19, 0x80, 0x67, 0x03, 0x9e, 0x1e, 0x7c, 0xf9, 0xbf, 0x66, 0x79, 0x98,
-        0xc6, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80, 0x66,
-        0x01, 0x98, 0x06, 0x60, 0x19, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x7f, 0xf1, 0xff, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x7f, 0xf1, 0xff, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x7f, 0xc1, 0xff, 0x86, 0x07, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x71, 0xff, 0x87, 0xfc, 0x18, 0x00,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18,
-        0x00, 0x60, 0x01, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf9, 0xff, 0xe0, 0x30, 0x00, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x70, 0x30, 0xff, 0xc1,
-        0xff, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x1c, 0x3f, 0xe0,
-        0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0xc0, 0x1f, 0xe0, 0xff, 0xc7, 0x33,
-        0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c,
-        0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x9c, 0xce, 0x3f,
-        0xf0, 0x7f, 0x80, 0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x31, 0x80, 0xc3,
-        0x06, 0x0c, 0x18, 0x18, 0xc0, 0x63, 0x00, 0xd8, 0x03, 0x60, 0x07, 0x00,
-        0x1c, 0x00, 0xd8, 0x03, 0x60, 0x18, 0xc0, 0x63, 0x03, 0x06, 0x0c, 0x18,
-        0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x31, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c,
-        0x0c, 0x3f, 0xf8, 0x7f, 0xe0, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x31,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c,
-        0x3f, 0xf0, 0x7f, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03,
-        0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63,
-        0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98,
-        0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66,
-        0x31, 0x9c, 0xc6, 0x3f, 0xf8, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31,
-        0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c,
-        0x66, 0x31, 0x9c, 0xc6, 0x3f, 0xfc, 0x7f, 0xf0, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xf0, 0x03, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03,
-        0xfe, 0x0f, 0xfc, 0x30, 0x38, 0xc0, 0x63, 0x01, 0x8c, 0x06, 0x30, 0x18,
-        0xc0, 0x63, 0x01, 0x8c, 0x0e, 0x3f, 0xf0, 0xff, 0x80, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80,
-        0x67, 0xf1, 0x9f, 0xe6, 0x61, 0xd9, 0x83, 0x66, 0x0d, 0x98, 0x36, 0x60,
-        0xd9, 0x83, 0x66, 0x0d, 0x98, 0x76, 0x7f, 0x99, 0xfc, 0x60, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01,
-        0x80, 0x07, 0xfc, 0x1f, 0xf8, 0x60, 0x71, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x1c, 0x7f, 0xe1, 0xff, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x87, 0x07, 0x18, 0x0c, 0x00,
-        0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x0f, 0xf0, 0x3f, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc6, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xe1, 0x8f, 0xc6, 0x73, 0x99, 0x86,
-        0x66, 0x19, 0x98, 0x66, 0x61, 0x99, 0x86, 0x7e, 0x19, 0xf8, 0x66, 0x61,
-        0x99, 0x86, 0x66, 0x19, 0x98, 0x66, 0x61, 0x99, 0xce, 0x63, 0xf1, 0x87,
-        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0xc7, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x70, 0x30, 0xff, 0xc1,
-        0xff, 0x00, 0x7c, 0x03, 0xb0, 0x1c, 0xc0, 0xe3, 0x07, 0x0c, 0x38, 0x31,
-        0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0x01, 0xfe, 0x00, 0x1c, 0x00, 0x30, 0x7f,
-        0xc3, 0xff, 0x1c, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f,
-        0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x07,
-        0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x07, 0xfc, 0x1f, 0xf8, 0x60, 0x71,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x1c,
-        0x7f, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0xfe,
-        0x06, 0x1c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x18, 0x1f, 0xf0, 0x7f,
-        0xe1, 0x81, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x1c, 0x7f, 0xe1, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc7, 0xff, 0x18, 0x00,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00,
-        0x18, 0x00, 0x60, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc3, 0xff, 0x1c,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x70,
-        0xff, 0x83, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0xfe,
-        0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc7, 0xff, 0x1f, 0xfc, 0x60, 0x01, 0x80,
-        0x06, 0x00, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8c, 0x66,
-        0x31, 0x98, 0xc6, 0x73, 0x38, 0xed, 0xc1, 0xfe, 0x03, 0xf0, 0x1f, 0xe0,
-        0xed, 0xc7, 0x33, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x60, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-        0x03, 0xfe, 0x1c, 0x1c, 0x00, 0x30, 0x01, 0xc0, 0xfe, 0x03, 0xf8, 0x00,
-        0x70, 0x00, 0xc0, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-        0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x01, 0xfc, 0x03, 0xe0, 0x00,
-        0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0xc1, 0xc3, 0x0e, 0x0c, 0x70, 0x33, 0x80, 0xdc, 0x03, 0xe0,
-        0x0f, 0x00, 0x3e, 0x00, 0xdc, 0x03, 0x38, 0x0c, 0x70, 0x30, 0xe0, 0xc1,
-        0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x1f, 0xc0, 0xff, 0x07, 0x0c, 0x18, 0x30, 0x60, 0xc1,
-        0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x0c, 0x38, 0x31,
-        0xc0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x80, 0x67, 0x03, 0x9e, 0x1e, 0x7c, 0xf9, 0xbf,
-        0x66, 0x79, 0x98, 0xc6, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60,
-        0x19, 0x80, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31,
-        0x80, 0xc7, 0xff, 0x1f, 0xfc, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c,
-        0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xc7, 0xff, 0x18, 0x0c,
-        0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0x07, 0xfe, 0x18,
-        0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6,
-        0x03, 0x18, 0x1c, 0x7f, 0xe1, 0xff, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01,
-        0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0xfe,
-        0x1c, 0x1c, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-        0x06, 0x00, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe7,
-        0xff, 0x80, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80,
-        0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0, 0x03, 0x00,
-        0x0c, 0x00, 0x70, 0xff, 0x83, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00,
-        0x7f, 0x83, 0xff, 0x1c, 0xce, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x98, 0xc6,
-        0x63, 0x19, 0x8c, 0x66, 0x31, 0x9c, 0xce, 0x3f, 0xf0, 0x7f, 0x80, 0x30,
-        0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x01, 0x80, 0xc6, 0x03, 0x1c, 0x1c, 0x38, 0xe0, 0x77, 0x00, 0xf8, 0x01,
-        0xc0, 0x0f, 0x80, 0x77, 0x03, 0x8e, 0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf8, 0x7f,
-        0xe0, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0xc0, 0xc3,
-        0xff, 0x07, 0xfc, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x01, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c,
-        0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x9c, 0xc6, 0x3f,
-        0xf8, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19,
-        0x8c, 0x66, 0x31, 0x98, 0xc6, 0x63, 0x19, 0x8c, 0x66, 0x31, 0x9c, 0xc6,
-        0x3f, 0xfc, 0x7f, 0xf0, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x0f, 0x00, 0x0c, 0x00, 0x30,
-        0x00, 0xff, 0x03, 0xfe, 0x0c, 0x1c, 0x30, 0x30, 0xc0, 0xc3, 0x03, 0x0c,
-        0x1c, 0x3f, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x66, 0x01, 0x98, 0x06,
-        0x60, 0x19, 0xfc, 0x67, 0xf9, 0x98, 0x76, 0x60, 0xd9, 0x83, 0x66, 0x0d,
-        0x98, 0x76, 0x7f, 0x99, 0xfc, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x03, 0x00, 0x0c,
-        0x00, 0x30, 0x00, 0xff, 0x03, 0xfe, 0x0c, 0x1c, 0x30, 0x30, 0xc0, 0xc3,
-        0x03, 0x0c, 0x1c, 0x3f, 0xe0, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0xfe,
-        0x1c, 0x1c, 0x00, 0x30, 0x00, 0xc0, 0xff, 0x03, 0xfc, 0x00, 0x30, 0x00,
-        0xc0, 0x03, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x87, 0x86,
-        0x3f, 0x19, 0xce, 0x66, 0x19, 0x98, 0x66, 0x61, 0x9f, 0x86, 0x7e, 0x19,
-        0x98, 0x66, 0x61, 0x99, 0xce, 0x63, 0xf1, 0x87, 0x80, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-        0xc3, 0xff, 0x1c, 0x0c, 0x60, 0x31, 0x80, 0xc7, 0x03, 0x0f, 0xfc, 0x1f,
-        0xf0, 0x0e, 0xc0, 0x73, 0x03, 0x8c, 0x1c, 0x30, 0xe0, 0xc0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00, 0x00,
-        0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc7, 0xff, 0x1f, 0xfc,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x01, 0x8c, 0x06, 0x30, 0x00,
-        0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x31, 0x80, 0xc7, 0xff, 0x1f,
-        0xfc, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1c, 0x1c, 0x3f, 0xe0, 0x7f, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x03, 0xfc, 0x0f, 0xf0, 0x18, 0x00,
-        0x60, 0x01, 0xff, 0x07, 0xfe, 0x18, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x70, 0x0f, 0x80, 0x3c, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x01,
-        0xc0, 0x00, 0x01, 0xff, 0xc7, 0xff, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06,
-        0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01,
-        0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x01, 0x80,
-        0x07, 0xf8, 0x1f, 0xe0, 0x60, 0x01, 0x80, 0x06, 0x00, 0x1c, 0x1c, 0x3f,
-        0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0xfe, 0x1c, 0x1c, 0x60, 0x01,
-        0xc0, 0x03, 0xfc, 0x07, 0xf8, 0x00, 0x70, 0x00, 0xc0, 0x03, 0x1c, 0x1c,
-        0x3f, 0xe0, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0c,
-        0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xc0, 0x03,
-        0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30, 0x00,
-        0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x63, 0x01, 0x8c, 0x06, 0x30, 0x00, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0xc0,
-        0x03, 0x00, 0x0c, 0x00, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x30,
-        0x00, 0xc0, 0x0f, 0xc0, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x60, 0x01, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x1e, 0x00,
-        0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80,
-        0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x83, 0x06, 0x0c, 0x18, 0x38, 0xe0,
-        0x7f, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x03, 0xf0,
-        0x1c, 0xc0, 0x63, 0x01, 0x8f, 0x86, 0x3f, 0x18, 0xce, 0x63, 0x19, 0x8c,
-        0x66, 0x31, 0x98, 0xce, 0xe3, 0xf3, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8c, 0x06,
-        0x30, 0x18, 0xc0, 0x63, 0x01, 0x8f, 0x87, 0xff, 0x1f, 0xce, 0x63, 0x19,
-        0x8c, 0x66, 0x31, 0x98, 0xce, 0x63, 0xf1, 0x8f, 0x80, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x60, 0x03, 0xfc, 0x0f, 0xf0, 0x18, 0x00, 0x60, 0x01, 0xff,
-        0x07, 0xfe, 0x18, 0x1c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60,
-        0x31, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x00, 0x00,
-        0xc1, 0xc3, 0x0e, 0x0c, 0x70, 0x33, 0x80, 0xdc, 0x03, 0xe0, 0x0f, 0x00,
-        0x3e, 0x00, 0xdc, 0x03, 0x38, 0x0c, 0x70, 0x30, 0xe0, 0xc1, 0xc0, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x00,
-        0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x18,
-        0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x01, 0xfc, 0x03, 0xe0,
-        0x00, 0x01, 0x80, 0xc6, 0x03, 0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03,
-        0x18, 0x0c, 0x60, 0x31, 0x80, 0xc6, 0x03, 0x1c, 0x0c, 0x3f, 0xf0, 0x7f,
-        0xc0, 0x03, 0x00, 0x0c, 0x00, 0x70, 0xff, 0x83, 0xfc, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x01, 0x80, 0x66, 0x01, 0x98, 0x06, 0x60, 0x19, 0x80, 0x66,
-        0x01, 0x98, 0x06, 0x60, 0x19, 0x80, 0x66, 0x01, 0x98, 0x06, 0x7f, 0xf9,
-        0xff, 0xe0, 0x30, 0x00, 0xc0, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00
+        0xef, 0xff, 0xfc, 0x00, 0x38, 0x03, 0x80, 0x38, 0x7f, 0xff, 0xff, 0x80,
+        0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0x8f, 0xf1, 0x80, 0x30,
+        0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x7f, 0xff, 0xfe, 0xef, 0xff, 0xfc,
+        0x00, 0x31, 0x86, 0x30, 0xc6, 0x7f, 0xff, 0xff, 0x80, 0x30, 0x06, 0x00,
+        0xc0, 0x18, 0x03, 0x00, 0x7f, 0x8f, 0xf1, 0x80, 0x30, 0x06, 0x00, 0xc0,
+        0x18, 0x03, 0x00, 0x7f, 0xff, 0xfe, 0x0f, 0xff, 0xfc, 0x00, 0xfc, 0x0f,
+        0xc0, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x3f, 0xc3, 0xfe, 0x30, 0x73,
+        0x03, 0x30, 0x33, 0x03, 0x30, 0x33, 0x03, 0x30, 0x33, 0x07, 0x31, 0xe3,
+        0x1c, 0xef, 0xff, 0xfc, 0x00, 0x03, 0x80, 0xe0, 0x38, 0x7f, 0xff, 0xff,
+        0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80,
+        0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x0f, 0xff,
+        0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x01, 0x80, 0x30, 0x06,
+        0x00, 0xff, 0x1f, 0xe3, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x1f, 0x07,
+        0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0,
+        0x3c, 0x01, 0x80, 0x30, 0x07, 0x00, 0x7f, 0x87, 0xf8, 0x03, 0x80, 0x30,
+        0x06, 0x00, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00,
+        0xff, 0xf3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c,
+        0xff, 0xf0, 0xef, 0xff, 0xfc, 0x00, 0xc7, 0x8f, 0x1b, 0xf7, 0xe3, 0x06,
+        0x0c, 0x18, 0x30, 0x60, 0xc1, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x63, 0xf7,
+        0xe0, 0x0f, 0xff, 0xfc, 0x00, 0x03, 0xf0, 0x3f, 0x00, 0xc0, 0x0c, 0x00,
+        0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0x00, 0xc0, 0x0c, 0xc0,
+        0xcc, 0x0c, 0xc0, 0xce, 0x1c, 0x7f, 0x83, 0xf0, 0x0f, 0xff, 0xfc, 0x00,
+        0x1f, 0x01, 0xf8, 0x1c, 0xc0, 0xc6, 0x06, 0x30, 0x31, 0x81, 0x8c, 0x0c,
+        0x7c, 0x63, 0xf3, 0x19, 0xd8, 0xc6, 0xc6, 0x36, 0x31, 0xb1, 0x8d, 0x8c,
+        0x6c, 0x67, 0xe3, 0xf6, 0x1f, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0xc6, 0x0c,
+        0x60, 0xc6, 0x0c, 0x60, 0xc6, 0x0c, 0x60, 0xc6, 0x0c, 0x7c, 0xff, 0xef,
+        0xe7, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x67, 0xc7, 0xec,
+        0x7c, 0x0f, 0xff, 0xfc, 0x00, 0xfc, 0x0f, 0xc0, 0x30, 0x03, 0x00, 0x30,
+        0x03, 0x00, 0x3f, 0xc3, 0xfe, 0x30, 0x73, 0x03, 0x30, 0x33, 0x03, 0x30,
+        0x33, 0x03, 0x30, 0x33, 0x03, 0x30, 0x33, 0x03, 0xef, 0xff, 0xfc, 0x00,
+        0x03, 0x80, 0xe0, 0x38, 0x60, 0x3c, 0x0f, 0x83, 0xb0, 0xe6, 0x38, 0xce,
+        0x1b, 0x83, 0xe0, 0x78, 0x0f, 0x01, 0xf0, 0x37, 0x06, 0x70, 0xc7, 0x18,
+        0x73, 0x07, 0x60, 0x7c, 0x06, 0xef, 0xff, 0xfc, 0x00, 0x38, 0x03, 0x80,
+        0x38, 0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x07, 0xc1, 0xf8, 0x7f, 0x1d,
+        0xe7, 0x3d, 0xc7, 0xf0, 0xfc, 0x1f, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0,
+        0x3c, 0x06, 0xef, 0xff, 0xfc, 0x00, 0x31, 0x87, 0xf0, 0x7c, 0x60, 0x3c,
+        0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xf0, 0x37, 0xfe,
+        0x7f, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x03, 0xbf, 0xe7, 0xf8, 0x0f,
+        0xff, 0xff, 0xc0, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03,
+        0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03,
+        0xc0, 0x3c, 0x03, 0xff, 0xff, 0xff, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+        0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0x80,
+        0xf0, 0x1e, 0x03, 0xc0, 0x7f, 0xff, 0xff, 0xe0, 0x3c, 0x07, 0x80, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0c, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xdf, 0xfb,
+        0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x07, 0xfc, 0xff, 0xd8, 0x1f, 0x01,
+        0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x07, 0xff, 0xdf, 0xf0, 0x0f, 0xff,
+        0xfc, 0x00, 0xff, 0x9f, 0xfb, 0x03, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x37,
+        0xfc, 0xff, 0x98, 0x1b, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x07,
+        0xff, 0xdf, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0xff, 0x00, 0x60,
+        0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c,
+        0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x00, 0x0f, 0xff, 0xff, 0x80,
+        0x0f, 0xe1, 0xfe, 0x38, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06,
+        0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06,
+        0x7f, 0xef, 0xff, 0xc0, 0x3c, 0x03, 0xc0, 0x30, 0x0f, 0xff, 0xfc, 0x00,
+        0xff, 0xff, 0xff, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xff,
+        0x1f, 0xe3, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xff, 0xff,
+        0xfc, 0x0f, 0xff, 0xfc, 0x00, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6,
+        0x3e, 0x67, 0x76, 0xe3, 0xfc, 0x1f, 0x83, 0xfc, 0x76, 0xee, 0x67, 0xc6,
+        0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0x0f, 0xff, 0xfc, 0x00,
+        0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x07, 0x1f,
+        0xc3, 0xf8, 0x03, 0x80, 0x30, 0x06, 0x00, 0xf0, 0x1f, 0x07, 0x7f, 0xc7,
+        0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x0f,
+        0x83, 0xf0, 0xfe, 0x3b, 0xce, 0x7b, 0x8f, 0xe1, 0xf8, 0x3e, 0x07, 0x80,
+        0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0c, 0xef, 0xff, 0xfc, 0x00, 0x31, 0x87,
+        0xf0, 0x7c, 0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x07, 0xc1, 0xf8, 0x7f,
+        0x1d, 0xe7, 0x3d, 0xc7, 0xf0, 0xfc, 0x1f, 0x03, 0xc0, 0x78, 0x0f, 0x01,
+        0xe0, 0x3c, 0x06, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x78, 0x1f, 0x07, 0x61,
+        0xcc, 0x71, 0x9c, 0x37, 0x07, 0xc0, 0xf0, 0x1e, 0x03, 0xe0, 0x6e, 0x0c,
+        0xe1, 0x8e, 0x30, 0xe6, 0x0e, 0xc0, 0xf8, 0x0c, 0x0f, 0xff, 0xfc, 0x00,
+        0x0f, 0xe3, 0xfc, 0xe1, 0x98, 0x33, 0x06, 0x60, 0xcc, 0x19, 0x83, 0x30,
+        0x66, 0x0c, 0xc1, 0x98, 0x33, 0x06, 0x60, 0xcc, 0x19, 0x83, 0x70, 0x7c,
+        0x0c, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x3c, 0x03, 0xe0, 0x7f, 0x0f, 0xf9,
+        0xfd, 0xfb, 0xcf, 0x3c, 0x63, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0,
+        0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0x0f, 0xff, 0xfc, 0x00,
+        0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xff,
+        0xff, 0xff, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78,
+        0x0c, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07,
+        0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80,
+        0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0xff, 0xff,
+        0xff, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f,
+        0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0c, 0x0f,
+        0xff, 0xfc, 0x00, 0xff, 0x9f, 0xfb, 0x03, 0xe0, 0x3c, 0x07, 0x80, 0xf0,
+        0x1e, 0x03, 0xc0, 0xff, 0xfb, 0xfe, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06,
+        0x00, 0xc0, 0x18, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83,
+        0xe0, 0x3c, 0x07, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60,
+        0x0c, 0x01, 0x80, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f, 0xff, 0xfc,
+        0x00, 0xff, 0xff, 0xff, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+        0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+        0x60, 0x06, 0x00, 0x60, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x01,
+        0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xe0, 0x6f, 0xfc, 0xff, 0x80,
+        0x30, 0x06, 0x00, 0xc0, 0x18, 0x07, 0x7f, 0xcf, 0xf0, 0x3f, 0xff, 0xff,
+        0x00, 0x06, 0x00, 0x60, 0x3f, 0xc7, 0xfe, 0xe6, 0x7c, 0x63, 0xc6, 0x3c,
+        0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c,
+        0x63, 0xc6, 0x3e, 0x67, 0x7f, 0xe3, 0xfc, 0x06, 0x00, 0x60, 0x0f, 0xff,
+        0xfc, 0x00, 0xc0, 0x78, 0x0d, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xc0,
+        0xd8, 0x0e, 0x01, 0xc0, 0x6c, 0x0d, 0x83, 0x18, 0x63, 0x18, 0x33, 0x06,
+        0xc0, 0x78, 0x0c, 0x0f, 0xff, 0xff, 0xc0, 0xc0, 0x6c, 0x06, 0xc0, 0x6c,
+        0x06, 0xc0, 0x6c, 0x06, 0xc0, 0x6c, 0x06, 0xc0, 0x6c, 0x06, 0xc0, 0x6c,
+        0x06, 0xc0, 0x6c, 0x06, 0xc0, 0x6e, 0x06, 0x7f, 0xf3, 0xff, 0x00, 0x30,
+        0x03, 0x00, 0x30, 0x03, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x01,
+        0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1f, 0x03, 0x7f, 0xe7, 0xfc, 0x01, 0x80,
+        0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x0f, 0xff, 0xfc,
+        0x00, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c,
+        0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3e,
+        0x63, 0x7f, 0xf3, 0xff, 0x0f, 0xff, 0xff, 0xc0, 0xc6, 0x36, 0x31, 0xb1,
+        0x8d, 0x8c, 0x6c, 0x63, 0x63, 0x1b, 0x18, 0xd8, 0xc6, 0xc6, 0x36, 0x31,
+        0xb1, 0x8d, 0x8c, 0x6c, 0x63, 0x63, 0x1b, 0x18, 0xdc, 0xc6, 0x7f, 0xf9,
+        0xff, 0xc0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0c, 0x0f, 0xff, 0xfc, 0x00,
+        0xf0, 0x07, 0x80, 0x0c, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xff, 0x87,
+        0xfe, 0x30, 0x39, 0x80, 0xcc, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0c, 0xc0,
+        0x66, 0x07, 0x3f, 0xf1, 0xff, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x3c,
+        0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xfe, 0x3f, 0xf3, 0xc3, 0xbc,
+        0x1b, 0xc1, 0xbc, 0x1b, 0xc1, 0xbc, 0x1b, 0xc1, 0xbc, 0x3b, 0xff, 0x3f,
+        0xe3, 0x0f, 0xff, 0xfc, 0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01,
+        0x80, 0x3f, 0xe7, 0xfe, 0xc0, 0xf8, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80,
+        0xf0, 0x1e, 0x07, 0xff, 0xdf, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0x8f,
+        0xfb, 0x83, 0xe0, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x1f, 0xe3, 0xfc,
+        0x01, 0x80, 0x30, 0x06, 0x00, 0xf0, 0x1f, 0x07, 0x7f, 0xc7, 0xf0, 0x0f,
+        0xff, 0xfc, 0x00, 0xc3, 0xcc, 0x7e, 0xce, 0x7c, 0xc3, 0xcc, 0x3c, 0xc3,
+        0xcc, 0x3c, 0xc3, 0xfc, 0x3f, 0xc3, 0xcc, 0x3c, 0xc3, 0xcc, 0x3c, 0xc3,
+        0xcc, 0x3c, 0xe7, 0xc7, 0xec, 0x3c, 0x0f, 0xff, 0xfc, 0x00, 0x3f, 0xef,
+        0xff, 0x81, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xe0, 0x6f, 0xfc,
+        0xff, 0x81, 0xf0, 0x76, 0x1c, 0xc7, 0x19, 0xc3, 0x70, 0x7c, 0x0c, 0x00,
+        0x7f, 0xfc, 0x00, 0x3f, 0x87, 0xf8, 0x03, 0x80, 0x33, 0xfe, 0xff, 0xf8,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x81, 0xbf, 0xf3, 0xfe, 0x0f, 0xff, 0xfc,
+        0x00, 0x3f, 0x8f, 0xf3, 0x80, 0x60, 0x0c, 0x01, 0x80, 0x3f, 0xe7, 0xfe,
+        0xc0, 0xf8, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x07, 0xff,
+        0xdf, 0xf0, 0x0f, 0xff, 0xfc, 0x00, 0x7e, 0x1f, 0xe3, 0x0e, 0x60, 0xcc,
+        0x19, 0x83, 0x30, 0xc7, 0xfc, 0xff, 0xd8, 0x1f, 0x01, 0xe0, 0x3c, 0x07,
+        0x80, 0xf0, 0x1e, 0x07, 0xff, 0xdf, 0xf0, 0x00, 0x7f, 0xfc, 0x00, 0xff,
+        0xff, 0xff, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18,
+        0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x7f, 0xff, 0xe0, 0x3f, 0xef, 0xff,
+        0x81, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x81,
+        0xbf, 0xf3, 0xfe, 0x00, 0xc0, 0x18, 0x07, 0x7f, 0xcf, 0xf0, 0x00, 0x7f,
+        0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0xff, 0xff, 0xfe,
+        0x00, 0xc0, 0x18, 0x03, 0x83, 0xbf, 0xe3, 0xf8, 0x00, 0x7f, 0xfc, 0x00,
+        0xc6, 0x3c, 0x63, 0xc6, 0x3e, 0x67, 0x76, 0xe3, 0xfc, 0x1f, 0x83, 0xfc,
+        0x76, 0xee, 0x67, 0xc6, 0x3c, 0x63, 0xc6, 0x30, 0x00, 0x7f, 0xfc, 0x00,
+        0x3f, 0x8f, 0xfb, 0x83, 0x80, 0x30, 0x0e, 0x3f, 0x87, 0xf0, 0x07, 0x00,
+        0x60, 0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0xc0, 0x78,
+        0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f,
+        0x81, 0xbf, 0xf3, 0xfe, 0x07, 0x7f, 0xfc, 0x00, 0x31, 0x87, 0xf0, 0x7c,
+        0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0,
+        0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x00, 0x7f, 0xfc, 0x00, 0xc1, 0xf0,
+        0xec, 0x73, 0x38, 0xdc, 0x3e, 0x0f, 0x03, 0xe0, 0xdc, 0x33, 0x8c, 0x73,
+        0x0e, 0xc1, 0xc0, 0x00, 0x7f, 0xfc, 0x00, 0x0f, 0xe3, 0xfc, 0xe1, 0x98,
+        0x33, 0x06, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0xc1, 0xb8, 0x3e,
+        0x06, 0x00, 0x7f, 0xfc, 0x00, 0xc0, 0x3e, 0x07, 0xf0, 0xff, 0x9f, 0xdf,
+        0xbc, 0xf3, 0xc6, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0,
+        0x30, 0x00, 0x7f, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07,
+        0xff, 0xff, 0xfe, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x06, 0x00,
+        0x7f, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x3c, 0x07, 0x80, 0xf0,
+        0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0x00, 0x7f, 0xfc,
+        0x00, 0xff, 0xff, 0xff, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03,
+        0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x06, 0x00, 0x7f, 0xff, 0xe0, 0xff,
+        0x9f, 0xfb, 0x03, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78,
+        0x0f, 0x03, 0xff, 0xef, 0xf9, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x00,
+        0x00, 0x7f, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x0c, 0x01, 0x80,
+        0x30, 0x06, 0x00, 0xc0, 0x18, 0x03, 0x83, 0xbf, 0xe3, 0xf8, 0x00, 0x7f,
+        0xfc, 0x00, 0xff, 0xff, 0xff, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06,
+        0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x00, 0x7f,
+        0xff, 0xe0, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3c, 0x07, 0x80, 0xf0, 0x1e,
+        0x03, 0xc0, 0x78, 0x0f, 0x81, 0xbf, 0xf3, 0xfe, 0x00, 0xc0, 0x18, 0x07,
+        0x7f, 0xcf, 0xf0, 0x01, 0xff, 0xff, 0x00, 0x06, 0x00, 0x60, 0x3f, 0xc7,
+        0xfe, 0xe6, 0x7c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c,
+        0x63, 0xe6, 0x77, 0xfe, 0x3f, 0xc0, 0x60, 0x06, 0x00, 0x00, 0x7f, 0xfc,
+        0x00, 0xc0, 0x78, 0x0f, 0x83, 0xb8, 0xe3, 0xb8, 0x3e, 0x03, 0x80, 0xf8,
+        0x3b, 0x8e, 0x3b, 0x83, 0xe0, 0x3c, 0x06, 0x00, 0x7f, 0xff, 0xc0, 0xc0,
+        0x6c, 0x06, 0xc0, 0x6c, 0x06, 0xc0, 0x6c, 0x06, 0xc0, 0x6c, 0x06, 0xc0,
+        0x6c, 0x06, 0xe0, 0x67, 0xff, 0x3f, 0xf0, 0x03, 0x00, 0x30, 0x03, 0x00,
+        0x30, 0x00, 0x7f, 0xfc, 0x00, 0xc0, 0x78, 0x0f, 0x01, 0xe0, 0x3e, 0x06,
+        0xff, 0xcf, 0xf8, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00,
+        0x7f, 0xfc, 0x00, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63,
+        0xc6, 0x3c, 0x63, 0xc6, 0x3c, 0x63, 0xe6, 0x37, 0xff, 0x3f, 0xf0, 0x00,
+        0x7f, 0xff, 0xc0, 0xc6, 0x36, 0x31, 0xb1, 0x8d, 0x8c, 0x6c, 0x63, 0x63,
+        0x1b, 0x18, 0xd8, 0xc6, 0xc6, 0x36, 0x31, 0xb9, 0x8c, 0xff, 0xf3, 0xff,
+        0x80, 0x0c, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0x7f, 0xfc, 0x00, 0xf0,
+        0x0f, 0x00, 0x30, 0x03, 0x00, 0x3f, 0xc3, 0xfe, 0x30, 0x73, 0x03, 0x30,
+        0x33, 0x03, 0x30, 0x73, 0xfe, 0x3f, 0xc0, 0x00, 0x7f, 0xfc, 0x00, 0xc0,
+        0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xfe, 0x3f, 0xf3, 0xc3, 0xbc, 0x1b, 0xc1,
+        0xbc, 0x1b, 0xc3, 0xbf, 0xf3, 0xfe, 0x30, 0x00, 0x7f, 0xfc, 0x00, 0xc0,
+        0x30, 0x0c, 0x03, 0x00, 0xff, 0x3f, 0xec, 0x1f, 0x03, 0xc0, 0xf0, 0x3c,
+        0x1f, 0xfe, 0xff, 0x00, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0x8f, 0xfb, 0x83,
+        0x80, 0x30, 0x06, 0x3f, 0xc7, 0xf8, 0x03, 0x00, 0x60, 0x0f, 0x83, 0xbf,
+        0xe3, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0xc3, 0xcc, 0x7e, 0xce, 0x7c, 0xc3,
+        0xcc, 0x3c, 0xc3, 0xfc, 0x3f, 0xc3, 0xcc, 0x3c, 0xc3, 0xce, 0x7c, 0x7e,
+        0xc3, 0xc0, 0x00, 0x7f, 0xfc, 0x00, 0x3f, 0xef, 0xff, 0x81, 0xe0, 0x3c,
+        0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x07, 0x61, 0xcc, 0x71, 0x9c, 0x37, 0x06,
+        0x07, 0x7f, 0xfc, 0x00, 0x38, 0x03, 0x80, 0x38, 0x1f, 0xc7, 0xfd, 0xc1,
+        0xf0, 0x1e, 0x03, 0xff, 0xff, 0xff, 0x00, 0x60, 0x0c, 0x01, 0xc1, 0xdf,
+        0xf1, 0xfc, 0x07, 0x7f, 0xfc, 0x00, 0x31, 0x86, 0x30, 0xc6, 0x1f, 0xc7,
+        0xfd, 0xc1, 0xf0, 0x1e, 0x03, 0xff, 0xff, 0xff, 0x00, 0x60, 0x0c, 0x01,
+        0xc1, 0xdf, 0xf1, 0xfc, 0x0f, 0xff, 0xff, 0xe0, 0x60, 0x0f, 0xf0, 0xff,
+        0x06, 0x00, 0x60, 0x07, 0xfc, 0x7f, 0xe6, 0x07, 0x60, 0x36, 0x03, 0x60,
+        0x36, 0x03, 0x60, 0x36, 0x03, 0x60, 0x36, 0x03, 0x60, 0x36, 0x03, 0x00,
+        0x30, 0x03, 0x00, 0x70, 0x3e, 0x03, 0xc0, 0x07, 0x7f, 0xfc, 0x00, 0x03,
+        0x80, 0xe0, 0x38, 0x7f, 0xff, 0xff, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18,
+        0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0x00, 0x7f, 0xfc,
+        0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xe0, 0x0c, 0x01, 0xfe, 0x3f, 0xc6, 0x00,
+        0xc0, 0x18, 0x03, 0x83, 0xbf, 0xe3, 0xf8, 0x00, 0x7f, 0xfc, 0x00, 0x3f,
+        0x8f, 0xfb, 0x83, 0xe0, 0x0e, 0x00, 0xff, 0x0f, 0xf0, 0x07, 0x00, 0x60,
+        0x0f, 0x83, 0xbf, 0xe3, 0xf8, 0x0e, 0x7f, 0xfc, 0x00, 0x30, 0xc3, 0x3c,
+        0xf0, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xcf, 0xff, 0x07, 0x7f, 0xfc,
+        0x00, 0xc7, 0x8f, 0x1b, 0xc7, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x60, 0xc1,
+        0x83, 0x1f, 0xbf, 0x0e, 0x7f, 0xff, 0xe0, 0x01, 0x80, 0xc0, 0x60, 0xf0,
+        0x78, 0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06,
+        0x03, 0xc1, 0xe0, 0xf8, 0xef, 0xe3, 0xe0, 0x00, 0x7f, 0xfc, 0x00, 0x1f,
+        0x01, 0xf8, 0x1c, 0xc0, 0xc6, 0x06, 0x3e, 0x31, 0xf9, 0x8c, 0xec, 0x63,
+        0x63, 0x1b, 0x18, 0xd8, 0xcf, 0xc7, 0xec, 0x3e, 0x00, 0x00, 0x7f, 0xfc,
+        0x00, 0xc6, 0x0c, 0x60, 0xc6, 0x0c, 0x60, 0xc7, 0xcf, 0xfe, 0xfe, 0x7c,
+        0x63, 0xc6, 0x3c, 0x63, 0xc6, 0x7c, 0x7e, 0xc7, 0xc0, 0x0f, 0xff, 0xfc,
+        0x00, 0x60, 0x0f, 0xf0, 0xff, 0x06, 0x00, 0x60, 0x07, 0xfc, 0x7f, 0xe6,
+        0x07, 0x60, 0x36, 0x03, 0x60, 0x36, 0x03, 0x60, 0x36, 0x03, 0x60, 0x36,
+        0x03, 0x60, 0x36, 0x03, 0x07, 0x7f, 0xfc, 0x00, 0x07, 0x03, 0x81, 0xc3,
+        0x07, 0xc3, 0xb1, 0xcc, 0xe3, 0x70, 0xf8, 0x3c, 0x0f, 0x83, 0x70, 0xce,
+        0x31, 0xcc, 0x3b, 0x07, 0x07, 0x7f, 0xfc, 0x00, 0x38, 0x03, 0x80, 0x38,
+        0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f, 0x01, 0xe0,
+        0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x07, 0x7f, 0xff, 0xe0, 0x31, 0x87,
+        0xf0, 0x7c, 0x60, 0x3c, 0x07, 0x80, 0xf0, 0x1e, 0x03, 0xc0, 0x78, 0x0f,
+        0x01, 0xe0, 0x3c, 0x07, 0xc0, 0xdf, 0xf9, 0xff, 0x00, 0x60, 0x0c, 0x03,
+        0xbf, 0xe7, 0xf8, 0x00, 0x7f, 0xff, 0xc0, 0xc0, 0x3c, 0x03, 0xc0, 0x3c,
+        0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3c, 0x03, 0xc0, 0x3f,
+        0xff, 0xff, 0xf0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00
       },
       (GFXglyph[]){
-        {     0,  14,  28,  14,    0,  -21 },   // 0x400
-        {    49,  14,  28,  14,    0,  -21 },   // 0x401
-        {    98,  14,  28,  14,    0,  -21 },   // 0x402
-        {   147,  14,  28,  14,    0,  -21 },   // 0x403
-        {   196,  14,  28,  14,    0,  -21 },   // 0x404
-        {   245,  14,  28,  14,    0,  -21 },   // 0x405
-        {   294,  14,  28,  14,    0,  -21 },   // 0x406
-        {   343,  14,  28,  14,    0,  -21 },   // 0x407
-        {   392,  14,  28,  14,    0,  -21 },   // 0x408
-        {   441,  14,  28,  14,    0,  -21 },   // 0x409
-        {   490,  14,  28,  14,    0,  -21 },   // 0x40A
-        {   539,  14,  28,  14,    0,  -21 },   // 0x40B
-        {   588,  14,  28,  14,    0,  -21 },   // 0x40C
-        {   637,  14,  28,  14,    0,  -21 },   // 0x40D
-        {   686,  14,  28,  14,    0,  -21 },   // 0x40E
-        {   735,  14,  28,  14,    0,  -21 },   // 0x40F
-        {   784,  14,  28,  14,    0,  -21 },   // 0x410
-        {   833,  14,  28,  14,    0,  -21 },   // 0x411
-        {   882,  14,  28,  14,    0,  -21 },   // 0x412
-        {   931,  14,  28,  14,    0,  -21 },   // 0x413
-        {   980,  14,  28,  14,    0,  -21 },   // 0x414
-        {  1029,  14,  28,  14,    0,  -21 },   // 0x415
-        {  1078,  14,  28,  14,    0,  -21 },   // 0x416
-        {  1127,  14,  28,  14,    0,  -21 },   // 0x417
-        {  1176,  14,  28,  14,    0,  -21 },   // 0x418
-        {  1225,  14,  28,  14,    0,  -21 },   // 0x419
-        {  1274,  14,  28,  14,    0,  -21 },   // 0x41A
-        {  1323,  14,  28,  14,    0,  -21 },   // 0x41B
-        {  1372,  14,  28,  14,    0,  -21 },   // 0x41C
-        {  1421,  14,  28,  14,    0,  -21 },   // 0x41D
-        {  1470,  14,  28,  14,    0,  -21 },   // 0x41E
-        {  1519,  14,  28,  14,    0,  -21 },   // 0x41F
-        {  1568,  14,  28,  14,    0,  -21 },   // 0x420
-        {  1617,  14,  28,  14,    0,  -21 },   // 0x421
-        {  1666,  14,  28,  14,    0,  -21 },   // 0x422
-        {  1715,  14,  28,  14,    0,  -21 },   // 0x423
-        {  1764,  14,  28,  14,    0,  -21 },   // 0x424
-        {  1813,  14,  28,  14,    0,  -21 },   // 0x425
-        {  1862,  14,  28,  14,    0,  -21 },   // 0x426
-        {  1911,  14,  28,  14,    0,  -21 },   // 0x427
-        {  1960,  14,  28,  14,    0,  -21 },   // 0x428
-        {  2009,  14,  28,  14,    0,  -21 },   // 0x429
-        {  2058,  14,  28,  14,    0,  -21 },   // 0x42A
-        {  2107,  14,  28,  14,    0,  -21 },   // 0x42B
-        {  2156,  14,  28,  14,    0,  -21 },   // 0x42C
-        {  2205,  14,  28,  14,    0,  -21 },   // 0x42D
-        {  2254,  14,  28,  14,    0,  -21 },   // 0x42E
-        {  2303,  14,  28,  14,    0,  -21 },   // 0x42F
-        {  2352,  14,  28,  14,    0,  -21 },   // 0x430
-        {  2401,  14,  28,  14,    0,  -21 },   // 0x431
-        {  2450,  14,  28,  14,    0,  -21 },   // 0x432
-        {  2499,  14,  28,  14,    0,  -21 },   // 0x433
-        {  2548,  14,  28,  14,    0,  -21 },   // 0x434
-        {  2597,  14,  28,  14,    0,  -21 },   // 0x435
-        {  2646,  14,  28,  14,    0,  -21 },   // 0x436
-        {  2695,  14,  28,  14,    0,  -21 },   // 0x437
-        {  2744,  14,  28,  14,    0,  -21 },   // 0x438
-        {  2793,  14,  28,  14,    0,  -21 },   // 0x439
-        {  2842,  14,  28,  14,    0,  -21 },   // 0x43A
-        {  2891,  14,  28,  14,    0,  -21 },   // 0x43B
-        {  2940,  14,  28,  14,    0,  -21 },   // 0x43C
-        {  2989,  14,  28,  14,    0,  -21 },   // 0x43D
-        {  3038,  14,  28,  14,    0,  -21 },   // 0x43E
-        {  3087,  14,  28,  14,    0,  -21 },   // 0x43F
-        {  3136,  14,  28,  14,    0,  -21 },   // 0x440
-        {  3185,  14,  28,  14,    0,  -21 },   // 0x441
-        {  3234,  14,  28,  14,    0,  -21 },   // 0x442
-        {  3283,  14,  28,  14,    0,  -21 },   // 0x443
-        {  3332,  14,  28,  14,    0,  -21 },   // 0x444
-        {  3381,  14,  28,  14,    0,  -21 },   // 0x445
-        {  3430,  14,  28,  14,    0,  -21 },   // 0x446
-        {  3479,  14,  28,  14,    0,  -21 },   // 0x447
-        {  3528,  14,  28,  14,    0,  -21 },   // 0x448
-        {  3577,  14,  28,  14,    0,  -21 },   // 0x449
-        {  3626,  14,  28,  14,    0,  -21 },   // 0x44A
-        {  3675,  14,  28,  14,    0,  -21 },   // 0x44B
-        {  3724,  14,  28,  14,    0,  -21 },   // 0x44C
-        {  3773,  14,  28,  14,    0,  -21 },   // 0x44D
-        {  3822,  14,  28,  14,    0,  -21 },   // 0x44E
-        {  3871,  14,  28,  14,    0,  -21 },   // 0x44F
-        {  3920,  14,  28,  14,    0,  -21 },   // 0x450
-        {  3969,  14,  28,  14,    0,  -21 },   // 0x451
-        {  4018,  14,  28,  14,    0,  -21 },   // 0x452
-        {  4067,  14,  28,  14,    0,  -21 },   // 0x453
-        {  4116,  14,  28,  14,    0,  -21 },   // 0x454
-        {  4165,  14,  28,  14,    0,  -21 },   // 0x455
-        {  4214,  14,  28,  14,    0,  -21 },   // 0x456
-        {  4263,  14,  28,  14,    0,  -21 },   // 0x457
-        {  4312,  14,  28,  14,    0,  -21 },   // 0x458
-        {  4361,  14,  28,  14,    0,  -21 },   // 0x459
-        {  4410,  14,  28,  14,    0,  -21 },   // 0x45A
-        {  4459,  14,  28,  14,    0,  -21 },   // 0x45B
-        {  4508,  14,  28,  14,    0,  -21 },   // 0x45C
-        {  4557,  14,  28,  14,    0,  -21 },   // 0x45D
-        {  4606,  14,  28,  14,    0,  -21 },   // 0x45E
-        {  4655,  14,  28,  14,    0,  -21 },   // 0x45F
+        {     0,  11,  28,  14,    1,  -21 },   // 0x400
+        {    33,  11,  28,  14,    1,  -21 },   // 0x401
+        {    66,  12,  28,  14,    0,  -21 },   // 0x402
+        {    97,  11,  28,  14,    1,  -21 },   // 0x403
+        {   130,  11,  28,  14,    1,  -21 },   // 0x404
+        {   159,  11,  28,  14,    1,  -21 },   // 0x405
+        {   188,   6,  28,  14,    4,  -21 },   // 0x406
+        {   206,   7,  28,  14,    3,  -21 },   // 0x407
+        {   229,  12,  28,  14,    1,  -21 },   // 0x408
+        {   260,  13,  28,  14,    0,  -21 },   // 0x409
+        {   294,  12,  28,  14,    1,  -21 },   // 0x40A
+        {   325,  12,  28,  14,    0,  -21 },   // 0x40B
+        {   356,  11,  28,  14,    1,  -21 },   // 0x40C
+        {   389,  11,  28,  14,    1,  -21 },   // 0x40D
+        {   422,  11,  28,  14,    1,  -21 },   // 0x40E
+        {   455,  12,  28,  14,    1,  -21 },   // 0x40F
+        {   492,  11,  28,  14,    1,  -21 },   // 0x410
+        {   521,  11,  28,  14,    1,  -21 },   // 0x411
+        {   550,  11,  28,  14,    1,  -21 },   // 0x412
+        {   579,  11,  28,  14,    1,  -21 },   // 0x413
+        {   608,  12,  28,  14,    1,  -21 },   // 0x414
+        {   644,  11,  28,  14,    1,  -21 },   // 0x415
+        {   673,  12,  28,  14,    1,  -21 },   // 0x416
+        {   704,  11,  28,  14,    1,  -21 },   // 0x417
+        {   733,  11,  28,  14,    1,  -21 },   // 0x418
+        {   762,  11,  28,  14,    1,  -21 },   // 0x419
+        {   795,  11,  28,  14,    1,  -21 },   // 0x41A
+        {   824,  11,  28,  14,    1,  -21 },   // 0x41B
+        {   853,  12,  28,  14,    1,  -21 },   // 0x41C
+        {   884,  11,  28,  14,    1,  -21 },   // 0x41D
+        {   913,  11,  28,  14,    1,  -21 },   // 0x41E
+        {   942,  11,  28,  14,    1,  -21 },   // 0x41F
+        {   971,  11,  28,  14,    1,  -21 },   // 0x420
+        {  1000,  11,  28,  14,    1,  -21 },   // 0x421
+        {  1029,  12,  28,  14,    1,  -21 },   // 0x422
+        {  1060,  11,  28,  14,    1,  -21 },   // 0x423
+        {  1089,  12,  28,  14,    1,  -21 },   // 0x424
+        {  1126,  11,  28,  14,    1,  -21 },   // 0x425
+        {  1155,  12,  28,  14,    1,  -21 },   // 0x426
+        {  1192,  11,  28,  14,    1,  -21 },   // 0x427
+        {  1221,  12,  28,  14,    1,  -21 },   // 0x428
+        {  1252,  13,  28,  14,    1,  -21 },   // 0x429
+        {  1292,  13,  28,  14,    0,  -21 },   // 0x42A
+        {  1326,  12,  28,  14,    1,  -21 },   // 0x42B
+        {  1357,  11,  28,  14,    1,  -21 },   // 0x42C
+        {  1386,  11,  28,  14,    1,  -21 },   // 0x42D
+        {  1415,  12,  28,  14,    1,  -21 },   // 0x42E
+        {  1446,  11,  28,  14,    1,  -21 },   // 0x42F
+        {  1475,  11,  28,  14,    1,  -21 },   // 0x430
+        {  1497,  11,  28,  14,    1,  -21 },   // 0x431
+        {  1526,  11,  28,  14,    1,  -21 },   // 0x432
+        {  1555,  11,  28,  14,    1,  -21 },   // 0x433
+        {  1577,  11,  28,  14,    1,  -21 },   // 0x434
+        {  1606,  11,  28,  14,    1,  -21 },   // 0x435
+        {  1628,  12,  28,  14,    1,  -21 },   // 0x436
+        {  1652,  11,  28,  14,    1,  -21 },   // 0x437
+        {  1674,  11,  28,  14,    1,  -21 },   // 0x438
+        {  1696,  11,  28,  14,    1,  -21 },   // 0x439
+        {  1722,  10,  28,  14,    2,  -21 },   // 0x43A
+        {  1743,  11,  28,  14,    1,  -21 },   // 0x43B
+        {  1765,  12,  28,  14,    1,  -21 },   // 0x43C
+        {  1789,  11,  28,  14,    1,  -21 },   // 0x43D
+        {  1811,  11,  28,  14,    1,  -21 },   // 0x43E
+        {  1833,  11,  28,  14,    1,  -21 },   // 0x43F
+        {  1855,  11,  28,  14,    1,  -21 },   // 0x440
+        {  1884,  11,  28,  14,    1,  -21 },   // 0x441
+        {  1906,  12,  28,  14,    1,  -21 },   // 0x442
+        {  1930,  11,  28,  14,    1,  -21 },   // 0x443
+        {  1959,  12,  28,  14,    1,  -21 },   // 0x444
+        {  1989,  11,  28,  14,    1,  -21 },   // 0x445
+        {  2011,  12,  28,  14,    1,  -21 },   // 0x446
+        {  2041,  11,  28,  14,    1,  -21 },   // 0x447
+        {  2063,  12,  28,  14,    1,  -21 },   // 0x448
+        {  2087,  13,  28,  14,    1,  -21 },   // 0x449
+        {  2119,  12,  28,  14,    0,  -21 },   // 0x44A
+        {  2143,  12,  28,  14,    1,  -21 },   // 0x44B
+        {  2167,  10,  28,  14,    2,  -21 },   // 0x44C
+        {  2188,  11,  28,  14,    1,  -21 },   // 0x44D
+        {  2210,  12,  28,  14,    1,  -21 },   // 0x44E
+        {  2234,  11,  28,  14,    1,  -21 },   // 0x44F
+        {  2256,  11,  28,  14,    1,  -21 },   // 0x450
+        {  2282,  11,  28,  14,    1,  -21 },   // 0x451
+        {  2308,  12,  28,  14,    0,  -21 },   // 0x452
+        {  2347,  11,  28,  14,    1,  -21 },   // 0x453
+        {  2373,  11,  28,  14,    1,  -21 },   // 0x454
+        {  2395,  11,  28,  14,    1,  -21 },   // 0x455
+        {  2417,   6,  28,  14,    4,  -21 },   // 0x456
+        {  2433,   7,  28,  14,    3,  -21 },   // 0x457
+        {  2451,   9,  28,  14,    2,  -21 },   // 0x458
+        {  2479,  13,  28,  14,    0,  -21 },   // 0x459
+        {  2505,  12,  28,  14,    1,  -21 },   // 0x45A
+        {  2529,  12,  28,  14,    0,  -21 },   // 0x45B
+        {  2560,  10,  28,  14,    2,  -21 },   // 0x45C
+        {  2584,  11,  28,  14,    1,  -21 },   // 0x45D
+        {  2610,  11,  28,  14,    1,  -21 },   // 0x45E
+        {  2643,  12,  28,  14,    1,  -21 },   // 0x45F
       },  0x00, 0x5f, 0
 
-    }, 0x400, 0x400, 0x45f
+    }, 0x400, 0x400, 0x45f, true
   },
-  // Approx. 5383 bytes
+  // Approx. 3352 bytes
 
 };
+
+const uint8_t ter_x28b_pcf28pt_index[256] = {
+  0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
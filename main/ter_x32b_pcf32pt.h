@@ -2,1852 +2,1112 @@ const UnicodeFont ter_x32b_pcf32pt[] = {
   {
     {
       (uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x7f, 0xfc,
-        0x7f, 0xfc, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x7f, 0xfc, 0x7f, 0xfc, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x3f, 0xf8, 0x7b, 0xbc,
-        0x73, 0x9c, 0x73, 0x80, 0x73, 0x80, 0x73, 0x80, 0x7b, 0x80, 0x3f, 0xf0,
-        0x1f, 0xf8, 0x03, 0xbc, 0x03, 0x9c, 0x03, 0x9c, 0x03, 0x9c, 0x73, 0x9c,
-        0x7b, 0xbc, 0x3f, 0xf8, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x1c, 0x3f, 0x9c,
-        0x3b, 0xb8, 0x3b, 0xb8, 0x3f, 0xf0, 0x1f, 0x70, 0x00, 0xe0, 0x00, 0xe0,
-        0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x07, 0x00,
-        0x0e, 0xf8, 0x0f, 0xfc, 0x1d, 0xdc, 0x1d, 0xdc, 0x39, 0xfc, 0x38, 0xf8,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0xc0, 0x1f, 0xe0, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70,
-        0x38, 0x70, 0x1c, 0xe0, 0x0f, 0xc0, 0x0f, 0x80, 0x1f, 0xce, 0x38, 0xee,
-        0x70, 0x7c, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x78, 0x7c,
-        0x3f, 0xee, 0x1f, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0xc0,
-        0x03, 0x80, 0x07, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
-        0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
-        0x0e, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x00, 0xe0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0xe0,
-        0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0,
-        0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80,
-        0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x38, 0x38, 0x1c, 0x70, 0x0e, 0xe0, 0x07, 0xc0, 0x03, 0x80, 0x7f, 0xfc,
-        0x7f, 0xfc, 0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70, 0x38, 0x38,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x7f, 0xfc, 0x7f, 0xfc, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc,
-        0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70,
-        0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0x80,
-        0x07, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x1c, 0x00,
-        0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x3c, 0x70, 0x7c, 0x70, 0xfc, 0x71, 0xdc, 0x73, 0x9c,
-        0x77, 0x1c, 0x7e, 0x1c, 0x7c, 0x1c, 0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0x80,
-        0x0f, 0x80, 0x1f, 0x80, 0x1f, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
-        0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x0f, 0xf8,
-        0x0f, 0xf8, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3c,
-        0x00, 0x7c, 0x00, 0xfc, 0x01, 0xdc, 0x03, 0x9c, 0x07, 0x1c, 0x0e, 0x1c,
-        0x1c, 0x1c, 0x38, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc,
-        0x7f, 0xfc, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x7f, 0xf0, 0x7f, 0xf8, 0x00, 0x3c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x3f, 0xf8, 0x78, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xf0, 0x7f, 0xf8,
-        0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x38, 0x00, 0x38, 0x00, 0x70,
-        0x00, 0x70, 0x00, 0xe0, 0x00, 0xe0, 0x01, 0xc0, 0x01, 0xc0, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x3f, 0xf8, 0x78, 0x3c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0,
-        0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00,
-        0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xc0,
-        0x00, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xc0,
-        0x00, 0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x38,
-        0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00,
-        0x1c, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0,
-        0x01, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x3f, 0xfc,
-        0x78, 0x0e, 0x70, 0x06, 0x71, 0xfe, 0x73, 0xfe, 0x77, 0x8e, 0x77, 0x0e,
-        0x77, 0x0e, 0x77, 0x0e, 0x77, 0x0e, 0x77, 0x0e, 0x77, 0x0e, 0x77, 0x9e,
-        0x73, 0xfe, 0x71, 0xf6, 0x70, 0x00, 0x78, 0x00, 0x3f, 0xfe, 0x1f, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x38, 0x7f, 0xf0, 0x7f, 0xf0,
-        0x70, 0x38, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xc0, 0x7f, 0xf0, 0x70, 0x78, 0x70, 0x38, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x38, 0x70, 0x78,
-        0x7f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xe0,
-        0x7f, 0xe0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x7f, 0xe0, 0x7f, 0xe0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x71, 0xfc, 0x71, 0xfc, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc,
-        0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x0f, 0xe0,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0xfe, 0x00, 0xfe, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-        0x00, 0x38, 0x00, 0x38, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x78, 0x78,
-        0x3f, 0xf0, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x0c, 0x70, 0x1c, 0x70, 0x38, 0x70, 0x70,
-        0x70, 0xe0, 0x71, 0xc0, 0x73, 0x80, 0x77, 0x00, 0x7e, 0x00, 0x7c, 0x00,
-        0x7c, 0x00, 0x7e, 0x00, 0x77, 0x00, 0x73, 0x80, 0x71, 0xc0, 0x70, 0xe0,
-        0x70, 0x70, 0x70, 0x38, 0x70, 0x1c, 0x70, 0x0c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x0e, 0x70, 0x0e, 0x78, 0x1e, 0x7c, 0x3e, 0x7e, 0x7e, 0x7e, 0x7e,
-        0x77, 0xee, 0x73, 0xce, 0x73, 0xce, 0x71, 0x8e, 0x70, 0x0e, 0x70, 0x0e,
-        0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e,
-        0x70, 0x0e, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x7c, 0x1c, 0x7e, 0x1c, 0x77, 0x1c, 0x73, 0x9c,
-        0x71, 0xdc, 0x70, 0xfc, 0x70, 0x7c, 0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x73, 0x9c, 0x79, 0xfc, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x38, 0x00, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x7f, 0xf8,
-        0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0, 0x7e, 0x00, 0x77, 0x00,
-        0x73, 0x80, 0x71, 0xc0, 0x70, 0xe0, 0x70, 0x70, 0x70, 0x38, 0x70, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3f, 0xf0, 0x1f, 0xf8, 0x00, 0x3c,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x38, 0x38,
-        0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x1c, 0x70, 0x0e, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x07, 0xc0,
-        0x07, 0xc0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e,
-        0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e,
-        0x71, 0x8e, 0x73, 0xce, 0x73, 0xce, 0x77, 0xee, 0x7e, 0x7e, 0x7e, 0x7e,
-        0x7c, 0x3e, 0x78, 0x1e, 0x70, 0x0e, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x38, 0x38, 0x38, 0x38, 0x1c, 0x70, 0x1c, 0x70, 0x0e, 0xe0, 0x0e, 0xe0,
-        0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x0e, 0xe0, 0x0e, 0xe0,
-        0x1c, 0x70, 0x1c, 0x70, 0x38, 0x38, 0x38, 0x38, 0x70, 0x1c, 0x70, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x38, 0x38, 0x38, 0x38, 0x1c, 0x70,
-        0x1c, 0x70, 0x0e, 0xe0, 0x0e, 0xe0, 0x07, 0xc0, 0x07, 0xc0, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80,
-        0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
-        0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
-        0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00,
-        0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0f, 0xf0, 0x0f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x38, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x0e, 0x00,
-        0x07, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x01, 0xc0, 0x01, 0xc0,
-        0x00, 0xe0, 0x00, 0xe0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38, 0x00, 0x38,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x70, 0x00, 0x70,
-        0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
-        0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70,
-        0x00, 0x70, 0x00, 0x70, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70,
-        0x38, 0x38, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00,
-        0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf8,
-        0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c, 0x1f, 0xfc, 0x3f, 0xfc, 0x78, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c,
-        0x7f, 0xf8, 0x7f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x1f, 0xfc, 0x3f, 0xfc,
-        0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x01, 0xfe, 0x03, 0xc0, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x3f, 0xf8, 0x3f, 0xf8, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x3f, 0xfc,
-        0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38,
-        0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xf8,
-        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-        0x38, 0x38, 0x38, 0x38, 0x3c, 0x78, 0x1f, 0xf0, 0x0f, 0xe0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
-        0x38, 0x1c, 0x38, 0x38, 0x38, 0x70, 0x38, 0xe0, 0x39, 0xc0, 0x3b, 0x80,
-        0x3f, 0x00, 0x3f, 0x00, 0x3b, 0x80, 0x39, 0xc0, 0x38, 0xe0, 0x38, 0x70,
-        0x38, 0x38, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x7f, 0xf8,
-        0x73, 0xbc, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x7f, 0xf8,
-        0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xfc, 0x3f, 0xfc, 0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x73, 0xfc, 0x77, 0xfc, 0x7e, 0x00, 0x7c, 0x00,
-        0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3f, 0xf0, 0x1f, 0xf8,
-        0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
-        0x7f, 0xf0, 0x7f, 0xf0, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
-        0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80,
-        0x03, 0xfc, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x0e, 0xe0, 0x0e, 0xe0, 0x07, 0xc0, 0x07, 0xc0, 0x07, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x7b, 0xbc,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x38, 0x38,
-        0x1c, 0x70, 0x0e, 0xe0, 0x07, 0xc0, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70,
-        0x38, 0x38, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
-        0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x03, 0xf0, 0x07, 0x80, 0x07, 0x00,
-        0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x3e, 0x00,
-        0x3e, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
-        0x07, 0x00, 0x07, 0x80, 0x03, 0xf0, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3e, 0x00, 0x3f, 0x00, 0x07, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x01, 0xf0, 0x01, 0xf0, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x80,
-        0x3f, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1e, 0x1c, 0x3f, 0x1c, 0x77, 0x9c, 0x73, 0xdc, 0x71, 0xf8, 0x70, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+        0x03, 0xff, 0xe3, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f,
+        0xc0, 0x00, 0x00, 0xe3, 0xf1, 0xf8, 0xfc, 0x7e, 0x3f, 0x1c, 0x03, 0xff,
+        0xff, 0xc0, 0x38, 0xe1, 0xc7, 0x0e, 0x38, 0x71, 0xc3, 0x8e, 0x7f, 0xff,
+        0xff, 0xe7, 0x1c, 0x38, 0xe1, 0xc7, 0x0e, 0x38, 0x71, 0xc3, 0x8e, 0x7f,
+        0xff, 0xff, 0xe7, 0x1c, 0x38, 0xe1, 0xc7, 0x0e, 0x38, 0x71, 0xc0, 0x0f,
+        0xff, 0xff, 0xf0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x7f, 0xc7, 0xff, 0x7b,
+        0xbf, 0x9c, 0xfc, 0xe0, 0xe7, 0x07, 0x38, 0x3d, 0xc0, 0xff, 0xc3, 0xff,
+        0x03, 0xbc, 0x1c, 0xe0, 0xe7, 0x07, 0x3f, 0x39, 0xfd, 0xde, 0xff, 0xe3,
+        0xfe, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x03, 0xff, 0xff, 0xc0, 0x7c, 0x7f,
+        0xe7, 0xee, 0xee, 0xee, 0xff, 0xc7, 0xdc, 0x03, 0x80, 0x38, 0x07, 0x00,
+        0x70, 0x0e, 0x00, 0xe0, 0x1c, 0x01, 0xc0, 0x3b, 0xe3, 0xff, 0x77, 0x77,
+        0x77, 0xe7, 0xfe, 0x3e, 0x03, 0xff, 0xff, 0xc0, 0x1f, 0x80, 0xff, 0x07,
+        0x0e, 0x1c, 0x38, 0x70, 0xe1, 0xc3, 0x87, 0x0e, 0x0e, 0x70, 0x1f, 0x80,
+        0x7c, 0x03, 0xf9, 0xdc, 0x77, 0xe0, 0xfb, 0x81, 0xce, 0x07, 0x38, 0x1c,
+        0xe0, 0x73, 0xc3, 0xe7, 0xfd, 0xcf, 0xe7, 0x0f, 0xc0, 0x00, 0x00, 0xff,
+        0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x0e, 0x38, 0xe3, 0x87, 0x1c, 0x38,
+        0x70, 0xe1, 0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x38, 0x70, 0x70, 0x70, 0x70,
+        0x03, 0xff, 0xff, 0xc0, 0xe0, 0xe0, 0xe0, 0xe1, 0xc1, 0xc3, 0x87, 0x0e,
+        0x1c, 0x38, 0x70, 0xe1, 0xc3, 0x8e, 0x1c, 0x71, 0xc7, 0x00, 0x00, 0x3f,
+        0xfc, 0x00, 0x70, 0x71, 0xc7, 0x07, 0x70, 0x1f, 0x00, 0x70, 0x7f, 0xff,
+        0xff, 0xe0, 0xe0, 0x0f, 0x80, 0xee, 0x0e, 0x38, 0xe0, 0xe0, 0x00, 0x3f,
+        0xfc, 0x00, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x7f, 0xff,
+        0xff, 0xe0, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x00, 0x00,
+        0x03, 0xf0, 0x39, 0xce, 0x77, 0x70, 0x00, 0x01, 0x80, 0x00, 0xff, 0xff,
+        0xff, 0xc0, 0x00, 0x00, 0x03, 0xc0, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xc0,
+        0x00, 0x70, 0x07, 0x00, 0xe0, 0x0e, 0x01, 0xc0, 0x1c, 0x03, 0x80, 0x38,
+        0x07, 0x00, 0x70, 0x0e, 0x00, 0xe0, 0x1c, 0x01, 0xc0, 0x38, 0x03, 0x80,
+        0x70, 0x07, 0x00, 0xe0, 0x0e, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3,
+        0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x3f, 0x83, 0xfc, 0x3f, 0xe3,
+        0xbf, 0x39, 0xfb, 0x8f, 0xf8, 0x7f, 0x83, 0xf8, 0x1f, 0x80, 0xfc, 0x07,
+        0xe0, 0x3f, 0x83, 0xdf, 0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x1c,
+        0x1e, 0x1f, 0x1f, 0x8f, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03,
+        0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x3f, 0xff, 0xf0, 0x03, 0xff,
+        0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f,
+        0x80, 0xe0, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x70, 0x07,
+        0x00, 0x70, 0x07, 0x00, 0x70, 0x07, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0x03,
+        0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0x80,
+        0x1c, 0x00, 0xe0, 0x07, 0x00, 0x78, 0xff, 0x87, 0xfc, 0x00, 0xf0, 0x03,
+        0x80, 0x1c, 0x00, 0xfc, 0x07, 0xe0, 0x3f, 0x83, 0xdf, 0xfc, 0x7f, 0xc0,
+        0x03, 0xff, 0xff, 0xc0, 0x00, 0x38, 0x03, 0xc0, 0x3e, 0x03, 0xf0, 0x3b,
+        0x83, 0x9c, 0x38, 0xe3, 0x87, 0x38, 0x3b, 0x81, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xff, 0xff, 0xff, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00,
+        0x70, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xc0, 0x0e,
+        0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xff, 0xe7, 0xff, 0x80, 0x1e, 0x00,
+        0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0xe0, 0x3f, 0x81, 0xdf, 0xfc,
+        0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xf3, 0xff, 0xbc, 0x01, 0xc0,
+        0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xff, 0xe7, 0xff, 0xb8, 0x1f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x83, 0xdf,
+        0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x38, 0x01, 0xc0, 0x1c, 0x00, 0xe0, 0x0e, 0x00,
+        0x70, 0x07, 0x00, 0x38, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38,
+        0x01, 0xc0, 0x0e, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc,
+        0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xf0, 0x7b, 0xff,
+        0x9f, 0xfd, 0xe0, 0xfe, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x83, 0xdf, 0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff,
+        0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x81, 0xdf, 0xfe, 0x7f, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00,
+        0x38, 0x03, 0xdf, 0xfc, 0xff, 0xc0, 0x00, 0x0f, 0x03, 0xc0, 0xff, 0xff,
+        0xff, 0x00, 0x0f, 0x03, 0xf0, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x77, 0x00,
+        0x03, 0xff, 0xff, 0xc0, 0x00, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00,
+        0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01,
+        0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x0c,
+        0x30, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff,
+        0xc0, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80,
+        0x1c, 0x00, 0xe0, 0x07, 0x00, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00,
+        0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x00, 0x03, 0xff, 0xf3, 0xc0, 0x3f,
+        0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xe0, 0x0e,
+        0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00,
+        0xe0, 0x07, 0x00, 0x38, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xf1, 0xff,
+        0xef, 0x01, 0xf8, 0x03, 0xe3, 0xff, 0x9f, 0xfe, 0xf1, 0xfb, 0x87, 0xee,
+        0x1f, 0xb8, 0x7e, 0xe1, 0xfb, 0x87, 0xee, 0x1f, 0xbc, 0xfe, 0x7f, 0xf8,
+        0xfb, 0xe0, 0x03, 0xc0, 0x07, 0xff, 0xcf, 0xff, 0x03, 0xff, 0xff, 0xc0,
+        0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc,
+        0x07, 0xe0, 0x3f, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xf0, 0x1f, 0x80,
+        0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x70, 0x03, 0xff, 0xff,
+        0xc0, 0xff, 0xe7, 0xff, 0xb8, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80,
+        0xfc, 0x0e, 0xff, 0xe7, 0xff, 0x38, 0x1d, 0xc0, 0x7e, 0x03, 0xf0, 0x1f,
+        0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x03, 0xff, 0xfd, 0xff, 0xc0, 0x03, 0xff,
+        0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x03,
+        0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70,
+        0x03, 0x80, 0x1c, 0x07, 0xe0, 0x3f, 0x83, 0xdf, 0xfc, 0x7f, 0xc0, 0x03,
+        0xff, 0xff, 0xc0, 0xff, 0x87, 0xff, 0x38, 0x3d, 0xc0, 0xee, 0x03, 0xf0,
+        0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x77, 0x07, 0xbf, 0xf9, 0xff, 0x00,
+        0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xc0, 0x0e, 0x00,
+        0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0xfe, 0x3f, 0xf1, 0xc0, 0x0e,
+        0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x3f, 0xff, 0xff,
+        0xf0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xc0, 0x0e,
+        0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0xfe, 0x3f, 0xf1, 0xc0,
+        0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01,
+        0xc0, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x1f, 0xf8, 0xff,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x83, 0xdf,
+        0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0xff, 0xff,
+        0xff, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01,
+        0xf8, 0x0f, 0xc0, 0x70, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xfc, 0xe1, 0xc3,
+        0x87, 0x0e, 0x1c, 0x38, 0x70, 0xe1, 0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x73,
+        0xff, 0xf0, 0x03, 0xff, 0xff, 0xc0, 0x01, 0xfc, 0x07, 0xf0, 0x07, 0x00,
+        0x1c, 0x00, 0x70, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x01, 0xc0,
+        0x07, 0x00, 0x1c, 0x00, 0x70, 0x01, 0xce, 0x07, 0x38, 0x1c, 0xe0, 0x73,
+        0xc3, 0xc7, 0xfe, 0x0f, 0xf0, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x1f, 0x01,
+        0xf8, 0x1d, 0xc1, 0xce, 0x1c, 0x71, 0xc3, 0x9c, 0x1d, 0xc0, 0xfc, 0x07,
+        0xc0, 0x3e, 0x01, 0xf8, 0x0e, 0xe0, 0x73, 0x83, 0x8e, 0x1c, 0x38, 0xe0,
+        0xe7, 0x03, 0xb8, 0x0f, 0xc0, 0x30, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x07,
+        0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00,
+        0xe0, 0x07, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xc0, 0xe0,
+        0x1f, 0x80, 0x7f, 0x03, 0xfe, 0x1f, 0xfc, 0xff, 0xf3, 0xfe, 0xfd, 0xf9,
+        0xe7, 0xe7, 0x9f, 0x8c, 0x7e, 0x01, 0xf8, 0x07, 0xe0, 0x1f, 0x80, 0x7e,
+        0x01, 0xf8, 0x07, 0xe0, 0x1f, 0x80, 0x7e, 0x01, 0xf8, 0x07, 0x03, 0xff,
+        0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x1f,
+        0xe0, 0xff, 0x87, 0xee, 0x3f, 0x39, 0xf8, 0xef, 0xc3, 0xfe, 0x0f, 0xf0,
+        0x3f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x70, 0x03,
+        0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x83, 0xdf, 0xfc, 0x7f, 0xc0,
+        0x03, 0xff, 0xff, 0xc0, 0xff, 0xe7, 0xff, 0xb8, 0x1f, 0xc0, 0x7e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x03, 0xff, 0xfd, 0xff, 0xce,
+        0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0,
+        0x00, 0x03, 0xff, 0xff, 0xf0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe7, 0x3f, 0x9f, 0xdf, 0xfc,
+        0x7f, 0xc0, 0x07, 0x00, 0x1c, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xe7, 0xff,
+        0xb8, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x03, 0xff, 0xfd, 0xff, 0xcf, 0xc0, 0x77, 0x03, 0x9c, 0x1c, 0x70, 0xe1,
+        0xc7, 0x07, 0x38, 0x1d, 0xc0, 0x70, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3,
+        0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xf0,
+        0x03, 0xff, 0x0f, 0xfc, 0x00, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xfc, 0x07,
+        0xe0, 0x3f, 0x83, 0xdf, 0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xff,
+        0xff, 0xff, 0xc1, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00,
+        0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x03, 0xff, 0xff, 0xc0,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc,
+        0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80,
+        0xfc, 0x07, 0xe0, 0x3f, 0x83, 0xdf, 0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff,
+        0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xb8, 0x39, 0xc1,
+        0xce, 0x0e, 0x70, 0x73, 0x83, 0x8e, 0x38, 0x71, 0xc3, 0x8e, 0x1c, 0x70,
+        0x77, 0x03, 0xb8, 0x1d, 0xc0, 0x7c, 0x03, 0xe0, 0x1f, 0x00, 0x03, 0xff,
+        0xff, 0xc0, 0xe0, 0x1f, 0x80, 0x7e, 0x01, 0xf8, 0x07, 0xe0, 0x1f, 0x80,
+        0x7e, 0x01, 0xf8, 0x07, 0xe0, 0x1f, 0x80, 0x7e, 0x31, 0xf9, 0xe7, 0xe7,
+        0x9f, 0xbf, 0x7f, 0xcf, 0xff, 0x3f, 0xf8, 0x7f, 0xc0, 0xfe, 0x01, 0xf8,
+        0x07, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xdc, 0x1c, 0xe0, 0xe3,
+        0x8e, 0x1c, 0x70, 0x77, 0x03, 0xb8, 0x0f, 0x80, 0x7c, 0x03, 0xe0, 0x1f,
+        0x01, 0xdc, 0x0e, 0xe0, 0xe3, 0x87, 0x1c, 0x70, 0x73, 0x83, 0xb8, 0x0f,
+        0xc0, 0x70, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0e, 0xe0,
+        0xe7, 0x07, 0x1c, 0x70, 0xe3, 0x83, 0xb8, 0x1d, 0xc0, 0x7c, 0x03, 0xe0,
+        0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01,
+        0xc0, 0x0e, 0x00, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0x0e,
+        0x00, 0x70, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03,
+        0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00,
+        0x3f, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xe0, 0xe0,
+        0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+        0xe0, 0xe0, 0xff, 0xff, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x0e, 0x00, 0x70,
+        0x07, 0x00, 0x38, 0x03, 0x80, 0x1c, 0x01, 0xc0, 0x0e, 0x00, 0xe0, 0x07,
+        0x00, 0x70, 0x03, 0x80, 0x38, 0x01, 0xc0, 0x1c, 0x00, 0xe0, 0x0e, 0x00,
+        0x70, 0x07, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0x07, 0x07, 0x07, 0x07,
+        0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
+        0xff, 0xff, 0x0f, 0xc0, 0x00, 0x00, 0x07, 0x00, 0x7c, 0x07, 0x70, 0x71,
+        0xc7, 0x07, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x18, 0xff, 0xff, 0xff, 0xc0,
+        0x3c, 0x00, 0x00, 0x00, 0xe1, 0xc3, 0x87, 0x00, 0x0f, 0xff, 0xc0, 0x7f,
+        0xe3, 0xff, 0x80, 0x1e, 0x00, 0x70, 0x03, 0x9f, 0xfd, 0xff, 0xfe, 0x07,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xe0, 0x77, 0xff, 0x9f, 0xfc, 0x03, 0xff,
+        0xff, 0xc0, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03,
+        0xff, 0x9f, 0xfe, 0xe0, 0x7f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x03, 0xff, 0xfd, 0xff, 0xc0, 0x00,
+        0x0f, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x00, 0x70,
+        0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x0f, 0xe0, 0xf7, 0xff,
+        0x1f, 0xf0, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00,
+        0x70, 0x03, 0x80, 0x1c, 0xff, 0xef, 0xff, 0xf0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x81, 0xdf,
+        0xfe, 0x7f, 0xf0, 0x00, 0x0f, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x07, 0x00, 0x38,
+        0x01, 0xe0, 0x77, 0xff, 0x9f, 0xf8, 0x03, 0xff, 0xff, 0xc0, 0x03, 0xf8,
+        0x3f, 0xc3, 0xc0, 0x1c, 0x00, 0xe0, 0x07, 0x03, 0xff, 0x9f, 0xfc, 0x0e,
+        0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0,
+        0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x3f,
+        0xfb, 0xff, 0xfc, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xe0, 0x77, 0xff, 0x9f, 0xfc, 0x00, 0xe0,
+        0x07, 0x00, 0x7b, 0xff, 0x9f, 0xf8, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x07,
+        0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0xff, 0x9f, 0xfe, 0xe0,
+        0x7f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x70, 0x03, 0xcf, 0xff, 0xc0, 0x38,
+        0x70, 0xe1, 0xcf, 0x9f, 0x0e, 0x1c, 0x38, 0x70, 0xe1, 0xc3, 0x87, 0x0e,
+        0x1c, 0xff, 0xfc, 0x03, 0xcf, 0xff, 0xfe, 0x00, 0xe0, 0x1c, 0x03, 0x80,
+        0x70, 0x3e, 0x07, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70,
+        0x0e, 0x01, 0xc0, 0x38, 0x07, 0x00, 0xe0, 0x1f, 0x83, 0xf0, 0x7f, 0x1e,
+        0xff, 0x8f, 0xe0, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x0e, 0x00, 0xe0, 0x0e,
+        0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x7e, 0x0e, 0xe1, 0xce, 0x38, 0xe7, 0x0e,
+        0xe0, 0xfc, 0x0f, 0xc0, 0xee, 0x0e, 0x70, 0xe3, 0x8e, 0x1c, 0xe0, 0xee,
+        0x07, 0x03, 0xff, 0xff, 0xc0, 0xf9, 0xf0, 0xe1, 0xc3, 0x87, 0x0e, 0x1c,
+        0x38, 0x70, 0xe1, 0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x73, 0xff, 0xf0, 0x00,
+        0x0f, 0xff, 0xc0, 0xff, 0xe7, 0xff, 0xb9, 0xdf, 0xce, 0x7e, 0x73, 0xf3,
+        0x9f, 0x9c, 0xfc, 0xe7, 0xe7, 0x3f, 0x39, 0xf9, 0xcf, 0xce, 0x7e, 0x73,
+        0xf3, 0x9c, 0x00, 0x0f, 0xff, 0xc0, 0xff, 0xe7, 0xff, 0xb8, 0x1f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1c, 0x00, 0x0f, 0xff, 0xc0, 0x3f, 0xe3, 0xff,
+        0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x01, 0xf8, 0x0f, 0xe0, 0xf7, 0xff, 0x1f, 0xf0, 0x00, 0x0f, 0xff, 0xfe,
+        0xff, 0xe7, 0xff, 0xb8, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc,
+        0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0xff, 0xff, 0x7f, 0xf3, 0x80,
+        0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x3f,
+        0xfb, 0xff, 0xfc, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xe0, 0x77, 0xff, 0x9f, 0xfc, 0x00, 0xe0,
+        0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x0f, 0xff, 0xc0, 0xe7, 0xff,
+        0x7f, 0xff, 0x01, 0xf0, 0x0f, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x00, 0x00, 0x0f, 0xff,
+        0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x0e, 0x00, 0x78, 0x01, 0xff,
+        0x87, 0xfe, 0x00, 0x78, 0x01, 0xc0, 0x0f, 0xe0, 0xf7, 0xff, 0x1f, 0xf0,
+        0x03, 0xff, 0xff, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0x03, 0xff, 0x9f, 0xfc, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00,
+        0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x78, 0x01, 0xfe, 0x07,
+        0xf0, 0x00, 0x0f, 0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xe0,
+        0x77, 0xff, 0x9f, 0xfc, 0x00, 0x0f, 0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8,
+        0x0e, 0xe0, 0xe7, 0x07, 0x38, 0x38, 0xe3, 0x87, 0x1c, 0x38, 0xe0, 0xee,
+        0x07, 0x70, 0x1f, 0x00, 0xf8, 0x07, 0xc0, 0x00, 0x0f, 0xff, 0xc0, 0xe0,
+        0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x73, 0xf3, 0x9f, 0x9c, 0xfc, 0xe7,
+        0xe7, 0x3f, 0x39, 0xf9, 0xcf, 0xee, 0xf7, 0xff, 0x1f, 0xf0, 0x00, 0x0f,
+        0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0e, 0xe0, 0xe3, 0x8e, 0x0e, 0xe0,
+        0x3e, 0x01, 0xf0, 0x1d, 0xc1, 0xc7, 0x1c, 0x1d, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1c, 0x00, 0x0f, 0xff, 0xfe, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xe0,
+        0x77, 0xff, 0x9f, 0xfc, 0x00, 0xe0, 0x07, 0x00, 0x7b, 0xff, 0x9f, 0xf8,
+        0x00, 0x0f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xc0, 0x1c, 0x01, 0xc0, 0x1c,
+        0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x0f,
+        0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xc0, 0x07, 0xc3, 0xf1, 0xe0, 0x70,
+        0x1c, 0x07, 0x01, 0xc0, 0x70, 0x1c, 0x3e, 0x0f, 0x80, 0x70, 0x1c, 0x07,
+        0x01, 0xc0, 0x70, 0x1c, 0x07, 0x80, 0xfc, 0x1f, 0x03, 0xff, 0xff, 0xc0,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xc0,
+        0xf8, 0x3f, 0x01, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x01,
+        0xf0, 0x7c, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x07, 0x8f, 0xc3,
+        0xe0, 0x0f, 0xc0, 0x00, 0x00, 0x3c, 0x3b, 0xf1, 0xfb, 0xcf, 0xcf, 0x7e,
+        0x3f, 0x70, 0xf0
       },
       (GFXglyph[]){
-        {     0,  10,  32,  10,    0,  -25 },   // 0x20 ' '
-        {    64,  16,  32,  16,    0,  -25 },   // 0x21 '!'
-        {   128,  16,  32,  16,    0,  -25 },   // 0x22 '"'
-        {   192,  16,  32,  16,    0,  -25 },   // 0x23 '#'
-        {   256,  16,  32,  16,    0,  -25 },   // 0x24 '$'
-        {   320,  16,  32,  16,    0,  -25 },   // 0x25 '%'
-        {   384,  16,  32,  16,    0,  -25 },   // 0x26 '&'
-        {   448,  16,  32,  16,    0,  -25 },   // 0x27 '''
-        {   512,  16,  32,  16,    0,  -25 },   // 0x28 '('
-        {   576,  16,  32,  16,    0,  -25 },   // 0x29 ')'
-        {   640,  16,  32,  16,    0,  -25 },   // 0x2A '*'
-        {   704,  16,  32,  16,    0,  -25 },   // 0x2B '+'
-        {   768,  16,  32,  16,    0,  -25 },   // 0x2C ','
-        {   832,  16,  32,  16,    0,  -25 },   // 0x2D '-'
-        {   896,  16,  32,  16,    0,  -25 },   // 0x2E '.'
-        {   960,  16,  32,  16,    0,  -25 },   // 0x2F '/'
-        {  1024,  16,  32,  16,    0,  -25 },   // 0x30 '0'
-        {  1088,  16,  32,  16,    0,  -25 },   // 0x31 '1'
-        {  1152,  16,  32,  16,    0,  -25 },   // 0x32 '2'
-        {  1216,  16,  32,  16,    0,  -25 },   // 0x33 '3'
-        {  1280,  16,  32,  16,    0,  -25 },   // 0x34 '4'
-        {  1344,  16,  32,  16,    0,  -25 },   // 0x35 '5'
-        {  1408,  16,  32,  16,    0,  -25 },   // 0x36 '6'
-        {  1472,  16,  32,  16,    0,  -25 },   // 0x37 '7'
-        {  1536,  16,  32,  16,    0,  -25 },   // 0x38 '8'
-        {  1600,  16,  32,  16,    0,  -25 },   // 0x39 '9'
-        {  1664,  16,  32,  16,    0,  -25 },   // 0x3A ':'
-        {  1728,  16,  32,  16,    0,  -25 },   // 0x3B ';'
-        {  1792,  16,  32,  16,    0,  -25 },   // 0x3C '<'
-        {  1856,  16,  32,  16,    0,  -25 },   // 0x3D '='
-        {  1920,  16,  32,  16,    0,  -25 },   // 0x3E '>'
-        {  1984,  16,  32,  16,    0,  -25 },   // 0x3F '?'
-        {  2048,  16,  32,  16,    0,  -25 },   // 0x40 '@'
-        {  2112,  16,  32,  16,    0,  -25 },   // 0x41 'A'
-        {  2176,  16,  32,  16,    0,  -25 },   // 0x42 'B'
-        {  2240,  16,  32,  16,    0,  -25 },   // 0x43 'C'
-        {  2304,  16,  32,  16,    0,  -25 },   // 0x44 'D'
-        {  2368,  16,  32,  16,    0,  -25 },   // 0x45 'E'
-        {  2432,  16,  32,  16,    0,  -25 },   // 0x46 'F'
-        {  2496,  16,  32,  16,    0,  -25 },   // 0x47 'G'
-        {  2560,  16,  32,  16,    0,  -25 },   // 0x48 'H'
-        {  2624,  16,  32,  16,    0,  -25 },   // 0x49 'I'
-        {  2688,  16,  32,  16,    0,  -25 },   // 0x4A 'J'
-        {  2752,  16,  32,  16,    0,  -25 },   // 0x4B 'K'
-        {  2816,  16,  32,  16,    0,  -25 },   // 0x4C 'L'
-        {  2880,  16,  32,  16,    0,  -25 },   // 0x4D 'M'
-        {  2944,  16,  32,  16,    0,  -25 },   // 0x4E 'N'
-        {  3008,  16,  32,  16,    0,  -25 },   // 0x4F 'O'
-        {  3072,  16,  32,  16,    0,  -25 },   // 0x50 'P'
-        {  3136,  16,  32,  16,    0,  -25 },   // 0x51 'Q'
-        {  3200,  16,  32,  16,    0,  -25 },   // 0x52 'R'
-        {  3264,  16,  32,  16,    0,  -25 },   // 0x53 'S'
-        {  3328,  16,  32,  16,    0,  -25 },   // 0x54 'T'
-        {  3392,  16,  32,  16,    0,  -25 },   // 0x55 'U'
-        {  3456,  16,  32,  16,    0,  -25 },   // 0x56 'V'
-        {  3520,  16,  32,  16,    0,  -25 },   // 0x57 'W'
-        {  3584,  16,  32,  16,    0,  -25 },   // 0x58 'X'
-        {  3648,  16,  32,  16,    0,  -25 },   // 0x59 'Y'
-        {  3712,  16,  32,  16,    0,  -25 },   // 0x5A 'Z'
-        {  3776,  16,  32,  16,    0,  -25 },   // 0x5B '['
-        {  3840,  16,  32,  16,    0,  -25 },   // 0x5C '\'
-        {  3904,  16,  32,  16,    0,  -25 },   // 0x5D ']'
-        {  3968,  16,  32,  16,    0,  -25 },   // 0x5E '^'
-        {  4032,  16,  32,  16,    0,  -25 },   // 0x5F '_'
-        {  4096,  16,  32,  16,    0,  -25 },   // 0x60 '`'
-        {  4160,  16,  32,  16,    0,  -25 },   // 0x61 'a'
-        {  4224,  16,  32,  16,    0,  -25 },   // 0x62 'b'
-        {  4288,  16,  32,  16,    0,  -25 },   // 0x63 'c'
-        {  4352,  16,  32,  16,    0,  -25 },   // 0x64 'd'
-        {  4416,  16,  32,  16,    0,  -25 },   // 0x65 'e'
-        {  4480,  16,  32,  16,    0,  -25 },   // 0x66 'f'
-        {  4544,  16,  32,  16,    0,  -25 },   // 0x67 'g'
-        {  4608,  16,  32,  16,    0,  -25 },   // 0x68 'h'
-        {  4672,  16,  32,  16,    0,  -25 },   // 0x69 'i'
-        {  4736,  16,  32,  16,    0,  -25 },   // 0x6A 'j'
-        {  4800,  16,  32,  16,    0,  -25 },   // 0x6B 'k'
-        {  4864,  16,  32,  16,    0,  -25 },   // 0x6C 'l'
-        {  4928,  16,  32,  16,    0,  -25 },   // 0x6D 'm'
-        {  4992,  16,  32,  16,    0,  -25 },   // 0x6E 'n'
-        {  5056,  16,  32,  16,    0,  -25 },   // 0x6F 'o'
-        {  5120,  16,  32,  16,    0,  -25 },   // 0x70 'p'
-        {  5184,  16,  32,  16,    0,  -25 },   // 0x71 'q'
-        {  5248,  16,  32,  16,    0,  -25 },   // 0x72 'r'
-        {  5312,  16,  32,  16,    0,  -25 },   // 0x73 's'
-        {  5376,  16,  32,  16,    0,  -25 },   // 0x74 't'
-        {  5440,  16,  32,  16,    0,  -25 },   // 0x75 'u'
-        {  5504,  16,  32,  16,    0,  -25 },   // 0x76 'v'
-        {  5568,  16,  32,  16,    0,  -25 },   // 0x77 'w'
-        {  5632,  16,  32,  16,    0,  -25 },   // 0x78 'x'
-        {  5696,  16,  32,  16,    0,  -25 },   // 0x79 'y'
-        {  5760,  16,  32,  16,    0,  -25 },   // 0x7A 'z'
-        {  5824,  16,  32,  16,    0,  -25 },   // 0x7B '{'
-        {  5888,  16,  32,  16,    0,  -25 },   // 0x7C '|'
-        {  5952,  16,  32,  16,    0,  -25 },   // 0x7D '}'
-        {  6016,  16,  32,  16,    0,  -25 },   // 0x7E '~'
+        {     0,   0,  32,  10,    0,  -25 },   // 0x20 ' '
+        {     0,   3,  32,  16,    6,  -25 },   // 0x21 '!'
+        {    11,   9,  32,  16,    3,  -25 },   // 0x22 '"'
+        {    22,  13,  32,  16,    1,  -25 },   // 0x23 '#'
+        {    59,  13,  32,  16,    1,  -25 },   // 0x24 '$'
+        {   102,  12,  32,  16,    2,  -25 },   // 0x25 '%'
+        {   136,  14,  32,  16,    1,  -25 },   // 0x26 '&'
+        {   175,   3,  32,  16,    6,  -25 },   // 0x27 '''
+        {   182,   7,  32,  16,    4,  -25 },   // 0x28 '('
+        {   204,   7,  32,  16,    4,  -25 },   // 0x29 ')'
+        {   226,  13,  32,  16,    1,  -25 },   // 0x2A '*'
+        {   250,  13,  32,  16,    1,  -25 },   // 0x2B '+'
+        {   274,   5,  32,  16,    4,  -25 },   // 0x2C ','
+        {   282,  13,  32,  16,    1,  -25 },   // 0x2D '-'
+        {   290,   3,  32,  16,    6,  -25 },   // 0x2E '.'
+        {   296,  12,  32,  16,    2,  -25 },   // 0x2F '/'
+        {   330,  13,  32,  16,    1,  -25 },   // 0x30 '0'
+        {   367,   9,  32,  16,    3,  -25 },   // 0x31 '1'
+        {   394,  13,  32,  16,    1,  -25 },   // 0x32 '2'
+        {   431,  13,  32,  16,    1,  -25 },   // 0x33 '3'
+        {   468,  13,  32,  16,    1,  -25 },   // 0x34 '4'
+        {   505,  13,  32,  16,    1,  -25 },   // 0x35 '5'
+        {   542,  13,  32,  16,    1,  -25 },   // 0x36 '6'
+        {   579,  13,  32,  16,    1,  -25 },   // 0x37 '7'
+        {   616,  13,  32,  16,    1,  -25 },   // 0x38 '8'
+        {   653,  13,  32,  16,    1,  -25 },   // 0x39 '9'
+        {   690,   3,  32,  16,    6,  -25 },   // 0x3A ':'
+        {   697,   5,  32,  16,    4,  -25 },   // 0x3B ';'
+        {   708,  12,  32,  16,    2,  -25 },   // 0x3C '<'
+        {   742,  13,  32,  16,    1,  -25 },   // 0x3D '='
+        {   753,  12,  32,  16,    2,  -25 },   // 0x3E '>'
+        {   787,  13,  32,  16,    1,  -25 },   // 0x3F '?'
+        {   821,  14,  32,  16,    1,  -25 },   // 0x40 '@'
+        {   860,  13,  32,  16,    1,  -25 },   // 0x41 'A'
+        {   897,  13,  32,  16,    1,  -25 },   // 0x42 'B'
+        {   934,  13,  32,  16,    1,  -25 },   // 0x43 'C'
+        {   971,  13,  32,  16,    1,  -25 },   // 0x44 'D'
+        {  1008,  13,  32,  16,    1,  -25 },   // 0x45 'E'
+        {  1045,  13,  32,  16,    1,  -25 },   // 0x46 'F'
+        {  1082,  13,  32,  16,    1,  -25 },   // 0x47 'G'
+        {  1119,  13,  32,  16,    1,  -25 },   // 0x48 'H'
+        {  1156,   7,  32,  16,    4,  -25 },   // 0x49 'I'
+        {  1178,  14,  32,  16,    1,  -25 },   // 0x4A 'J'
+        {  1217,  13,  32,  16,    1,  -25 },   // 0x4B 'K'
+        {  1254,  13,  32,  16,    1,  -25 },   // 0x4C 'L'
+        {  1291,  14,  32,  16,    1,  -25 },   // 0x4D 'M'
+        {  1330,  13,  32,  16,    1,  -25 },   // 0x4E 'N'
+        {  1367,  13,  32,  16,    1,  -25 },   // 0x4F 'O'
+        {  1404,  13,  32,  16,    1,  -25 },   // 0x50 'P'
+        {  1441,  13,  32,  16,    1,  -25 },   // 0x51 'Q'
+        {  1481,  13,  32,  16,    1,  -25 },   // 0x52 'R'
+        {  1518,  13,  32,  16,    1,  -25 },   // 0x53 'S'
+        {  1555,  13,  32,  16,    1,  -25 },   // 0x54 'T'
+        {  1592,  13,  32,  16,    1,  -25 },   // 0x55 'U'
+        {  1629,  13,  32,  16,    1,  -25 },   // 0x56 'V'
+        {  1666,  14,  32,  16,    1,  -25 },   // 0x57 'W'
+        {  1705,  13,  32,  16,    1,  -25 },   // 0x58 'X'
+        {  1742,  13,  32,  16,    1,  -25 },   // 0x59 'Y'
+        {  1779,  13,  32,  16,    1,  -25 },   // 0x5A 'Z'
+        {  1816,   8,  32,  16,    4,  -25 },   // 0x5B '['
+        {  1840,  12,  32,  16,    2,  -25 },   // 0x5C '\'
+        {  1874,   8,  32,  16,    4,  -25 },   // 0x5D ']'
+        {  1898,  13,  32,  16,    1,  -25 },   // 0x5E '^'
+        {  1912,  13,  32,  16,    1,  -25 },   // 0x5F '_'
+        {  1920,   6,  32,  16,    3,  -25 },   // 0x60 '`'
+        {  1927,  13,  32,  16,    1,  -25 },   // 0x61 'a'
+        {  1954,  13,  32,  16,    1,  -25 },   // 0x62 'b'
+        {  1991,  13,  32,  16,    1,  -25 },   // 0x63 'c'
+        {  2018,  13,  32,  16,    1,  -25 },   // 0x64 'd'
+        {  2055,  13,  32,  16,    1,  -25 },   // 0x65 'e'
+        {  2082,  13,  32,  16,    2,  -25 },   // 0x66 'f'
+        {  2119,  13,  32,  16,    1,  -25 },   // 0x67 'g'
+        {  2154,  13,  32,  16,    1,  -25 },   // 0x68 'h'
+        {  2191,   7,  32,  16,    4,  -25 },   // 0x69 'i'
+        {  2211,  11,  32,  16,    2,  -25 },   // 0x6A 'j'
+        {  2247,  12,  32,  16,    2,  -25 },   // 0x6B 'k'
+        {  2281,   7,  32,  16,    4,  -25 },   // 0x6C 'l'
+        {  2303,  13,  32,  16,    1,  -25 },   // 0x6D 'm'
+        {  2330,  13,  32,  16,    1,  -25 },   // 0x6E 'n'
+        {  2357,  13,  32,  16,    1,  -25 },   // 0x6F 'o'
+        {  2384,  13,  32,  16,    1,  -25 },   // 0x70 'p'
+        {  2419,  13,  32,  16,    1,  -25 },   // 0x71 'q'
+        {  2454,  13,  32,  16,    1,  -25 },   // 0x72 'r'
+        {  2481,  13,  32,  16,    1,  -25 },   // 0x73 's'
+        {  2508,  13,  32,  16,    1,  -25 },   // 0x74 't'
+        {  2545,  13,  32,  16,    1,  -25 },   // 0x75 'u'
+        {  2572,  13,  32,  16,    1,  -25 },   // 0x76 'v'
+        {  2599,  13,  32,  16,    1,  -25 },   // 0x77 'w'
+        {  2626,  13,  32,  16,    1,  -25 },   // 0x78 'x'
+        {  2653,  13,  32,  16,    1,  -25 },   // 0x79 'y'
+        {  2688,  13,  32,  16,    1,  -25 },   // 0x7A 'z'
+        {  2715,  10,  32,  16,    2,  -25 },   // 0x7B '{'
+        {  2744,   3,  32,  16,    6,  -25 },   // 0x7C '|'
+        {  2756,  10,  32,  16,    2,  -25 },   // 0x7D '}'
+        {  2785,  13,  32,  16,    1,  -25 },   // 0x7E '~'
       },  0x20, 0x7e, 0
 
-    }, 0x0, 0x20, 0x7e
+    }, 0x0, 0x20, 0x7e, true
   },
-  // Approx. 6752 bytes
+  // Approx. 3471 bytes
 
   {
     {
       (uint8_t[]){
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x7b, 0xbc, 0x73, 0x9c, 0x73, 0x80, 0x73, 0x80, 0x73, 0x80, 0x73, 0x80,
-        0x73, 0x80, 0x73, 0x80, 0x73, 0x9c, 0x7b, 0xbc, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x07, 0xe0, 0x0f, 0xf0, 0x1e, 0x78, 0x1c, 0x38, 0x1c, 0x00, 0x1c, 0x00,
-        0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x7f, 0xe0, 0x7f, 0xe0, 0x1c, 0x00,
-        0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x1c, 0x1c, 0x1c,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c,
-        0x38, 0x38, 0x1f, 0xf0, 0x1f, 0xf0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-        0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1f, 0xf0, 0x1f, 0xf0, 0x38, 0x38,
-        0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x38, 0x38, 0x38, 0x38, 0x1c, 0x70, 0x1c, 0x70, 0x0e, 0xe0, 0x0e, 0xe0,
-        0x07, 0xc0, 0x07, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x3f, 0xf8, 0x3f, 0xf8,
-        0x03, 0x80, 0x03, 0x80, 0x3f, 0xf8, 0x3f, 0xf8, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x07, 0xe0, 0x0f, 0xf0, 0x1e, 0x78, 0x1c, 0x38, 0x1c, 0x00, 0x1e, 0x00,
-        0x0f, 0xc0, 0x0f, 0xe0, 0x1c, 0xf0, 0x1c, 0x78, 0x1c, 0x38, 0x1c, 0x38,
-        0x1c, 0x38, 0x1e, 0x38, 0x0f, 0x38, 0x07, 0xf0, 0x03, 0xf0, 0x00, 0x78,
-        0x00, 0x38, 0x1c, 0x38, 0x1e, 0x78, 0x0f, 0xf0, 0x07, 0xe0, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70,
-        0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x3f, 0xfc, 0x70, 0x0e, 0x67, 0xe6,
-        0x6f, 0xf6, 0x6e, 0x76, 0x6e, 0x06, 0x6e, 0x06, 0x6e, 0x06, 0x6e, 0x06,
-        0x6e, 0x76, 0x6f, 0xf6, 0x67, 0xe6, 0x70, 0x0e, 0x3f, 0xfc, 0x1f, 0xf8,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x1f, 0xf0,
-        0x00, 0x38, 0x00, 0x38, 0x0f, 0xf8, 0x1f, 0xf8, 0x38, 0x38, 0x38, 0x38,
-        0x38, 0x38, 0x1f, 0xf8, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8,
-        0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xce, 0x03, 0x9c,
-        0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0, 0x39, 0xc0, 0x73, 0x80, 0x73, 0x80,
-        0x39, 0xc0, 0x1c, 0xe0, 0x0e, 0x70, 0x07, 0x38, 0x03, 0x9c, 0x01, 0xce,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf8,
-        0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf8, 0x3f, 0xfc, 0x70, 0x0e, 0x6f, 0xe6, 0x6f, 0xf6, 0x6e, 0x76,
-        0x6e, 0x76, 0x6e, 0x76, 0x6f, 0xe6, 0x6f, 0xc6, 0x6f, 0xc6, 0x6e, 0xe6,
-        0x6e, 0x76, 0x70, 0x0e, 0x3f, 0xfc, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0xe0, 0x1f, 0xf0, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
-        0x1f, 0xf0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x7f, 0xfc, 0x7f, 0xfc, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x1f, 0xf0, 0x1c, 0x70,
-        0x1c, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00,
-        0x1f, 0xf0, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0,
-        0x1f, 0xf0, 0x1c, 0x70, 0x00, 0x70, 0x03, 0xe0, 0x03, 0xe0, 0x00, 0x70,
-        0x00, 0x70, 0x1c, 0x70, 0x1f, 0xf0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-        0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c, 0x70, 0x7c, 0x70, 0xfc,
-        0x7f, 0xdc, 0x7f, 0x9c, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x3f, 0xfe, 0x79, 0xce, 0x71, 0xce,
-        0x71, 0xce, 0x71, 0xce, 0x71, 0xce, 0x71, 0xce, 0x79, 0xce, 0x3f, 0xce,
-        0x1f, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0xce,
-        0x01, 0xce, 0x01, 0xce, 0x01, 0xce, 0x01, 0xce, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00,
-        0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-        0x07, 0x80, 0x0f, 0x80, 0x0f, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0xe0, 0x1f, 0xf0, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-        0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x1f, 0xf0, 0x0f, 0xe0, 0x00, 0x00,
-        0x00, 0x00, 0x3f, 0xf8, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x73, 0x80, 0x39, 0xc0, 0x1c, 0xe0, 0x0e, 0x70, 0x07, 0x38, 0x03, 0x9c,
-        0x01, 0xce, 0x01, 0xce, 0x03, 0x9c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0,
-        0x39, 0xc0, 0x73, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x1e, 0x00, 0x3e, 0x00, 0x0e, 0x00,
-        0x0e, 0x06, 0x0e, 0x0e, 0x0e, 0x1c, 0x0e, 0x38, 0x0e, 0x70, 0x00, 0xe0,
-        0x01, 0xce, 0x03, 0x9e, 0x07, 0x3e, 0x0e, 0x7e, 0x1c, 0xee, 0x39, 0xce,
-        0x73, 0xfe, 0x63, 0xfe, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x3c, 0x00,
-        0x7c, 0x06, 0x1c, 0x0e, 0x1c, 0x1c, 0x1c, 0x38, 0x1c, 0x70, 0x1c, 0xe0,
-        0x1d, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0xfc, 0x1d, 0xfe, 0x39, 0xce,
-        0x71, 0xce, 0x60, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0xfe, 0x01, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3f, 0x80, 0x7f, 0xc0, 0x71, 0xc0, 0x0f, 0x80, 0x0f, 0x80, 0x01, 0xc6,
-        0x71, 0xce, 0x7f, 0xdc, 0x3f, 0xb8, 0x00, 0x70, 0x00, 0xee, 0x01, 0xde,
-        0x03, 0xbe, 0x07, 0x7e, 0x0e, 0xee, 0x1d, 0xce, 0x3b, 0xfe, 0x73, 0xfe,
-        0x60, 0x0e, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00,
-        0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
-        0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0,
-        0x1c, 0x70, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x38,
-        0x3b, 0xb8, 0x3b, 0xb8, 0x39, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x0e, 0xe0, 0x0e, 0xe0,
-        0x0e, 0xe0, 0x07, 0xc0, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfe, 0x7f, 0xfe,
-        0xf1, 0xc0, 0xe1, 0xc0, 0xe1, 0xc0, 0xe1, 0xc0, 0xe1, 0xc0, 0xe1, 0xc0,
-        0xe1, 0xc0, 0xff, 0xfe, 0xff, 0xfe, 0xe1, 0xc0, 0xe1, 0xc0, 0xe1, 0xc0,
-        0xe1, 0xc0, 0xe1, 0xc0, 0xe1, 0xc0, 0xe1, 0xc0, 0xe1, 0xfe, 0xe1, 0xfe,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00,
-        0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00,
-        0x03, 0x80, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xe0,
-        0x7f, 0xe0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
-        0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x7f, 0xe0, 0x7f, 0xe0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xe0, 0x7f, 0xe0, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xe0,
-        0x7f, 0xe0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
-        0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x0f, 0xe0, 0x0f, 0xe0,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00,
-        0x0f, 0xe0, 0x0f, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0,
-        0x1c, 0x70, 0x00, 0x00, 0x0f, 0xe0, 0x0f, 0xe0, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70,
-        0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x0f, 0xe0, 0x0f, 0xe0,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xc0, 0x7f, 0xf0, 0x70, 0x78, 0x70, 0x38, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0xff, 0x9c, 0xff, 0x9c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x38, 0x70, 0x78,
-        0x7f, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x38, 0x3b, 0xb8, 0x3b, 0xb8,
-        0x39, 0xf0, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x7c, 0x1c, 0x7e, 0x1c, 0x77, 0x1c, 0x73, 0x9c,
-        0x71, 0xdc, 0x70, 0xfc, 0x70, 0x7c, 0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00,
-        0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0,
-        0x1c, 0x70, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x38,
-        0x3b, 0xb8, 0x3b, 0xb8, 0x39, 0xf0, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x0e, 0x38, 0x1c, 0x1c, 0x38, 0x0e, 0x70, 0x07, 0xe0, 0x03, 0xc0,
-        0x03, 0xc0, 0x07, 0xe0, 0x0e, 0x70, 0x1c, 0x38, 0x38, 0x1c, 0x70, 0x0e,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3e, 0x70, 0x1e, 0x70, 0x1c, 0x70, 0x3c, 0x70, 0x7c, 0x70, 0xfc,
-        0x71, 0xdc, 0x73, 0x9c, 0x77, 0x1c, 0x7e, 0x1c, 0x7c, 0x1c, 0x78, 0x1c,
-        0x70, 0x1c, 0xf0, 0x1c, 0xf0, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
-        0x03, 0x80, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
-        0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0,
-        0x03, 0x80, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x38, 0x38,
-        0x38, 0x38, 0x1c, 0x70, 0x1c, 0x70, 0x0e, 0xe0, 0x0e, 0xe0, 0x07, 0xc0,
-        0x07, 0xc0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c,
-        0x7f, 0xf8, 0x7f, 0xf0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3f, 0xe0, 0x7f, 0xf0, 0x70, 0x78, 0x70, 0x38, 0x70, 0x38, 0x70, 0x38,
-        0x70, 0x38, 0x70, 0x70, 0x7f, 0xf0, 0x7f, 0xf0, 0x70, 0x38, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x7c, 0x3c,
-        0x77, 0xf8, 0x73, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf8, 0x00, 0x3c, 0x00, 0x1c,
-        0x00, 0x1c, 0x1f, 0xfc, 0x3f, 0xfc, 0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0,
-        0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf8,
-        0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c, 0x1f, 0xfc, 0x3f, 0xfc, 0x78, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00,
-        0x3f, 0xf0, 0x3f, 0xf8, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c, 0x1f, 0xfc,
-        0x3f, 0xfc, 0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0x38, 0x3b, 0xb8, 0x3b, 0xb8, 0x39, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf8, 0x00, 0x3c, 0x00, 0x1c,
-        0x00, 0x1c, 0x1f, 0xfc, 0x3f, 0xfc, 0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x3f, 0xf8,
-        0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c, 0x1f, 0xfc, 0x3f, 0xfc, 0x78, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x07, 0xc0, 0x0e, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x07, 0xc0, 0x00, 0x00,
-        0x3f, 0xf0, 0x3f, 0xf8, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c, 0x1f, 0xfc,
-        0x3f, 0xfc, 0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7e, 0xf8, 0x7f, 0xfc, 0x03, 0x9e, 0x03, 0x8e,
-        0x03, 0x8e, 0x3f, 0x8e, 0x7f, 0xfe, 0xf3, 0xfe, 0xe3, 0x80, 0xe3, 0x80,
-        0xe3, 0x80, 0xf3, 0xce, 0x7f, 0xfe, 0x3e, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xc0,
-        0x0e, 0xe0, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xf8,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0,
-        0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0x80, 0x0f, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
-        0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xc0, 0x0f, 0x80,
-        0x1f, 0x00, 0x3b, 0x80, 0x01, 0xc0, 0x00, 0xe0, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0x38, 0x3b, 0xb8, 0x3b, 0xb8, 0x39, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0,
-        0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0x38, 0x3b, 0xb8, 0x3b, 0xb8, 0x39, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf6, 0x3f, 0xfe, 0x78, 0x3c, 0x70, 0x7c,
-        0x70, 0xfc, 0x71, 0xdc, 0x73, 0x9c, 0x77, 0x1c, 0x7e, 0x1c, 0x7c, 0x1c,
-        0x78, 0x1c, 0x78, 0x3c, 0xff, 0xf8, 0xdf, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00,
-        0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x3f, 0xf8,
-        0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0, 0x00, 0x00
+        0x03, 0xcf, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
+        0x7f, 0xff, 0xf8, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x7f, 0xc7, 0xff, 0x7b,
+        0xbf, 0x9c, 0xfc, 0xe0, 0xe7, 0x07, 0x38, 0x39, 0xc1, 0xce, 0x0e, 0x70,
+        0x73, 0x9f, 0xdd, 0xef, 0xfe, 0x3f, 0xe0, 0x38, 0x01, 0xc0, 0x0e, 0x00,
+        0x03, 0xff, 0xff, 0xc0, 0x0f, 0xc0, 0xff, 0x0f, 0x3c, 0x70, 0xe3, 0x80,
+        0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x07, 0xfe, 0x3f, 0xf0, 0x70, 0x03,
+        0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x39, 0xc1, 0xff, 0xff, 0xff,
+        0xf0, 0x00, 0x7f, 0xfe, 0x00, 0xe0, 0x3b, 0x83, 0x8f, 0xf8, 0x7f, 0xc7,
+        0x07, 0x38, 0x39, 0xc1, 0xce, 0x0e, 0x70, 0x73, 0x83, 0x8f, 0xf8, 0x7f,
+        0xc7, 0x07, 0x70, 0x1c, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xdc,
+        0x1c, 0xe0, 0xe3, 0x8e, 0x1c, 0x70, 0x77, 0x03, 0xb8, 0x0f, 0x80, 0x7c,
+        0x01, 0xc0, 0x0e, 0x07, 0xff, 0x3f, 0xf8, 0x1c, 0x00, 0xe0, 0x7f, 0xf3,
+        0xff, 0x81, 0xc0, 0x0e, 0x00, 0x03, 0xfc, 0x3f, 0xc0, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xe0, 0x3f, 0x1f, 0xef, 0x3f, 0x87,
+        0xe0, 0x3c, 0x07, 0xe1, 0xfc, 0xe7, 0xb8, 0xfe, 0x1f, 0x87, 0xe1, 0xfc,
+        0x77, 0x9c, 0xfe, 0x1f, 0x80, 0xf0, 0x1f, 0x87, 0xf3, 0xdf, 0xe3, 0xf0,
+        0x78, 0x00, 0x00, 0x00, 0xe3, 0xf1, 0xf8, 0xfc, 0x70, 0x00, 0xff, 0xff,
+        0x00, 0x3f, 0xf1, 0xff, 0xee, 0x01, 0xf3, 0xf3, 0xdf, 0xef, 0x73, 0xbd,
+        0xc0, 0xf7, 0x03, 0xdc, 0x0f, 0x70, 0x3d, 0xce, 0xf7, 0xfb, 0xcf, 0xcf,
+        0x80, 0x77, 0xff, 0x8f, 0xfc, 0x3f, 0xf9, 0x80, 0x00, 0x7f, 0x8f, 0xf8,
+        0x03, 0x80, 0x73, 0xfe, 0xff, 0xf8, 0x3f, 0x07, 0xe0, 0xef, 0xfc, 0xff,
+        0xff, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xc0, 0x03, 0x9c, 0x1c, 0xe0, 0xe7,
+        0x07, 0x38, 0x39, 0xc1, 0xce, 0x0e, 0x70, 0x39, 0xc0, 0x73, 0x80, 0xe7,
+        0x01, 0xce, 0x03, 0x9c, 0x07, 0x38, 0x0e, 0x70, 0x00, 0x0f, 0xf0, 0x00,
+        0xff, 0xff, 0xff, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0x00, 0x01, 0x80, 0x00, 0xff, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x00,
+        0x3f, 0xf1, 0xff, 0xee, 0x01, 0xf7, 0xf3, 0xdf, 0xef, 0x73, 0xbd, 0xce,
+        0xf7, 0x3b, 0xdf, 0xcf, 0x7e, 0x3d, 0xf8, 0xf7, 0x73, 0xdc, 0xef, 0x80,
+        0x77, 0xff, 0x8f, 0xfc, 0x30, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x0f,
+        0xf0, 0x00, 0x00, 0x7f, 0x7f, 0xf8, 0xfc, 0x7e, 0x3f, 0x1f, 0xfe, 0xfe,
+        0x00, 0x3f, 0xfc, 0xc0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70,
+        0x7f, 0xff, 0xff, 0xe0, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x0f,
+        0xff, 0xff, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x7f, 0x7f, 0xf8, 0xfc, 0x70,
+        0x70, 0x70, 0x70, 0x70, 0x70, 0x7f, 0xff, 0xe0, 0x1f, 0xfc, 0x00, 0x00,
+        0x7f, 0x7f, 0xf8, 0xe0, 0x71, 0xf0, 0xf8, 0x0e, 0x07, 0xe3, 0xff, 0xdf,
+        0xc0, 0x78, 0x00, 0x00, 0x00, 0x1c, 0xe7, 0x38, 0x00, 0x0f, 0xff, 0xfe,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc,
+        0x07, 0xe0, 0x3f, 0x03, 0xf8, 0x3f, 0xc3, 0xff, 0xfb, 0xff, 0x9f, 0x80,
+        0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x3f,
+        0xfd, 0xff, 0xff, 0x39, 0xf8, 0xe7, 0xe3, 0x9f, 0x8e, 0x7e, 0x39, 0xf8,
+        0xe7, 0xf3, 0x9d, 0xfe, 0x73, 0xf9, 0xc0, 0xe7, 0x03, 0x9c, 0x0e, 0x70,
+        0x39, 0xc0, 0xe7, 0x03, 0x9c, 0x0e, 0x70, 0x39, 0xc0, 0xe7, 0x00, 0x03,
+        0xc0, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x3e, 0x39, 0xce, 0xee, 0x00,
+        0x1f, 0xfc, 0x00, 0x00, 0x38, 0xf3, 0xe7, 0xc3, 0x87, 0x0e, 0x1c, 0x39,
+        0xff, 0xf8, 0x3f, 0xf9, 0x80, 0x00, 0x3f, 0x8f, 0xfb, 0x83, 0xf0, 0x7e,
+        0x0f, 0xc1, 0xf8, 0x3f, 0x07, 0xe0, 0xef, 0xf8, 0xfe, 0x7f, 0xff, 0xfe,
+        0x00, 0x0f, 0xff, 0xc0, 0xe7, 0x01, 0xce, 0x03, 0x9c, 0x07, 0x38, 0x0e,
+        0x70, 0x1c, 0xe0, 0x39, 0xc0, 0xe7, 0x07, 0x38, 0x39, 0xc1, 0xce, 0x0e,
+        0x70, 0x73, 0x83, 0x9c, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x1c, 0x00, 0xf0,
+        0x07, 0xc0, 0x07, 0x00, 0x1c, 0x0c, 0x70, 0x71, 0xc3, 0x87, 0x1c, 0x1c,
+        0xe0, 0x07, 0x00, 0x39, 0xc1, 0xcf, 0x0e, 0x7c, 0x73, 0xf3, 0x9d, 0xdc,
+        0xe7, 0xe7, 0xff, 0x1f, 0xf0, 0x01, 0xc0, 0x07, 0x03, 0xff, 0xff, 0xc0,
+        0x38, 0x01, 0xe0, 0x0f, 0x80, 0xce, 0x07, 0x38, 0x38, 0xe1, 0xc3, 0x8e,
+        0x0e, 0x70, 0x3b, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x7e, 0x3b, 0xfd, 0xce,
+        0x7e, 0x39, 0xf0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1f, 0xc0, 0xff, 0x03,
+        0xff, 0xff, 0xc0, 0x7f, 0x03, 0xfe, 0x0e, 0x38, 0x07, 0xc0, 0x1f, 0x00,
+        0x0e, 0x3e, 0x39, 0xff, 0xee, 0x7f, 0x70, 0x03, 0x80, 0x1d, 0xc0, 0xef,
+        0x07, 0x7c, 0x3b, 0xf1, 0xdd, 0xce, 0xe7, 0x77, 0xff, 0x9f, 0xfc, 0x01,
+        0xc0, 0x07, 0x03, 0xcf, 0xff, 0xc0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e,
+        0x00, 0x70, 0x03, 0x80, 0x1c, 0x01, 0xc0, 0x1c, 0x01, 0xc0, 0x1c, 0x01,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x0f, 0x7f, 0xf1, 0xff, 0x00,
+        0x7b, 0xff, 0xff, 0xc0, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x03, 0xfe,
+        0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0x7b, 0xff, 0xff, 0xc0, 0x00,
+        0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x03, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0xff, 0xff,
+        0xff, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80,
+        0xfc, 0x07, 0x7b, 0xff, 0xff, 0xc0, 0x07, 0x00, 0x7c, 0x07, 0x70, 0x71,
+        0xc3, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x3f, 0x01, 0xf8,
+        0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0x7b, 0xff, 0xff,
+        0xc0, 0x3e, 0x73, 0xbb, 0x9d, 0xdc, 0xe7, 0xc3, 0xfe, 0x3f, 0xfb, 0xc1,
+        0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f,
+        0xff, 0xff, 0xff, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfc, 0x07, 0x7b, 0xff, 0xff, 0xc0, 0x38, 0xe1, 0xc7, 0x0e,
+        0x38, 0x71, 0xc3, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01,
+        0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x3f,
+        0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0x7f,
+        0xff, 0xff, 0xc0, 0x0f, 0x80, 0xee, 0x07, 0x70, 0x3b, 0x80, 0xf8, 0x1f,
+        0xf1, 0xff, 0xde, 0x0f, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03,
+        0xf0, 0x1f, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x38, 0x03, 0xff, 0xff, 0xc0,
+        0x3f, 0xfe, 0xff, 0xff, 0xc7, 0x07, 0x0e, 0x0e, 0x1c, 0x1c, 0x38, 0x38,
+        0x70, 0x70, 0xe0, 0xe1, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x0e, 0x1c,
+        0x1c, 0x38, 0x38, 0x70, 0x70, 0xe0, 0xe1, 0xc1, 0xc3, 0x83, 0x87, 0xff,
+        0x0f, 0xf0, 0x03, 0xff, 0xff, 0xfe, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01,
+        0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x07, 0xe0, 0x3f, 0x83, 0xdf,
+        0xfc, 0x7f, 0xc0, 0x70, 0x03, 0x80, 0x1c, 0x01, 0xc0, 0x1c, 0x00, 0x7b,
+        0xff, 0xff, 0xc0, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x0f, 0xff, 0xff,
+        0xff, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00,
+        0x7f, 0xe3, 0xff, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e,
+        0x00, 0x70, 0x03, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xc0, 0x00, 0xe0,
+        0x0e, 0x00, 0xe0, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x7f, 0xe3, 0xff, 0x1c, 0x00,
+        0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0xff, 0xff,
+        0xff, 0x7b, 0xff, 0xff, 0xc0, 0x07, 0x00, 0x7c, 0x07, 0x70, 0x71, 0xcf,
+        0xff, 0xff, 0xff, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0,
+        0x0e, 0x00, 0x7f, 0xe3, 0xff, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01,
+        0xc0, 0x0e, 0x00, 0x70, 0x03, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xc0,
+        0x38, 0xe1, 0xc7, 0x0e, 0x38, 0x71, 0xcf, 0xff, 0xff, 0xff, 0x80, 0x1c,
+        0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x7f, 0xe3, 0xff,
+        0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03,
+        0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x7f,
+        0x7f, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+        0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x7f, 0x7f, 0x7b, 0xff, 0xff, 0xc0, 0x07,
+        0x0e, 0x1c, 0x38, 0xfe, 0xfe, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
+        0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xfe, 0xfe, 0x7b,
+        0xff, 0xff, 0xc0, 0x1c, 0x1f, 0x1d, 0xdc, 0x77, 0xf3, 0xf8, 0x70, 0x38,
+        0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07,
+        0x03, 0x81, 0xc0, 0xe1, 0xfc, 0xfe, 0x7b, 0xff, 0xff, 0xc0, 0xe3, 0xf1,
+        0xf8, 0xfc, 0x77, 0xf3, 0xf8, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81,
+        0xc0, 0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe1, 0xfc,
+        0xfe, 0x03, 0xff, 0xff, 0xc0, 0x7f, 0xc1, 0xff, 0xc7, 0x07, 0x9c, 0x0e,
+        0x70, 0x1d, 0xc0, 0x77, 0x01, 0xdc, 0x07, 0x70, 0x1f, 0xfe, 0x7f, 0xf9,
+        0xdc, 0x07, 0x70, 0x1d, 0xc0, 0x77, 0x01, 0xdc, 0x07, 0x70, 0x39, 0xc1,
+        0xe7, 0xff, 0x1f, 0xf0, 0x7b, 0xff, 0xff, 0xc0, 0x3e, 0x73, 0xbb, 0x9d,
+        0xdc, 0xe7, 0xce, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x81,
+        0xfe, 0x0f, 0xf8, 0x7e, 0xe3, 0xf3, 0x9f, 0x8e, 0xfc, 0x3f, 0xe0, 0xff,
+        0x03, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0x7b,
+        0xff, 0xff, 0xc0, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x03, 0xfe, 0x3f,
+        0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xf8, 0x3d, 0xff, 0xc7, 0xfc, 0x7b, 0xff, 0xff, 0xc0, 0x00, 0xe0,
+        0x0e, 0x00, 0xe0, 0x0e, 0x03, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0,
+        0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x3d, 0xff, 0xc7,
+        0xfc, 0x7b, 0xff, 0xff, 0xc0, 0x07, 0x00, 0x7c, 0x07, 0x70, 0x71, 0xc3,
+        0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf8, 0x3d, 0xff, 0xc7, 0xfc, 0x7b, 0xff, 0xff, 0xc0,
+        0x3e, 0x73, 0xbb, 0x9d, 0xdc, 0xe7, 0xc3, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc,
+        0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80,
+        0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x3d,
+        0xff, 0xc7, 0xfc, 0x7b, 0xff, 0xff, 0xc0, 0x38, 0xe1, 0xc7, 0x0e, 0x38,
+        0x71, 0xc3, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8,
+        0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01,
+        0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x3d, 0xff, 0xc7, 0xfc, 0x00, 0x3f,
+        0xfc, 0x00, 0xe0, 0x1d, 0xc0, 0xe3, 0x87, 0x07, 0x38, 0x0f, 0xc0, 0x1e,
+        0x00, 0x78, 0x03, 0xf0, 0x1c, 0xe0, 0xe1, 0xc7, 0x03, 0xb8, 0x07, 0x03,
+        0xff, 0xff, 0xc0, 0x1f, 0xf0, 0x7f, 0xf1, 0xe0, 0xfb, 0x80, 0xf7, 0x01,
+        0xce, 0x07, 0x9c, 0x1f, 0x38, 0x7e, 0x71, 0xdc, 0xe7, 0x39, 0xdc, 0x73,
+        0xf0, 0xe7, 0xc1, 0xcf, 0x03, 0x9c, 0x07, 0x78, 0x0e, 0xf0, 0x1c, 0xf0,
+        0x78, 0xff, 0xe0, 0xff, 0x80, 0x7b, 0xff, 0xff, 0xc0, 0x38, 0x00, 0xe0,
+        0x03, 0x80, 0x0e, 0x0e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0,
+        0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x3d, 0xff, 0xc7, 0xfc,
+        0x7b, 0xff, 0xff, 0xc0, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x0e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0,
+        0x7e, 0x03, 0xf8, 0x3d, 0xff, 0xc7, 0xfc, 0x7b, 0xff, 0xff, 0xc0, 0x07,
+        0x00, 0x7c, 0x07, 0x70, 0x71, 0xce, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc,
+        0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x3d, 0xff,
+        0xc7, 0xfc, 0x7b, 0xff, 0xff, 0xc0, 0x38, 0xe1, 0xc7, 0x0e, 0x38, 0x71,
+        0xce, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8,
+        0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x3d, 0xff, 0xc7, 0xfc, 0x7b, 0xff, 0xff,
+        0xc0, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x0e, 0x03, 0xf0, 0x1f, 0x80,
+        0xee, 0x0e, 0x70, 0x71, 0xc7, 0x0e, 0x38, 0x3b, 0x81, 0xdc, 0x07, 0xc0,
+        0x3e, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03,
+        0x80, 0x1c, 0x00, 0xe0, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x07, 0x00, 0x38,
+        0x01, 0xc0, 0x0f, 0xfe, 0x7f, 0xfb, 0x81, 0xfc, 0x07, 0xe0, 0x3f, 0x01,
+        0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x3f, 0xff, 0xdf, 0xfc, 0xe0, 0x07,
+        0x00, 0x38, 0x01, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x7f, 0xc7, 0xff,
+        0x38, 0x3d, 0xc0, 0xee, 0x07, 0x70, 0x3b, 0x81, 0xdc, 0x1c, 0xff, 0xe7,
+        0xff, 0x38, 0x1d, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xf0,
+        0x3f, 0xc3, 0xfb, 0xfd, 0xcf, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x38, 0x00,
+        0xe0, 0x03, 0x80, 0x0e, 0x07, 0xfe, 0x3f, 0xf8, 0x01, 0xe0, 0x07, 0x00,
+        0x39, 0xff, 0xdf, 0xff, 0xe0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07,
+        0x7f, 0xf9, 0xff, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x00, 0xe0, 0x0e, 0x00,
+        0xe0, 0x0e, 0x07, 0xfe, 0x3f, 0xf8, 0x01, 0xe0, 0x07, 0x00, 0x39, 0xff,
+        0xdf, 0xff, 0xe0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9,
+        0xff, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x07, 0x00, 0x7c, 0x07, 0x70, 0x71,
+        0xc7, 0xfe, 0x3f, 0xf8, 0x01, 0xe0, 0x07, 0x00, 0x39, 0xff, 0xdf, 0xff,
+        0xe0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9, 0xff, 0xc0,
+        0x03, 0xcf, 0xff, 0xc0, 0x3e, 0x73, 0xbb, 0x9d, 0xdc, 0xe7, 0xc7, 0xfe,
+        0x3f, 0xf8, 0x01, 0xe0, 0x07, 0x00, 0x39, 0xff, 0xdf, 0xff, 0xe0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9, 0xff, 0xc0, 0x03, 0xcf,
+        0xff, 0xc0, 0x38, 0xe1, 0xc7, 0x0e, 0x38, 0x71, 0xc7, 0xfe, 0x3f, 0xf8,
+        0x01, 0xe0, 0x07, 0x00, 0x39, 0xff, 0xdf, 0xff, 0xe0, 0x7e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9, 0xff, 0xc0, 0x03, 0xef, 0xff, 0xc0,
+        0x0f, 0x80, 0xee, 0x07, 0x70, 0x3b, 0x80, 0xf8, 0x3f, 0xf1, 0xff, 0xc0,
+        0x0f, 0x00, 0x38, 0x01, 0xcf, 0xfe, 0xff, 0xff, 0x03, 0xf0, 0x1f, 0x80,
+        0xfc, 0x07, 0xf0, 0x3b, 0xff, 0xcf, 0xfe, 0x00, 0x0f, 0xff, 0xc0, 0x7e,
+        0xf8, 0xff, 0xf8, 0x0e, 0x78, 0x1c, 0x70, 0x38, 0xe7, 0xf1, 0xdf, 0xff,
+        0xf9, 0xff, 0xe3, 0x81, 0xc7, 0x03, 0x8e, 0x07, 0x9e, 0x77, 0xff, 0xe7,
+        0xdf, 0x80, 0x00, 0x0f, 0xff, 0xfe, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0,
+        0x7e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x0f,
+        0xe0, 0xf7, 0xff, 0x1f, 0xf0, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x70, 0x07,
+        0x00, 0x03, 0xcf, 0xff, 0xc0, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x03,
+        0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xff, 0xff, 0xff,
+        0xfe, 0x00, 0x70, 0x03, 0x80, 0x1e, 0x07, 0x7f, 0xf9, 0xff, 0x80, 0x03,
+        0xcf, 0xff, 0xc0, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x03, 0xfe, 0x3f,
+        0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x00,
+        0x70, 0x03, 0x80, 0x1e, 0x07, 0x7f, 0xf9, 0xff, 0x80, 0x03, 0xcf, 0xff,
+        0xc0, 0x07, 0x00, 0x7c, 0x07, 0x70, 0x71, 0xc3, 0xfe, 0x3f, 0xfb, 0xc1,
+        0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x70, 0x03,
+        0x80, 0x1e, 0x07, 0x7f, 0xf9, 0xff, 0x80, 0x03, 0xcf, 0xff, 0xc0, 0x38,
+        0xe1, 0xc7, 0x0e, 0x38, 0x71, 0xc3, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07,
+        0xe0, 0x3f, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x70, 0x03, 0x80, 0x1e,
+        0x07, 0x7f, 0xf9, 0xff, 0x80, 0x03, 0xcf, 0xff, 0xc0, 0xe0, 0x70, 0x38,
+        0x1c, 0x7c, 0x7c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+        0x1c, 0x7f, 0x7f, 0x03, 0xcf, 0xff, 0xc0, 0x07, 0x0e, 0x1c, 0x38, 0xf8,
+        0xf8, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xfe,
+        0xfe, 0x03, 0xcf, 0xff, 0xc0, 0x1c, 0x1f, 0x1d, 0xdc, 0x77, 0xc3, 0xe0,
+        0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x7f,
+        0x3f, 0x80, 0x03, 0xcf, 0xff, 0xc0, 0xe3, 0xf1, 0xf8, 0xfc, 0x77, 0xc3,
+        0xe0, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38,
+        0x7f, 0x3f, 0x80, 0x03, 0xff, 0xff, 0xc0, 0x3b, 0x80, 0xf8, 0x0f, 0x80,
+        0xee, 0x00, 0x38, 0x00, 0xe0, 0xff, 0x8f, 0xfe, 0xf0, 0x7f, 0x01, 0xf8,
+        0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x83,
+        0xdf, 0xfc, 0x7f, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x3e, 0x73, 0xbb, 0x9d,
+        0xdc, 0xe7, 0xcf, 0xfe, 0x7f, 0xfb, 0x81, 0xfc, 0x07, 0xe0, 0x3f, 0x01,
+        0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x01, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e,
+        0x03, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x0f, 0x7f, 0xf1, 0xff, 0x00,
+        0x03, 0xcf, 0xff, 0xc0, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x03, 0xfe,
+        0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x0f, 0x7f, 0xf1, 0xff, 0x00, 0x03, 0xcf,
+        0xff, 0xc0, 0x07, 0x00, 0x7c, 0x07, 0x70, 0x71, 0xc3, 0xfe, 0x3f, 0xfb,
+        0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfe, 0x0f, 0x7f, 0xf1, 0xff, 0x00, 0x03, 0xcf, 0xff, 0xc0,
+        0x3e, 0x73, 0xbb, 0x9d, 0xdc, 0xe7, 0xc3, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc,
+        0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80,
+        0xfe, 0x0f, 0x7f, 0xf1, 0xff, 0x00, 0x03, 0xcf, 0xff, 0xc0, 0x38, 0xe1,
+        0xc7, 0x0e, 0x38, 0x71, 0xc3, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc, 0x07, 0xe0,
+        0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x0f,
+        0x7f, 0xf1, 0xff, 0x00, 0x00, 0x79, 0x9e, 0x00, 0x07, 0x00, 0x38, 0x01,
+        0xc0, 0x0e, 0x0f, 0xff, 0xff, 0xfc, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38,
+        0x00, 0x00, 0x0f, 0xff, 0xc0, 0x1f, 0xf6, 0x7f, 0xfd, 0xe0, 0xf3, 0x83,
+        0xe7, 0x0f, 0xce, 0x3b, 0x9c, 0xe7, 0x3b, 0x8e, 0x7e, 0x1c, 0xf8, 0x39,
+        0xe0, 0x73, 0xc1, 0xef, 0xff, 0x9b, 0xfe, 0x00, 0x03, 0xcf, 0xff, 0xc0,
+        0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x0e, 0x03, 0xf0, 0x1f, 0x80, 0xfc,
+        0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80,
+        0xfe, 0x07, 0x7f, 0xf9, 0xff, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x00, 0xe0,
+        0x0e, 0x00, 0xe0, 0x0e, 0x0e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0,
+        0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07,
+        0x7f, 0xf9, 0xff, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x07, 0x00, 0x7c, 0x07,
+        0x70, 0x71, 0xce, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01,
+        0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9,
+        0xff, 0xc0, 0x03, 0xcf, 0xff, 0xc0, 0x38, 0xe1, 0xc7, 0x0e, 0x38, 0x71,
+        0xce, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9, 0xff, 0xc0,
+        0x03, 0xcf, 0xff, 0xfe, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x0e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9, 0xff, 0xc0, 0x0e, 0x00,
+        0x70, 0x07, 0xbf, 0xf9, 0xff, 0x80, 0x03, 0xff, 0xff, 0xfe, 0xe0, 0x07,
+        0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0xff, 0x9f, 0xfe, 0xe0,
+        0x7f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07,
+        0xe0, 0x3f, 0x03, 0xff, 0xfd, 0xff, 0xce, 0x00, 0x70, 0x03, 0x80, 0x1c,
+        0x00, 0xe0, 0x00, 0x03, 0xcf, 0xff, 0xfe, 0x38, 0xe1, 0xc7, 0x0e, 0x38,
+        0x71, 0xce, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8,
+        0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9, 0xff,
+        0xc0, 0x0e, 0x00, 0x70, 0x07, 0xbf, 0xf9, 0xff, 0x80
       },
       (GFXglyph[]){
-        {     0,  16,  32,  16,    0,  -25 },   // 0xA0
-        {    64,  16,  32,  16,    0,  -25 },   // 0xA1
-        {   128,  16,  32,  16,    0,  -25 },   // 0xA2
-        {   192,  16,  32,  16,    0,  -25 },   // 0xA3
-        {   256,  16,  32,  16,    0,  -25 },   // 0xA4
-        {   320,  16,  32,  16,    0,  -25 },   // 0xA5
-        {   384,  16,  32,  16,    0,  -25 },   // 0xA6
-        {   448,  16,  32,  16,    0,  -25 },   // 0xA7
-        {   512,  16,  32,  16,    0,  -25 },   // 0xA8
-        {   576,  16,  32,  16,    0,  -25 },   // 0xA9
-        {   640,  16,  32,  16,    0,  -25 },   // 0xAA
-        {   704,  16,  32,  16,    0,  -25 },   // 0xAB
-        {   768,  16,  32,  16,    0,  -25 },   // 0xAC
-        {   832,  16,  32,  16,    0,  -25 },   // 0xAD
-        {   896,  16,  32,  16,    0,  -25 },   // 0xAE
-        {   960,  16,  32,  16,    0,  -25 },   // 0xAF
-        {  1024,  16,  32,  16,    0,  -25 },   // 0xB0
-        {  1088,  16,  32,  16,    0,  -25 },   // 0xB1
-        {  1152,  16,  32,  16,    0,  -25 },   // 0xB2
-        {  1216,  16,  32,  16,    0,  -25 },   // 0xB3
-        {  1280,  16,  32,  16,    0,  -25 },   // 0xB4
-        {  1344,  16,  32,  16,    0,  -25 },   // 0xB5
-        {  1408,  16,  32,  16,    0,  -25 },   // 0xB6
-        {  1472,  16,  32,  16,    0,  -25 },   // 0xB7
-        {  1536,  16,  32,  16,    0,  -25 },   // 0xB8
-        {  1600,  16,  32,  16,    0,  -25 },   // 0xB9
-        {  1664,  16,  32,  16,    0,  -25 },   // 0xBA
-        {  1728,  16,  32,  16,    0,  -25 },   // 0xBB
-        {  1792,  16,  32,  16,    0,  -25 },   // 0xBC
-        {  1856,  16,  32,  16,    0,  -25 },   // 0xBD
-        {  1920,  16,  32,  16,    0,  -25 },   // 0xBE
-        {  1984,  16,  32,  16,    0,  -25 },   // 0xBF
-        {  2048,  16,  32,  16,    0,  -25 },   // 0xC0
-        {  2112,  16,  32,  16,    0,  -25 },   // 0xC1
-        {  2176,  16,  32,  16,    0,  -25 },   // 0xC2
-        {  2240,  16,  32,  16,    0,  -25 },   // 0xC3
-        {  2304,  16,  32,  16,    0,  -25 },   // 0xC4
-        {  2368,  16,  32,  16,    0,  -25 },   // 0xC5
-        {  2432,  16,  32,  16,    0,  -25 },   // 0xC6
-        {  2496,  16,  32,  16,    0,  -25 },   // 0xC7
-        {  2560,  16,  32,  16,    0,  -25 },   // 0xC8
-        {  2624,  16,  32,  16,    0,  -25 },   // 0xC9
-        {  2688,  16,  32,  16,    0,  -25 },   // 0xCA
-        {  2752,  16,  32,  16,    0,  -25 },   // 0xCB
-        {  2816,  16,  32,  16,    0,  -25 },   // 0xCC
-        {  2880,  16,  32,  16,    0,  -25 },   // 0xCD
-        {  2944,  16,  32,  16,    0,  -25 },   // 0xCE
-        {  3008,  16,  32,  16,    0,  -25 },   // 0xCF
-        {  3072,  16,  32,  16,    0,  -25 },   // 0xD0
-        {  3136,  16,  32,  16,    0,  -25 },   // 0xD1
-        {  3200,  16,  32,  16,    0,  -25 },   // 0xD2
-        {  3264,  16,  32,  16,    0,  -25 },   // 0xD3
-        {  3328,  16,  32,  16,    0,  -25 },   // 0xD4
-        {  3392,  16,  32,  16,    0,  -25 },   // 0xD5
-        {  3456,  16,  32,  16,    0,  -25 },   // 0xD6
-        {  3520,  16,  32,  16,    0,  -25 },   // 0xD7
-        {  3584,  16,  32,  16,    0,  -25 },   // 0xD8
-        {  3648,  16,  32,  16,    0,  -25 },   // 0xD9
-        {  3712,  16,  32,  16,    0,  -25 },   // 0xDA
-        {  3776,  16,  32,  16,    0,  -25 },   // 0xDB
-        {  3840,  16,  32,  16,    0,  -25 },   // 0xDC
-        {  3904,  16,  32,  16,    0,  -25 },   // 0xDD
-        {  3968,  16,  32,  16,    0,  -25 },   // 0xDE
-        {  4032,  16,  32,  16,    0,  -25 },   // 0xDF
-        {  4096,  16,  32,  16,    0,  -25 },   // 0xE0
-        {  4160,  16,  32,  16,    0,  -25 },   // 0xE1
-        {  4224,  16,  32,  16,    0,  -25 },   // 0xE2
-        {  4288,  16,  32,  16,    0,  -25 },   // 0xE3
-        {  4352,  16,  32,  16,    0,  -25 },   // 0xE4
-        {  4416,  16,  32,  16,    0,  -25 },   // 0xE5
-        {  4480,  16,  32,  16,    0,  -25 },   // 0xE6
-        {  4544,  16,  32,  16,    0,  -25 },   // 0xE7
-        {  4608,  16,  32,  16,    0,  -25 },   // 0xE8
-        {  4672,  16,  32,  16,    0,  -25 },   // 0xE9
-        {  4736,  16,  32,  16,    0,  -25 },   // 0xEA
-        {  4800,  16,  32,  16,    0,  -25 },   // 0xEB
-        {  4864,  16,  32,  16,    0,  -25 },   // 0xEC
-        {  4928,  16,  32,  16,    0,  -25 },   // 0xED
-        {  4992,  16,  32,  16,    0,  -25 },   // 0xEE
-        {  5056,  16,  32,  16,    0,  -25 },   // 0xEF
-        {  5120,  16,  32,  16,    0,  -25 },   // 0xF0
-        {  5184,  16,  32,  16,    0,  -25 },   // 0xF1
-        {  5248,  16,  32,  16,    0,  -25 },   // 0xF2
-        {  5312,  16,  32,  16,    0,  -25 },   // 0xF3
-        {  5376,  16,  32,  16,    0,  -25 },   // 0xF4
-        {  5440,  16,  32,  16,    0,  -25 },   // 0xF5
-        {  5504,  16,  32,  16,    0,  -25 },   // 0xF6
-        {  5568,  16,  32,  16,    0,  -25 },   // 0xF7
-        {  5632,  16,  32,  16,    0,  -25 },   // 0xF8
-        {  5696,  16,  32,  16,    0,  -25 },   // 0xF9
-        {  5760,  16,  32,  16,    0,  -25 },   // 0xFA
-        {  5824,  16,  32,  16,    0,  -25 },   // 0xFB
-        {  5888,  16,  32,  16,    0,  -25 },   // 0xFC
-        {  5952,  16,  32,  16,    0,  -25 },   // 0xFD
-        {  6016,  16,  32,  16,    0,  -25 },   // 0xFE
-        {  6080,  16,  32,  16,    0,  -25 },   // 0xFF
+        {     0,   0,  32,  16,    0,  -25 },   // 0xA0
+        {     0,   3,  32,  16,    6,  -25 },   // 0xA1
+        {    11,  13,  32,  16,    1,  -25 },   // 0xA2
+        {    48,  13,  32,  16,    1,  -25 },   // 0xA3
+        {    85,  13,  32,  16,    1,  -25 },   // 0xA4
+        {   112,  13,  32,  16,    1,  -25 },   // 0xA5
+        {   149,   3,  32,  16,    6,  -25 },   // 0xA6
+        {   159,  10,  32,  16,    3,  -25 },   // 0xA7
+        {   192,   9,  32,  16,    3,  -25 },   // 0xA8
+        {   201,  14,  32,  16,    1,  -25 },   // 0xA9
+        {   233,  11,  32,  16,    2,  -25 },   // 0xAA
+        {   255,  14,  32,  16,    1,  -25 },   // 0xAB
+        {   284,  13,  32,  16,    1,  -25 },   // 0xAC
+        {   301,  11,  32,  16,    2,  -25 },   // 0xAD
+        {   308,  14,  32,  16,    1,  -25 },   // 0xAE
+        {   340,   9,  32,  16,    3,  -25 },   // 0xAF
+        {   347,   9,  32,  16,    3,  -25 },   // 0xB0
+        {   360,  13,  32,  16,    1,  -25 },   // 0xB1
+        {   387,   9,  32,  16,    3,  -25 },   // 0xB2
+        {   404,   9,  32,  16,    3,  -25 },   // 0xB3
+        {   421,   6,  32,  16,    6,  -25 },   // 0xB4
+        {   428,  13,  32,  16,    1,  -25 },   // 0xB5
+        {   463,  14,  32,  16,    1,  -25 },   // 0xB6
+        {   502,   3,  32,  16,    6,  -25 },   // 0xB7
+        {   508,   5,  32,  16,    4,  -25 },   // 0xB8
+        {   516,   7,  32,  16,    4,  -25 },   // 0xB9
+        {   530,  11,  32,  16,    2,  -25 },   // 0xBA
+        {   552,  14,  32,  16,    1,  -25 },   // 0xBB
+        {   581,  14,  32,  16,    1,  -25 },   // 0xBC
+        {   620,  14,  32,  16,    1,  -25 },   // 0xBD
+        {   659,  14,  32,  16,    1,  -25 },   // 0xBE
+        {   698,  13,  32,  16,    1,  -25 },   // 0xBF
+        {   732,  13,  32,  16,    1,  -25 },   // 0xC0
+        {   775,  13,  32,  16,    1,  -25 },   // 0xC1
+        {   818,  13,  32,  16,    1,  -25 },   // 0xC2
+        {   861,  13,  32,  16,    1,  -25 },   // 0xC3
+        {   904,  13,  32,  16,    1,  -25 },   // 0xC4
+        {   947,  13,  32,  16,    1,  -25 },   // 0xC5
+        {   992,  15,  32,  16,    0,  -25 },   // 0xC6
+        {  1034,  13,  32,  16,    1,  -25 },   // 0xC7
+        {  1079,  13,  32,  16,    1,  -25 },   // 0xC8
+        {  1122,  13,  32,  16,    1,  -25 },   // 0xC9
+        {  1165,  13,  32,  16,    1,  -25 },   // 0xCA
+        {  1208,  13,  32,  16,    1,  -25 },   // 0xCB
+        {  1251,   8,  32,  16,    3,  -25 },   // 0xCC
+        {  1279,   8,  32,  16,    4,  -25 },   // 0xCD
+        {  1307,   9,  32,  16,    3,  -25 },   // 0xCE
+        {  1338,   9,  32,  16,    3,  -25 },   // 0xCF
+        {  1369,  14,  32,  16,    0,  -25 },   // 0xD0
+        {  1408,  13,  32,  16,    1,  -25 },   // 0xD1
+        {  1451,  13,  32,  16,    1,  -25 },   // 0xD2
+        {  1494,  13,  32,  16,    1,  -25 },   // 0xD3
+        {  1537,  13,  32,  16,    1,  -25 },   // 0xD4
+        {  1580,  13,  32,  16,    1,  -25 },   // 0xD5
+        {  1623,  13,  32,  16,    1,  -25 },   // 0xD6
+        {  1666,  14,  32,  16,    1,  -25 },   // 0xD7
+        {  1691,  15,  32,  16,    0,  -25 },   // 0xD8
+        {  1733,  13,  32,  16,    1,  -25 },   // 0xD9
+        {  1776,  13,  32,  16,    1,  -25 },   // 0xDA
+        {  1819,  13,  32,  16,    1,  -25 },   // 0xDB
+        {  1862,  13,  32,  16,    1,  -25 },   // 0xDC
+        {  1905,  13,  32,  16,    1,  -25 },   // 0xDD
+        {  1948,  13,  32,  16,    1,  -25 },   // 0xDE
+        {  1985,  13,  32,  16,    1,  -25 },   // 0xDF
+        {  2022,  13,  32,  16,    1,  -25 },   // 0xE0
+        {  2056,  13,  32,  16,    1,  -25 },   // 0xE1
+        {  2090,  13,  32,  16,    1,  -25 },   // 0xE2
+        {  2124,  13,  32,  16,    1,  -25 },   // 0xE3
+        {  2158,  13,  32,  16,    1,  -25 },   // 0xE4
+        {  2192,  13,  32,  16,    1,  -25 },   // 0xE5
+        {  2227,  15,  32,  16,    0,  -25 },   // 0xE6
+        {  2258,  13,  32,  16,    1,  -25 },   // 0xE7
+        {  2293,  13,  32,  16,    1,  -25 },   // 0xE8
+        {  2327,  13,  32,  16,    1,  -25 },   // 0xE9
+        {  2361,  13,  32,  16,    1,  -25 },   // 0xEA
+        {  2395,  13,  32,  16,    1,  -25 },   // 0xEB
+        {  2429,   8,  32,  16,    3,  -25 },   // 0xEC
+        {  2451,   8,  32,  16,    4,  -25 },   // 0xED
+        {  2473,   9,  32,  16,    3,  -25 },   // 0xEE
+        {  2498,   9,  32,  16,    3,  -25 },   // 0xEF
+        {  2523,  13,  32,  16,    1,  -25 },   // 0xF0
+        {  2560,  13,  32,  16,    1,  -25 },   // 0xF1
+        {  2594,  13,  32,  16,    1,  -25 },   // 0xF2
+        {  2628,  13,  32,  16,    1,  -25 },   // 0xF3
+        {  2662,  13,  32,  16,    1,  -25 },   // 0xF4
+        {  2696,  13,  32,  16,    1,  -25 },   // 0xF5
+        {  2730,  13,  32,  16,    1,  -25 },   // 0xF6
+        {  2764,  13,  32,  16,    1,  -25 },   // 0xF7
+        {  2785,  15,  32,  16,    0,  -25 },   // 0xF8
+        {  2816,  13,  32,  16,    1,  -25 },   // 0xF9
+        {  2850,  13,  32,  16,    1,  -25 },   // 0xFA
+        {  2884,  13,  32,  16,    1,  -25 },   // 0xFB
+        {  2918,  13,  32,  16,    1,  -25 },   // 0xFC
+        {  2952,  13,  32,  16,    1,  -25 },   // 0xFD
+        {  2994,  13,  32,  16,    1,  -25 },   // 0xFE
+        {  3039,  13,  32,  16,    1,  -25 },   // 0xFF
       },  0x20, 0x7f, 0
 
-    }, 0x80, 0xa0, 0xff
+    }, 0x80, 0xa0, 0xff, true
   },
-  // Approx. 6823 bytes
+  // Approx. 3760 bytes
 
   {
     {
       (uint8_t[]){
-        0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xe0, 0x7f, 0xe0, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xe0,
-        0x7f, 0xe0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80,
-        0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xf8,
-        0x1f, 0xfc, 0x1c, 0x1e, 0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x0e,
-        0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x1e, 0x1c, 0x7c, 0x1c, 0x78,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xe0,
-        0x7f, 0xe0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x78, 0x00, 0x3f, 0xf0, 0x1f, 0xf8, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0xe0, 0x0f, 0xe0, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70,
-        0x1c, 0x70, 0x00, 0x00, 0x0f, 0xe0, 0x0f, 0xe0, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0xfe,
-        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-        0x70, 0x38, 0x70, 0x38, 0x70, 0x38, 0x78, 0x78, 0x3f, 0xf0, 0x1f, 0xe0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0x80, 0x3f, 0x80, 0x7b, 0x80, 0x73, 0x80, 0x73, 0x80, 0x73, 0x80,
-        0x73, 0x80, 0x73, 0xf8, 0x73, 0xfc, 0x73, 0x9e, 0x73, 0x8e, 0x73, 0x8e,
-        0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x9e,
-        0xf3, 0xfc, 0xe3, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80,
-        0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0xf8, 0xe3, 0xfc, 0xff, 0x9e,
-        0xff, 0x8e, 0xe3, 0x8e, 0xe3, 0x8e, 0xe3, 0x8e, 0xe3, 0x8e, 0xe3, 0x8e,
-        0xe3, 0x8e, 0xe3, 0x9e, 0xe3, 0xfc, 0xe3, 0xf8, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80,
-        0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xf8,
-        0x1f, 0xfc, 0x1c, 0x1e, 0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x0e,
-        0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x0e, 0x1c, 0x0e,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x70, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x00, 0x00,
-        0x70, 0x0c, 0x70, 0x1c, 0x70, 0x38, 0x70, 0x70, 0x70, 0xe0, 0x71, 0xc0,
-        0x73, 0x80, 0x77, 0x00, 0x7e, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7e, 0x00,
-        0x77, 0x00, 0x73, 0x80, 0x71, 0xc0, 0x70, 0xe0, 0x70, 0x70, 0x70, 0x38,
-        0x70, 0x1c, 0x70, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00,
-        0x03, 0x80, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c, 0x70, 0x7c, 0x70, 0xfc, 0x71, 0xdc,
-        0x73, 0x9c, 0x77, 0x1c, 0x7e, 0x1c, 0x7c, 0x1c, 0x78, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70,
-        0x1c, 0x70, 0x0f, 0xe0, 0x07, 0xc0, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x7f, 0xf8,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xf0,
-        0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x38, 0x7f, 0xf0, 0x7f, 0xf0, 0x70, 0x38, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c,
-        0x7f, 0xf8, 0x7f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x1f, 0xf8,
-        0x3c, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-        0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-        0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x7f, 0xfc, 0xff, 0xfe,
-        0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x0e, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xe0, 0x7f, 0xe0, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x3b, 0xb8, 0x1f, 0xf0, 0x0f, 0xe0,
-        0x0f, 0xe0, 0x1f, 0xf0, 0x3b, 0xb8, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x3c, 0x0f, 0xf8, 0x0f, 0xf8, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x3c, 0x70, 0x7c, 0x70, 0xfc, 0x71, 0xdc, 0x73, 0x9c, 0x77, 0x1c,
-        0x7e, 0x1c, 0x7c, 0x1c, 0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x0f, 0xe0,
-        0x07, 0xc0, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c, 0x70, 0x7c, 0x70, 0xfc, 0x71, 0xdc,
-        0x73, 0x9c, 0x77, 0x1c, 0x7e, 0x1c, 0x7c, 0x1c, 0x78, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x0c, 0x70, 0x1c,
-        0x70, 0x38, 0x70, 0x70, 0x70, 0xe0, 0x71, 0xc0, 0x73, 0x80, 0x77, 0x00,
-        0x7e, 0x00, 0x7c, 0x00, 0x7c, 0x00, 0x7e, 0x00, 0x77, 0x00, 0x73, 0x80,
-        0x71, 0xc0, 0x70, 0xe0, 0x70, 0x70, 0x70, 0x38, 0x70, 0x1c, 0x70, 0x0c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x07, 0xfc, 0x0f, 0xfc, 0x1e, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
-        0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
-        0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
-        0x38, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x0e, 0x70, 0x0e, 0x78, 0x1e, 0x7c, 0x3e,
-        0x7e, 0x7e, 0x7e, 0x7e, 0x77, 0xee, 0x73, 0xce, 0x73, 0xce, 0x71, 0x8e,
-        0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e,
-        0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x7f, 0xf8,
-        0x70, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x7b, 0xbc, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x7b, 0xbc,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x38, 0x38, 0x38, 0x38,
-        0x1c, 0x70, 0x1c, 0x70, 0x0e, 0xe0, 0x0e, 0xe0, 0x07, 0xc0, 0x07, 0xc0,
-        0x07, 0xc0, 0x07, 0xc0, 0x0e, 0xe0, 0x0e, 0xe0, 0x1c, 0x70, 0x1c, 0x70,
-        0x38, 0x38, 0x38, 0x38, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1e, 0x3f, 0xff, 0x1f, 0xff,
-        0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x7b, 0x9c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x7b, 0x9c, 0x3f, 0xfe, 0x1f, 0xff,
-        0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xf8, 0x00, 0xf8, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
-        0x3f, 0xf0, 0x3f, 0xf8, 0x38, 0x3c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c,
-        0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x3c,
-        0x3f, 0xf8, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e,
-        0x70, 0x0e, 0x70, 0x0e, 0x7f, 0x0e, 0x7f, 0x8e, 0x73, 0xce, 0x71, 0xce,
-        0x71, 0xce, 0x71, 0xce, 0x71, 0xce, 0x71, 0xce, 0x71, 0xce, 0x71, 0xce,
-        0x71, 0xce, 0x73, 0xce, 0x7f, 0x8e, 0x7f, 0x0e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00,
-        0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3f, 0xf0, 0x3f, 0xf8,
-        0x38, 0x3c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c,
-        0x38, 0x1c, 0x38, 0x1c, 0x38, 0x1c, 0x38, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x0f, 0xfc, 0x0f, 0xfc, 0x00, 0x1c,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0xf8, 0x71, 0xfc, 0x73, 0x8e, 0x73, 0x8e,
-        0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x7f, 0x8e,
-        0x7f, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e,
-        0x73, 0x8e, 0x73, 0x8e, 0x71, 0xfc, 0x70, 0xf8, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x3f, 0xfc,
-        0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0xfc, 0x01, 0xdc,
-        0x03, 0x9c, 0x07, 0x1c, 0x0e, 0x1c, 0x1c, 0x1c, 0x38, 0x1c, 0x70, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x3f, 0xf0, 0x3f, 0xf8, 0x00, 0x3c, 0x00, 0x1c, 0x00, 0x1c, 0x1f, 0xfc,
-        0x3f, 0xfc, 0x78, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf0, 0x78, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x7f, 0xe0,
-        0x70, 0xf0, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0xe0,
-        0x7f, 0xe0, 0x7f, 0xf0, 0x70, 0x38, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x3f, 0xfc, 0x78, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xf8,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x3b, 0xb8, 0x1f, 0xf0,
-        0x0f, 0xe0, 0x1f, 0xf0, 0x3b, 0xb8, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c,
-        0x00, 0x1c, 0x00, 0x3c, 0x07, 0xf8, 0x07, 0xf8, 0x00, 0x3c, 0x00, 0x1c,
-        0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1c, 0x70, 0x1c, 0x70, 0x0f, 0xe0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x38, 0x38, 0x38, 0x70, 0x38, 0xe0,
-        0x39, 0xc0, 0x3b, 0x80, 0x3f, 0x00, 0x3f, 0x00, 0x3b, 0x80, 0x39, 0xc0,
-        0x38, 0xe0, 0x38, 0x70, 0x38, 0x38, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x0f, 0xfc,
-        0x1e, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
-        0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x38, 0x1c, 0x70, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x60, 0x06, 0x70, 0x0e, 0x78, 0x1e, 0x7c, 0x3e, 0x7e, 0x7e, 0x77, 0xee,
-        0x73, 0xce, 0x71, 0x8e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e,
-        0x70, 0x0e, 0x70, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x7f, 0xf0, 0x7f, 0xf8, 0x70, 0x3c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x3c, 0x7f, 0xf8, 0x7f, 0xf0, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x7b, 0xbc, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x7b, 0xbc, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x38, 0x38, 0x1c, 0x70, 0x0e, 0xe0,
-        0x07, 0xc0, 0x07, 0xc0, 0x0e, 0xe0, 0x1c, 0x70, 0x38, 0x38, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfe, 0x1f, 0xff, 0x00, 0x07, 0x00, 0x07,
-        0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc,
-        0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x7b, 0x9c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c, 0x73, 0x9c,
-        0x73, 0x9c, 0x7b, 0x9c, 0x3f, 0xfe, 0x1f, 0xff, 0x00, 0x07, 0x00, 0x07,
-        0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x7c, 0x00,
-        0x1c, 0x00, 0x1c, 0x00, 0x1f, 0xf0, 0x1f, 0xf8, 0x1c, 0x3c, 0x1c, 0x1c,
-        0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x3c, 0x1f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x70, 0x0e, 0x7f, 0x0e, 0x7f, 0x8e,
-        0x73, 0xce, 0x71, 0xce, 0x71, 0xce, 0x71, 0xce, 0x71, 0xce, 0x73, 0xce,
-        0x7f, 0x8e, 0x7f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
-        0x3f, 0xe0, 0x3f, 0xf0, 0x38, 0x78, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
-        0x38, 0x38, 0x38, 0x78, 0x3f, 0xf0, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x07, 0xfc, 0x07, 0xfc,
-        0x00, 0x1c, 0x00, 0x1c, 0x70, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0xf8, 0x71, 0xfc, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e,
-        0x7f, 0x8e, 0x7f, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e,
-        0x71, 0xfc, 0x70, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x3f, 0xfc, 0x78, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x01, 0xdc, 0x03, 0x9c,
-        0x07, 0x1c, 0x0e, 0x1c, 0x1c, 0x1c, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x0e, 0x00,
-        0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8,
-        0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xf8,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x7f, 0xfc, 0x7f, 0xfc, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0xff, 0xc0, 0xff, 0xc0,
-        0x38, 0x00, 0x38, 0x00, 0x3f, 0xf8, 0x3f, 0xfc, 0x38, 0x1e, 0x38, 0x0e,
-        0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e,
-        0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x00, 0x0e, 0x00, 0x0e,
-        0x00, 0x1e, 0x00, 0xfc, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0,
-        0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x1c, 0x70, 0x00, 0x70, 0x00,
-        0x7f, 0xc0, 0x7f, 0xc0, 0x70, 0x00, 0x70, 0x00, 0x70, 0x1c, 0x78, 0x3c,
-        0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x3f, 0xf8, 0x78, 0x3c, 0x70, 0x00,
-        0x70, 0x00, 0x78, 0x00, 0x3f, 0xf0, 0x1f, 0xf8, 0x00, 0x3c, 0x00, 0x1c,
-        0x00, 0x1c, 0x78, 0x3c, 0x3f, 0xf8, 0x1f, 0xf0, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0x0f, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x0f, 0xe0, 0x0f, 0xe0,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x00, 0x00, 0x00, 0x00,
-        0x0f, 0x80, 0x0f, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80,
-        0x0f, 0xe0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x38, 0x00, 0x38,
-        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38,
-        0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x38, 0x38, 0x38, 0x38,
-        0x3c, 0x78, 0x1f, 0xf0, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x3f, 0x80,
-        0x7b, 0x80, 0x73, 0x80, 0x73, 0xf8, 0x73, 0xfc, 0x73, 0x9e, 0x73, 0x8e,
-        0x73, 0x8e, 0x73, 0x8e, 0x73, 0x8e, 0x73, 0x9e, 0xf3, 0xfc, 0xe3, 0xf8,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0x80, 0xe3, 0xf8, 0xe3, 0xfc,
-        0xff, 0x9e, 0xff, 0x8e, 0xe3, 0x8e, 0xe3, 0x8e, 0xe3, 0x8e, 0xe3, 0x9e,
-        0xe3, 0xfc, 0xe3, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0xff, 0xc0, 0xff, 0xc0,
-        0x38, 0x00, 0x38, 0x00, 0x3f, 0xf8, 0x3f, 0xfc, 0x38, 0x1e, 0x38, 0x0e,
-        0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e,
-        0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x38, 0x0e, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0xe0,
-        0x01, 0xc0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x38, 0x1c, 0x38, 0x38,
-        0x38, 0x70, 0x38, 0xe0, 0x39, 0xc0, 0x3b, 0x80, 0x3f, 0x00, 0x3f, 0x00,
-        0x3b, 0x80, 0x39, 0xc0, 0x38, 0xe0, 0x38, 0x70, 0x38, 0x38, 0x38, 0x1c,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x1c, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x78, 0x1c,
-        0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x1c, 0x70, 0x1c, 0x70, 0x0f, 0xe0, 0x07, 0xc0,
-        0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x78, 0x1c, 0x3f, 0xfc, 0x1f, 0xfc, 0x00, 0x1c, 0x00, 0x1c,
-        0x00, 0x3c, 0x3f, 0xf8, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c,
-        0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x70, 0x1c, 0x7f, 0xfc, 0x7f, 0xfc,
-        0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00
+        0x7b, 0xff, 0xff, 0xc0, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x0f, 0xff,
+        0xff, 0xff, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e,
+        0x00, 0x7f, 0xe3, 0xff, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0,
+        0x0e, 0x00, 0x70, 0x03, 0xff, 0xff, 0xff, 0x7b, 0xff, 0xff, 0xc0, 0x38,
+        0xe1, 0xc7, 0x0e, 0x38, 0x71, 0xcf, 0xff, 0xff, 0xff, 0x80, 0x1c, 0x00,
+        0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x7f, 0xe3, 0xff, 0x1c,
+        0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0xff,
+        0xff, 0xff, 0x03, 0xff, 0xff, 0xc0, 0xff, 0x81, 0xff, 0x00, 0x70, 0x00,
+        0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0f, 0xfc, 0x1f, 0xfc, 0x38,
+        0x3c, 0x70, 0x38, 0xe0, 0x71, 0xc0, 0xe3, 0x81, 0xc7, 0x03, 0x8e, 0x07,
+        0x1c, 0x0e, 0x38, 0x3c, 0x71, 0xf0, 0xe3, 0xc0, 0x7b, 0xff, 0xff, 0xc0,
+        0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0x80, 0x1c,
+        0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80,
+        0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03,
+        0x80, 0x1c, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0xfe, 0x3f,
+        0xf1, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x07, 0xe0, 0x3f, 0x83,
+        0xdf, 0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc,
+        0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xf0, 0x03, 0xff,
+        0x0f, 0xfc, 0x00, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xfc, 0x07, 0xe0, 0x3f,
+        0x83, 0xdf, 0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xfc, 0xe1,
+        0xc3, 0x87, 0x0e, 0x1c, 0x38, 0x70, 0xe1, 0xc3, 0x87, 0x0e, 0x1c, 0x38,
+        0x73, 0xff, 0xf0, 0x7b, 0xff, 0xff, 0xc0, 0xe3, 0xf1, 0xf8, 0xfc, 0x77,
+        0xf3, 0xf8, 0x70, 0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70,
+        0x38, 0x1c, 0x0e, 0x07, 0x03, 0x81, 0xc0, 0xe1, 0xfc, 0xfe, 0x03, 0xff,
+        0xff, 0xc0, 0x01, 0xfc, 0x07, 0xf0, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x01,
+        0xc0, 0x07, 0x00, 0x1c, 0x00, 0x70, 0x01, 0xc0, 0x07, 0x00, 0x1c, 0x00,
+        0x70, 0x01, 0xce, 0x07, 0x38, 0x1c, 0xe0, 0x73, 0xc3, 0xc7, 0xfe, 0x0f,
+        0xf0, 0x03, 0xff, 0xff, 0xc0, 0x1f, 0x80, 0x7f, 0x01, 0xee, 0x03, 0x9c,
+        0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0, 0x39, 0xfc, 0x73, 0xfc, 0xe7, 0x3d,
+        0xce, 0x3b, 0x9c, 0x77, 0x38, 0xee, 0x71, 0xdc, 0xe3, 0xb9, 0xc7, 0x73,
+        0x8e, 0xe7, 0x3f, 0xcf, 0xf7, 0x1f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xe3,
+        0x81, 0xc7, 0x03, 0x8e, 0x07, 0x1c, 0x0e, 0x38, 0x1c, 0x70, 0x38, 0xe0,
+        0x71, 0xfc, 0xe3, 0xfd, 0xff, 0x3f, 0xfe, 0x3f, 0x1c, 0x7e, 0x38, 0xfc,
+        0x71, 0xf8, 0xe3, 0xf1, 0xc7, 0xe3, 0x8f, 0xc7, 0x3f, 0x8f, 0xf7, 0x1f,
+        0xc0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0x81, 0xff, 0x00, 0x70, 0x00, 0xe0,
+        0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0f, 0xfc, 0x1f, 0xfc, 0x38, 0x3c,
+        0x70, 0x38, 0xe0, 0x71, 0xc0, 0xe3, 0x81, 0xc7, 0x03, 0x8e, 0x07, 0x1c,
+        0x0e, 0x38, 0x1c, 0x70, 0x38, 0xe0, 0x70, 0x7b, 0xff, 0xff, 0xc0, 0x00,
+        0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x0e, 0x01, 0xf0, 0x1f, 0x81, 0xdc, 0x1c,
+        0xe1, 0xc7, 0x1c, 0x39, 0xc1, 0xdc, 0x0f, 0xc0, 0x7c, 0x03, 0xe0, 0x1f,
+        0x80, 0xee, 0x07, 0x38, 0x38, 0xe1, 0xc3, 0x8e, 0x0e, 0x70, 0x3b, 0x80,
+        0xfc, 0x03, 0x7b, 0xff, 0xff, 0xc0, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e,
+        0x0e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x1f,
+        0xc1, 0xfe, 0x1f, 0xf1, 0xdf, 0x9c, 0xfd, 0xc7, 0xfc, 0x3f, 0xc1, 0xfc,
+        0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0x7b, 0xff, 0xff,
+        0xc0, 0x38, 0xe1, 0xc7, 0x07, 0xf0, 0x1f, 0x0e, 0x03, 0xf0, 0x1f, 0x80,
+        0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x1d,
+        0xff, 0xe7, 0xff, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80,
+        0x3d, 0xff, 0xcf, 0xfc, 0x03, 0xff, 0xff, 0xfe, 0xe0, 0x3f, 0x01, 0xf8,
+        0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01,
+        0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x01, 0xff, 0xff, 0xff, 0xf0, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07,
+        0x00, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xff, 0xff, 0xff,
+        0xfe, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x70, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xf7, 0xff, 0xb8, 0x01, 0xc0,
+        0x0e, 0x00, 0x70, 0x03, 0x80, 0x1f, 0xfc, 0xff, 0xf7, 0x03, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x03, 0xff,
+        0xfd, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xe7, 0xff, 0xb8, 0x1f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x0e, 0xff, 0xe7, 0xff, 0x38,
+        0x1d, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x03,
+        0xff, 0xfd, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xf8,
+        0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00,
+        0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07,
+        0x00, 0x38, 0x01, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xfc, 0x0f, 0xf8, 0x3f,
+        0xf0, 0xf0, 0xe1, 0xc1, 0xc3, 0x83, 0x87, 0x07, 0x0e, 0x0e, 0x1c, 0x1c,
+        0x38, 0x38, 0x70, 0x70, 0xe0, 0xe1, 0xc1, 0xc3, 0x83, 0x87, 0x07, 0x0e,
+        0x0e, 0x1c, 0x1c, 0x38, 0x38, 0x70, 0x71, 0xff, 0xf7, 0xff, 0xfe, 0x00,
+        0xfc, 0x01, 0xf8, 0x03, 0xf0, 0x07, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff,
+        0xff, 0xf8, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0xfe, 0x3f, 0xf1, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00,
+        0xe0, 0x07, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xc0, 0xe7,
+        0x3f, 0x39, 0xf9, 0xcf, 0xce, 0x7e, 0x73, 0xf3, 0x9f, 0x9c, 0xee, 0xee,
+        0x3f, 0xe0, 0xfe, 0x07, 0xf0, 0x7f, 0xc7, 0x77, 0x73, 0x9f, 0x9c, 0xfc,
+        0xe7, 0xe7, 0x3f, 0x39, 0xf9, 0xcf, 0xce, 0x70, 0x03, 0xff, 0xff, 0xc0,
+        0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0x00, 0x78, 0xff, 0x87, 0xfc, 0x00, 0xf0, 0x03, 0x80, 0x1c, 0x00,
+        0xfc, 0x07, 0xe0, 0x3f, 0x83, 0xdf, 0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff,
+        0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x81,
+        0xfc, 0x1f, 0xe1, 0xff, 0x1d, 0xf9, 0xcf, 0xdc, 0x7f, 0xc3, 0xfc, 0x1f,
+        0xc0, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x70, 0x7b, 0xff,
+        0xff, 0xc0, 0x38, 0xe1, 0xc7, 0x07, 0xf0, 0x1f, 0x0e, 0x03, 0xf0, 0x1f,
+        0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x1f, 0xc1, 0xfe, 0x1f, 0xf1,
+        0xdf, 0x9c, 0xfd, 0xc7, 0xfc, 0x3f, 0xc1, 0xfc, 0x0f, 0xc0, 0x7e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfc, 0x07, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x1f, 0x01,
+        0xf8, 0x1d, 0xc1, 0xce, 0x1c, 0x71, 0xc3, 0x9c, 0x1d, 0xc0, 0xfc, 0x07,
+        0xc0, 0x3e, 0x01, 0xf8, 0x0e, 0xe0, 0x73, 0x83, 0x8e, 0x1c, 0x38, 0xe0,
+        0xe7, 0x03, 0xb8, 0x0f, 0xc0, 0x30, 0x03, 0xff, 0xff, 0xc0, 0x0f, 0xf8,
+        0xff, 0xcf, 0x0e, 0x70, 0x73, 0x83, 0x9c, 0x1c, 0xe0, 0xe7, 0x07, 0x38,
+        0x39, 0xc1, 0xce, 0x0e, 0x70, 0x73, 0x83, 0x9c, 0x1c, 0xe0, 0xe7, 0x07,
+        0x38, 0x39, 0xc1, 0xdc, 0x0f, 0xc0, 0x70, 0x03, 0xff, 0xff, 0xc0, 0xe0,
+        0x1f, 0x80, 0x7f, 0x03, 0xfe, 0x1f, 0xfc, 0xff, 0xf3, 0xfe, 0xfd, 0xf9,
+        0xe7, 0xe7, 0x9f, 0x8c, 0x7e, 0x01, 0xf8, 0x07, 0xe0, 0x1f, 0x80, 0x7e,
+        0x01, 0xf8, 0x07, 0xe0, 0x1f, 0x80, 0x7e, 0x01, 0xf8, 0x07, 0x03, 0xff,
+        0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f,
+        0x80, 0xfc, 0x07, 0xe0, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x70, 0x03,
+        0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x83, 0xdf, 0xfc, 0x7f, 0xc0,
+        0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xc0, 0x7e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0,
+        0x70, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xe7, 0xff, 0xb8, 0x1f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x03, 0xff, 0xfd, 0xff,
+        0xce, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01,
+        0xc0, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01,
+        0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x07, 0xe0, 0x3f, 0x83, 0xdf,
+        0xfc, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xc1, 0xc0,
+        0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01,
+        0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38,
+        0x01, 0xc0, 0x0e, 0x00, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8,
+        0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x81,
+        0xdf, 0xfe, 0x7f, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38,
+        0x03, 0xdf, 0xfc, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xf0, 0x07, 0x00, 0x38,
+        0x0f, 0xf8, 0xff, 0xef, 0x77, 0xf3, 0x9f, 0x9c, 0xfc, 0xe7, 0xe7, 0x3f,
+        0x39, 0xf9, 0xcf, 0xce, 0x7e, 0x73, 0xf3, 0x9f, 0x9c, 0xfc, 0xe7, 0xe7,
+        0x3f, 0x39, 0xf9, 0xcf, 0xee, 0xf7, 0xff, 0x1f, 0xf0, 0x1c, 0x00, 0xe0,
+        0x03, 0xff, 0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xdc, 0x1c, 0xe0, 0xe3, 0x8e,
+        0x1c, 0x70, 0x77, 0x03, 0xb8, 0x0f, 0x80, 0x7c, 0x03, 0xe0, 0x1f, 0x01,
+        0xdc, 0x0e, 0xe0, 0xe3, 0x87, 0x1c, 0x70, 0x73, 0x83, 0xb8, 0x0f, 0xc0,
+        0x70, 0x03, 0xff, 0xff, 0xfe, 0xe0, 0x39, 0xc0, 0x73, 0x80, 0xe7, 0x01,
+        0xce, 0x03, 0x9c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0, 0x39, 0xc0, 0x73,
+        0x80, 0xe7, 0x01, 0xce, 0x03, 0x9c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0,
+        0x39, 0xe0, 0x79, 0xff, 0xf9, 0xff, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03,
+        0x80, 0x07, 0x00, 0x0e, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8,
+        0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x81,
+        0xdf, 0xfe, 0x7f, 0xf0, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38,
+        0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0xff, 0xff, 0xc0, 0xe7, 0x3f, 0x39,
+        0xf9, 0xcf, 0xce, 0x7e, 0x73, 0xf3, 0x9f, 0x9c, 0xfc, 0xe7, 0xe7, 0x3f,
+        0x39, 0xf9, 0xcf, 0xce, 0x7e, 0x73, 0xf3, 0x9f, 0x9c, 0xfc, 0xe7, 0xe7,
+        0x3f, 0xb9, 0xdf, 0xfe, 0x7f, 0xf0, 0x03, 0xff, 0xff, 0xfe, 0xe7, 0x39,
+        0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
+        0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
+        0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xee, 0x71, 0xff, 0xf1, 0xff, 0xf0,
+        0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x03, 0xff, 0xff,
+        0xc0, 0xf8, 0x03, 0xe0, 0x03, 0x80, 0x0e, 0x00, 0x38, 0x00, 0xe0, 0x03,
+        0xff, 0x0f, 0xfe, 0x38, 0x3c, 0xe0, 0x73, 0x81, 0xce, 0x07, 0x38, 0x1c,
+        0xe0, 0x73, 0x81, 0xce, 0x07, 0x38, 0x1c, 0xe0, 0xf3, 0xff, 0x8f, 0xfc,
+        0x03, 0xff, 0xff, 0xc0, 0xe0, 0x1f, 0x80, 0x7e, 0x01, 0xf8, 0x07, 0xe0,
+        0x1f, 0x80, 0x7f, 0xe1, 0xff, 0xc7, 0xe7, 0x9f, 0x8e, 0x7e, 0x39, 0xf8,
+        0xe7, 0xe3, 0x9f, 0x8e, 0x7e, 0x39, 0xf8, 0xe7, 0xe3, 0x9f, 0x9e, 0x7f,
+        0xf1, 0xff, 0x87, 0x03, 0xff, 0xff, 0xc0, 0xe0, 0x0e, 0x00, 0xe0, 0x0e,
+        0x00, 0xe0, 0x0e, 0x00, 0xff, 0xcf, 0xfe, 0xe0, 0xfe, 0x07, 0xe0, 0x7e,
+        0x07, 0xe0, 0x7e, 0x07, 0xe0, 0x7e, 0x07, 0xe0, 0x7e, 0x0f, 0xff, 0xef,
+        0xfc, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e,
+        0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0xff, 0xc7, 0xfe, 0x00,
+        0x70, 0x03, 0x80, 0x1c, 0x00, 0xfc, 0x07, 0xe0, 0x3f, 0x83, 0xdf, 0xfc,
+        0x7f, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0xe1, 0xf3, 0x8f, 0xee, 0x71, 0xf9,
+        0xc7, 0xe7, 0x1f, 0x9c, 0x7e, 0x71, 0xf9, 0xc7, 0xe7, 0x1f, 0xfc, 0x7f,
+        0xf1, 0xf9, 0xc7, 0xe7, 0x1f, 0x9c, 0x7e, 0x71, 0xf9, 0xc7, 0xe7, 0x1f,
+        0x9c, 0x7e, 0x3f, 0xb8, 0x7c, 0x03, 0xff, 0xff, 0xc0, 0x3f, 0xfb, 0xff,
+        0xfc, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x81, 0xdf, 0xfe, 0x7f, 0xf0, 0x1f, 0x81, 0xdc, 0x1c, 0xe1, 0xc7, 0x1c,
+        0x39, 0xc1, 0xdc, 0x0f, 0xc0, 0x70, 0x00, 0x0f, 0xff, 0xc0, 0x7f, 0xe3,
+        0xff, 0x80, 0x1e, 0x00, 0x70, 0x03, 0x9f, 0xfd, 0xff, 0xfe, 0x07, 0xe0,
+        0x3f, 0x01, 0xf8, 0x0f, 0xe0, 0x77, 0xff, 0x9f, 0xfc, 0x03, 0xff, 0xff,
+        0xc0, 0x3f, 0xe3, 0xff, 0x3c, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80,
+        0x1f, 0xfc, 0xff, 0xf7, 0x03, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f,
+        0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x03, 0xff, 0xfd, 0xff, 0xc0, 0x03, 0xff,
+        0xff, 0xc0, 0x7f, 0x87, 0xfe, 0x38, 0x79, 0xc1, 0xce, 0x0e, 0x70, 0x73,
+        0x83, 0x9c, 0x38, 0xff, 0xc7, 0xff, 0x38, 0x1d, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x03, 0xff, 0xfd, 0xff, 0xc0, 0x00,
+        0x0f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xc0, 0x0e, 0x00, 0x70,
+        0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00,
+        0x70, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x3f, 0xfb, 0xff, 0xfc, 0x0f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xe0, 0x77, 0xff, 0x9f, 0xfc, 0x00, 0xe0, 0x07, 0x00, 0x7b, 0xff, 0x9f,
+        0xf8, 0x00, 0x0f, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e,
+        0x03, 0xf0, 0x1f, 0xff, 0xff, 0xff, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xe0,
+        0x77, 0xff, 0x9f, 0xf8, 0x00, 0x0f, 0xff, 0xc0, 0xe7, 0x3f, 0x39, 0xf9,
+        0xcf, 0xce, 0x77, 0x77, 0x1f, 0xf0, 0x7f, 0x07, 0xfc, 0x77, 0x77, 0x39,
+        0xf9, 0xcf, 0xce, 0x7e, 0x73, 0xf3, 0x9c, 0x00, 0x0f, 0xff, 0xc0, 0x3f,
+        0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x70, 0x03, 0x80, 0x3c, 0x3f, 0xc1, 0xfe,
+        0x00, 0x78, 0x01, 0xf8, 0x0f, 0xe0, 0xf7, 0xff, 0x1f, 0xf0, 0x00, 0x0f,
+        0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f,
+        0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xe0, 0x77, 0xff, 0x9f,
+        0xfc, 0x03, 0xcf, 0xff, 0xc0, 0x38, 0xe1, 0xc7, 0x07, 0xf0, 0x1f, 0x0e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9, 0xff, 0xc0, 0x00,
+        0x0f, 0xff, 0xc0, 0xe0, 0x7e, 0x0e, 0xe1, 0xce, 0x38, 0xe7, 0x0e, 0xe0,
+        0xfc, 0x0f, 0xc0, 0xee, 0x0e, 0x70, 0xe3, 0x8e, 0x1c, 0xe0, 0xee, 0x07,
+        0x00, 0x0f, 0xff, 0xc0, 0x0f, 0xf8, 0xff, 0xcf, 0x0e, 0x70, 0x73, 0x83,
+        0x9c, 0x1c, 0xe0, 0xe7, 0x07, 0x38, 0x39, 0xc1, 0xce, 0x0e, 0x70, 0x77,
+        0x03, 0xf0, 0x1c, 0x00, 0x0f, 0xff, 0xc0, 0xc0, 0x0f, 0x80, 0x7f, 0x03,
+        0xfe, 0x1f, 0xfc, 0xff, 0xbf, 0x7e, 0x79, 0xf8, 0xc7, 0xe0, 0x1f, 0x80,
+        0x7e, 0x01, 0xf8, 0x07, 0xe0, 0x1f, 0x80, 0x70, 0x00, 0x0f, 0xff, 0xc0,
+        0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0xff, 0xff,
+        0xff, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1c, 0x00,
+        0x0f, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xe0, 0xf7, 0xff,
+        0x1f, 0xf0, 0x00, 0x0f, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f,
+        0xc0, 0x7e, 0x03, 0xf0, 0x1c, 0x00, 0x0f, 0xff, 0xfe, 0xff, 0xe7, 0xff,
+        0xb8, 0x1f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x01, 0xf8, 0x0f, 0xc0, 0xff, 0xff, 0x7f, 0xf3, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0x00, 0x38, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc,
+        0x1f, 0xc0, 0x7e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00,
+        0x38, 0x0f, 0xe0, 0xf7, 0xff, 0x1f, 0xf0, 0x00, 0x0f, 0xff, 0xc0, 0xff,
+        0xff, 0xff, 0xc1, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0xe0,
+        0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x00, 0x0f,
+        0xff, 0xfe, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f,
+        0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xe0, 0x77, 0xff, 0x9f,
+        0xfc, 0x00, 0xe0, 0x07, 0x00, 0x7b, 0xff, 0x9f, 0xf8, 0x00, 0x7f, 0xff,
+        0xf8, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x7f, 0xc7, 0xff, 0x7b, 0xbf, 0x9c,
+        0xfc, 0xe7, 0xe7, 0x3f, 0x39, 0xf9, 0xcf, 0xce, 0x7e, 0x73, 0xf3, 0x9f,
+        0xdd, 0xef, 0xfe, 0x3f, 0xe0, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x00, 0x0f,
+        0xff, 0xc0, 0xe0, 0x3f, 0x01, 0xf8, 0x0e, 0xe0, 0xe3, 0x8e, 0x0e, 0xe0,
+        0x3e, 0x01, 0xf0, 0x1d, 0xc1, 0xc7, 0x1c, 0x1d, 0xc0, 0x7e, 0x03, 0xf0,
+        0x1c, 0x00, 0x0f, 0xff, 0xfe, 0xe0, 0x39, 0xc0, 0x73, 0x80, 0xe7, 0x01,
+        0xce, 0x03, 0x9c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0, 0x39, 0xc0, 0x73,
+        0x80, 0xe7, 0x81, 0xc7, 0xff, 0xc7, 0xff, 0xc0, 0x03, 0x80, 0x07, 0x00,
+        0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x0f, 0xff, 0xc0, 0xe0, 0x3f, 0x01,
+        0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x1d, 0xff, 0xe7, 0xff, 0x00, 0x38,
+        0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03, 0x80, 0x1c, 0x00, 0x0f, 0xff, 0xc0,
+        0xe7, 0x3f, 0x39, 0xf9, 0xcf, 0xce, 0x7e, 0x73, 0xf3, 0x9f, 0x9c, 0xfc,
+        0xe7, 0xe7, 0x3f, 0x39, 0xf9, 0xcf, 0xee, 0x77, 0xff, 0x9f, 0xfc, 0x00,
+        0x0f, 0xff, 0xfe, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73,
+        0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x9c, 0xe7,
+        0xb9, 0xc7, 0xff, 0xc7, 0xff, 0xc0, 0x03, 0x80, 0x07, 0x00, 0x0e, 0x00,
+        0x1c, 0x00, 0x38, 0x00, 0x0f, 0xff, 0xc0, 0xf8, 0x07, 0xc0, 0x0e, 0x00,
+        0x70, 0x03, 0xfe, 0x1f, 0xf8, 0xe1, 0xe7, 0x07, 0x38, 0x39, 0xc1, 0xce,
+        0x0e, 0x70, 0xf3, 0xff, 0x1f, 0xf0, 0x00, 0x0f, 0xff, 0xc0, 0xe0, 0x1f,
+        0x80, 0x7e, 0x01, 0xf8, 0x07, 0xfe, 0x1f, 0xfc, 0x7e, 0x79, 0xf8, 0xe7,
+        0xe3, 0x9f, 0x8e, 0x7e, 0x39, 0xf9, 0xe7, 0xff, 0x1f, 0xf8, 0x70, 0x00,
+        0x0f, 0xff, 0xc0, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0f, 0xf9, 0xff, 0xb8,
+        0x7f, 0x07, 0xe0, 0xfc, 0x1f, 0x83, 0xf0, 0xff, 0xfd, 0xff, 0x00, 0x00,
+        0x0f, 0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x70, 0x03, 0x80,
+        0x1c, 0x3f, 0xe1, 0xff, 0x00, 0x38, 0x01, 0xf8, 0x0f, 0xe0, 0xf7, 0xff,
+        0x1f, 0xf0, 0x00, 0x0f, 0xff, 0xc0, 0xe1, 0xf3, 0x8f, 0xee, 0x71, 0xf9,
+        0xc7, 0xe7, 0x1f, 0x9c, 0x7f, 0xf1, 0xff, 0xc7, 0xe7, 0x1f, 0x9c, 0x7e,
+        0x71, 0xf9, 0xc7, 0xe3, 0xfb, 0x87, 0xc0, 0x00, 0x0f, 0xff, 0xc0, 0x3f,
+        0xfb, 0xff, 0xfc, 0x0f, 0xc0, 0x7e, 0x03, 0xf8, 0x1d, 0xff, 0xe7, 0xff,
+        0x03, 0xb8, 0x39, 0xc3, 0x8e, 0x38, 0x73, 0x83, 0xb8, 0x1c, 0x03, 0xcf,
+        0xff, 0xc0, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x03, 0xfe, 0x3f, 0xfb,
+        0xc1, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x70,
+        0x03, 0x80, 0x1e, 0x07, 0x7f, 0xf9, 0xff, 0x80, 0x03, 0xcf, 0xff, 0xc0,
+        0x38, 0xe1, 0xc7, 0x0e, 0x38, 0x71, 0xc3, 0xfe, 0x3f, 0xfb, 0xc1, 0xfc,
+        0x07, 0xe0, 0x3f, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x70, 0x03, 0x80,
+        0x1e, 0x07, 0x7f, 0xf9, 0xff, 0x80, 0x03, 0xff, 0xff, 0xfe, 0x38, 0x00,
+        0x70, 0x03, 0xff, 0x07, 0xfe, 0x03, 0x80, 0x07, 0x00, 0x0f, 0xfe, 0x1f,
+        0xfe, 0x38, 0x1e, 0x70, 0x1c, 0xe0, 0x39, 0xc0, 0x73, 0x80, 0xe7, 0x01,
+        0xce, 0x03, 0x9c, 0x07, 0x38, 0x0e, 0x70, 0x1c, 0xe0, 0x39, 0xc0, 0x70,
+        0x00, 0xe0, 0x01, 0xc0, 0x07, 0x80, 0x7e, 0x00, 0xf8, 0x03, 0xcf, 0xff,
+        0xc0, 0x00, 0xe0, 0x0e, 0x00, 0xe0, 0x0e, 0x0f, 0xff, 0xff, 0xff, 0x80,
+        0x1c, 0x00, 0xe0, 0x07, 0x00, 0x38, 0x01, 0xc0, 0x0e, 0x00, 0x70, 0x03,
+        0x80, 0x1c, 0x00, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0x3f,
+        0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x7e, 0x00, 0x70, 0x03, 0xfe, 0x1f, 0xf0,
+        0xe0, 0x07, 0x00, 0x38, 0x0f, 0xe0, 0xf7, 0xff, 0x1f, 0xf0, 0x00, 0x0f,
+        0xff, 0xc0, 0x3f, 0xe3, 0xff, 0xbc, 0x1f, 0xc0, 0x0e, 0x00, 0x78, 0x01,
+        0xff, 0x87, 0xfe, 0x00, 0x78, 0x01, 0xc0, 0x0f, 0xe0, 0xf7, 0xff, 0x1f,
+        0xf0, 0x03, 0xcf, 0xff, 0xc0, 0x38, 0x70, 0xe1, 0xcf, 0x9f, 0x0e, 0x1c,
+        0x38, 0x70, 0xe1, 0xc3, 0x87, 0x0e, 0x1c, 0xff, 0xfc, 0x03, 0xcf, 0xff,
+        0xc0, 0xe3, 0xf1, 0xf8, 0xfc, 0x77, 0xc3, 0xe0, 0x70, 0x38, 0x1c, 0x0e,
+        0x07, 0x03, 0x81, 0xc0, 0xe0, 0x70, 0x38, 0x7f, 0x3f, 0x80, 0x03, 0xcf,
+        0xff, 0xfe, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x3e, 0x07, 0xc0, 0x38,
+        0x07, 0x00, 0xe0, 0x1c, 0x03, 0x80, 0x70, 0x0e, 0x01, 0xc0, 0x38, 0x07,
+        0x00, 0xe0, 0x1f, 0x83, 0xf0, 0x7f, 0x1e, 0xff, 0x8f, 0xe0, 0x00, 0x0f,
+        0xff, 0xc0, 0x1f, 0x80, 0x7f, 0x01, 0xee, 0x03, 0x9c, 0x07, 0x3f, 0x8e,
+        0x7f, 0x9c, 0xe7, 0xb9, 0xc7, 0x73, 0x8e, 0xe7, 0x1d, 0xce, 0x3b, 0x9c,
+        0xff, 0x3f, 0xdc, 0x7f, 0x00, 0x00, 0x0f, 0xff, 0xc0, 0xe3, 0x81, 0xc7,
+        0x03, 0x8e, 0x07, 0x1c, 0x0e, 0x3f, 0x9c, 0x7f, 0xbf, 0xe7, 0xff, 0xc7,
+        0xe3, 0x8f, 0xc7, 0x1f, 0x8e, 0x3f, 0x1c, 0xfe, 0x3f, 0xdc, 0x7f, 0x00,
+        0x03, 0xff, 0xff, 0xc0, 0x38, 0x00, 0x70, 0x03, 0xff, 0x07, 0xfe, 0x03,
+        0x80, 0x07, 0x00, 0x0f, 0xfe, 0x1f, 0xfe, 0x38, 0x1e, 0x70, 0x1c, 0xe0,
+        0x39, 0xc0, 0x73, 0x80, 0xe7, 0x01, 0xce, 0x03, 0x9c, 0x07, 0x38, 0x0e,
+        0x70, 0x1c, 0xe0, 0x39, 0xc0, 0x70, 0x03, 0xcf, 0xff, 0xc0, 0x01, 0xc0,
+        0x38, 0x07, 0x00, 0xe0, 0xe0, 0x7e, 0x0e, 0xe1, 0xce, 0x38, 0xe7, 0x0e,
+        0xe0, 0xfc, 0x0f, 0xc0, 0xee, 0x0e, 0x70, 0xe3, 0x8e, 0x1c, 0xe0, 0xee,
+        0x07, 0x03, 0xcf, 0xff, 0xc0, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x0e,
+        0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0,
+        0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9, 0xff, 0xc0, 0x03,
+        0xcf, 0xff, 0xfe, 0x38, 0xe1, 0xc7, 0x07, 0xf0, 0x1f, 0x0e, 0x03, 0xf0,
+        0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f, 0x01, 0xf8, 0x0f, 0xc0, 0x7e, 0x03,
+        0xf0, 0x1f, 0x80, 0xfe, 0x07, 0x7f, 0xf9, 0xff, 0xc0, 0x0e, 0x00, 0x70,
+        0x07, 0xbf, 0xf9, 0xff, 0x80, 0x00, 0x0f, 0xff, 0xfe, 0xe0, 0x3f, 0x01,
+        0xf8, 0x0f, 0xc0, 0x7e, 0x03, 0xf0, 0x1f, 0x80, 0xfc, 0x07, 0xe0, 0x3f,
+        0x01, 0xf8, 0x0f, 0xc0, 0x7f, 0xff, 0xff, 0xfc, 0x1c, 0x00, 0xe0, 0x07,
+        0x00, 0x38, 0x01, 0xc0
       },
       (GFXglyph[]){
-        {     0,  16,  32,  16,    0,  -25 },   // 0x400
-        {    64,  16,  32,  16,    0,  -25 },   // 0x401
-        {   128,  16,  32,  16,    0,  -25 },   // 0x402
-        {   192,  16,  32,  16,    0,  -25 },   // 0x403
-        {   256,  16,  32,  16,    0,  -25 },   // 0x404
-        {   320,  16,  32,  16,    0,  -25 },   // 0x405
-        {   384,  16,  32,  16,    0,  -25 },   // 0x406
-        {   448,  16,  32,  16,    0,  -25 },   // 0x407
-        {   512,  16,  32,  16,    0,  -25 },   // 0x408
-        {   576,  16,  32,  16,    0,  -25 },   // 0x409
-        {   640,  16,  32,  16,    0,  -25 },   // 0x40A
-        {   704,  16,  32,  16,    0,  -25 },   // 0x40B
-        {   768,  16,  32,  16,    0,  -25 },   // 0x40C
-        {   832,  16,  32,  16,    0,  -25 },   // 0x40D
-        {   896,  16,  32,  16,    0,  -25 },   // 0x40E
-        {   960,  16,  32,  16,    0,  -25 },   // 0x40F
-        {  1024,  16,  32,  16,    0,  -25 },   // 0x410
-        {  1088,  16,  32,  16,    0,  -25 },   // 0x411
-        {  1152,  16,  32,  16,    0,  -25 },   // 0x412
-        {  1216,  16,  32,  16,    0,  -25 },   // 0x413
-        {  1280,  16,  32,  16,    0,  -25 },   // 0x414
-        {  1344,  16,  32,  16,    0,  -25 },   // 0x415
-        {  1408,  16,  32,  16,    0,  -25 },   // 0x416
-        {  1472,  16,  32,  16,    0,  -25 },   // 0x417
-        {  1536,  16,  32,  16,    0,  -25 },   // 0x418
-        {  1600,  16,  32,  16,    0,  -25 },   // 0x419
-        {  1664,  16,  32,  16,    0,  -25 },   // 0x41A
-        {  1728,  16,  32,  16,    0,  -25 },   // 0x41B
-        {  1792,  16,  32,  16,    0,  -25 },   // 0x41C
-        {  1856,  16,  32,  16,    0,  -25 },   // 0x41D
-        {  1920,  16,  32,  16,    0,  -25 },   // 0x41E
-        {  1984,  16,  32,  16,    0,  -25 },   // 0x41F
-        {  2048,  16,  32,  16,    0,  -25 },   // 0x420
-        {  2112,  16,  32,  16,    0,  -25 },   // 0x421
-        {  2176,  16,  32,  16,    0,  -25 },   // 0x422
-        {  2240,  16,  32,  16,    0,  -25 },   // 0x423
-        {  2304,  16,  32,  16,    0,  -25 },   // 0x424
-        {  2368,  16,  32,  16,    0,  -25 },   // 0x425
-        {  2432,  16,  32,  16,    0,  -25 },   // 0x426
-        {  2496,  16,  32,  16,    0,  -25 },   // 0x427
-        {  2560,  16,  32,  16,    0,  -25 },   // 0x428
-        {  2624,  16,  32,  16,    0,  -25 },   // 0x429
-        {  2688,  16,  32,  16,    0,  -25 },   // 0x42A
-        {  2752,  16,  32,  16,    0,  -25 },   // 0x42B
-        {  2816,  16,  32,  16,    0,  -25 },   // 0x42C
-        {  2880,  16,  32,  16,    0,  -25 },   // 0x42D
-        {  2944,  16,  32,  16,    0,  -25 },   // 0x42E
-        {  3008,  16,  32,  16,    0,  -25 },   // 0x42F
-        {  3072,  16,  32,  16,    0,  -25 },   // 0x430
-        {  3136,  16,  32,  16,    0,  -25 },   // 0x431
-        {  3200,  16,  32,  16,    0,  -25 },   // 0x432
-        {  3264,  16,  32,  16,    0,  -25 },   // 0x433
-        {  3328,  16,  32,  16,    0,  -25 },   // 0x434
-        {  3392,  16,  32,  16,    0,  -25 },   // 0x435
-        {  3456,  16,  32,  16,    0,  -25 },   // 0x436
-        {  3520,  16,  32,  16,    0,  -25 },   // 0x437
-        {  3584,  16,  32,  16,    0,  -25 },   // 0x438
-        {  3648,  16,  32,  16,    0,  -25 },   // 0x439
-        {  3712,  16,  32,  16,    0,  -25 },   // 0x43A
-        {  3776,  16,  32,  16,    0,  -25 },   // 0x43B
-        {  3840,  16,  32,  16,    0,  -25 },   // 0x43C
-        {  3904,  16,  32,  16,    0,  -25 },   // 0x43D
-        {  3968,  16,  32,  16,    0,  -25 },   // 0x43E
-        {  4032,  16,  32,  16,    0,  -25 },   // 0x43F
-        {  4096,  16,  32,  16,    0,  -25 },   // 0x440
-        {  4160,  16,  32,  16,    0,  -25 },   // 0x441
-        {  4224,  16,  32,  16,    0,  -25 },   // 0x442
-        {  4288,  16,  32,  16,    0,  -25 },   // 0x443
-        {  4352,  16,  32,  16,    0,  -25 },   // 0x444
-        {  4416,  16,  32,  16,    0,  -25 },   // 0x445
-        {  4480,  16,  32,  16,    0,  -25 },   // 0x446
-        {  4544,  16,  32,  16,    0,  -25 },   // 0x447
-        {  4608,  16,  32,  16,    0,  -25 },   // 0x448
-        {  4672,  16,  32,  16,    0,  -25 },   // 0x449
-        {  4736,  16,  32,  16,    0,  -25 },   // 0x44A
-        {  4800,  16,  32,  16,    0,  -25 },   // 0x44B
-        {  4864,  16,  32,  16,    0,  -25 },   // 0x44C
-        {  4928,  16,  32,  16,    0,  -25 },   // 0x44D
-        {  4992,  16,  32,  16,    0,  -25 },   // 0x44E
-        {  5056,  16,  32,  16,    0,  -25 },   // 0x44F
-        {  5120,  16,  32,  16,    0,  -25 },   // 0x450
-        {  5184,  16,  32,  16,    0,  -25 },   // 0x451
-        {  5248,  16,  32,  16,    0,  -25 },   // 0x452
-        {  5312,  16,  32,  16,    0,  -25 },   // 0x453
-        {  5376,  16,  32,  16,    0,  -25 },   // 0x454
-        {  5440,  16,  32,  16,    0,  -25 },   // 0x455
-        {  5504,  16,  32,  16,    0,  -25 },   // 0x456
-        {  5568,  16,  32,  16,    0,  -25 },   // 0x457
-        {  5632,  16,  32,  16,    0,  -25 },   // 0x458
-        {  5696,  16,  32,  16,    0,  -25 },   // 0x459
-        {  5760,  16,  32,  16,    0,  -25 },   // 0x45A
-        {  5824,  16,  32,  16,    0,  -25 },   // 0x45B
-        {  5888,  16,  32,  16,    0,  -25 },   // 0x45C
-        {  5952,  16,  32,  16,    0,  -25 },   // 0x45D
-        {  6016,  16,  32,  16,    0,  -25 },   // 0x45E
-        {  6080,  16,  32,  16,    0,  -25 },   // 0x45F
+        {     0,  13,  32,  16,    1,  -25 },   // 0x400
+        {    43,  13,  32,  16,    1,  -25 },   // 0x401
+        {    86,  15,  32,  16,    0,  -25 },   // 0x402
+        {   128,  13,  32,  16,    1,  -25 },   // 0x403
+        {   171,  13,  32,  16,    1,  -25 },   // 0x404
+        {   208,  13,  32,  16,    1,  -25 },   // 0x405
+        {   245,   7,  32,  16,    4,  -25 },   // 0x406
+        {   267,   9,  32,  16,    3,  -25 },   // 0x407
+        {   298,  14,  32,  16,    1,  -25 },   // 0x408
+        {   337,  15,  32,  16,    0,  -25 },   // 0x409
+        {   379,  15,  32,  16,    0,  -25 },   // 0x40A
+        {   421,  15,  32,  16,    0,  -25 },   // 0x40B
+        {   463,  13,  32,  16,    1,  -25 },   // 0x40C
+        {   506,  13,  32,  16,    1,  -25 },   // 0x40D
+        {   549,  13,  32,  16,    1,  -25 },   // 0x40E
+        {   592,  13,  32,  16,    1,  -25 },   // 0x40F
+        {   637,  13,  32,  16,    1,  -25 },   // 0x410
+        {   674,  13,  32,  16,    1,  -25 },   // 0x411
+        {   711,  13,  32,  16,    1,  -25 },   // 0x412
+        {   748,  13,  32,  16,    1,  -25 },   // 0x413
+        {   785,  15,  32,  16,    0,  -25 },   // 0x414
+        {   834,  13,  32,  16,    1,  -25 },   // 0x415
+        {   871,  13,  32,  16,    1,  -25 },   // 0x416
+        {   908,  13,  32,  16,    1,  -25 },   // 0x417
+        {   945,  13,  32,  16,    1,  -25 },   // 0x418
+        {   982,  13,  32,  16,    1,  -25 },   // 0x419
+        {  1025,  13,  32,  16,    1,  -25 },   // 0x41A
+        {  1062,  13,  32,  16,    1,  -25 },   // 0x41B
+        {  1099,  14,  32,  16,    1,  -25 },   // 0x41C
+        {  1138,  13,  32,  16,    1,  -25 },   // 0x41D
+        {  1175,  13,  32,  16,    1,  -25 },   // 0x41E
+        {  1212,  13,  32,  16,    1,  -25 },   // 0x41F
+        {  1249,  13,  32,  16,    1,  -25 },   // 0x420
+        {  1286,  13,  32,  16,    1,  -25 },   // 0x421
+        {  1323,  13,  32,  16,    1,  -25 },   // 0x422
+        {  1360,  13,  32,  16,    1,  -25 },   // 0x423
+        {  1397,  13,  32,  16,    1,  -25 },   // 0x424
+        {  1440,  13,  32,  16,    1,  -25 },   // 0x425
+        {  1477,  15,  32,  16,    1,  -25 },   // 0x426
+        {  1528,  13,  32,  16,    1,  -25 },   // 0x427
+        {  1565,  13,  32,  16,    1,  -25 },   // 0x428
+        {  1602,  15,  32,  16,    1,  -25 },   // 0x429
+        {  1653,  14,  32,  16,    0,  -25 },   // 0x42A
+        {  1692,  14,  32,  16,    1,  -25 },   // 0x42B
+        {  1731,  12,  32,  16,    2,  -25 },   // 0x42C
+        {  1765,  13,  32,  16,    1,  -25 },   // 0x42D
+        {  1802,  14,  32,  16,    1,  -25 },   // 0x42E
+        {  1841,  13,  32,  16,    1,  -25 },   // 0x42F
+        {  1878,  13,  32,  16,    1,  -25 },   // 0x430
+        {  1905,  13,  32,  16,    1,  -25 },   // 0x431
+        {  1942,  13,  32,  16,    1,  -25 },   // 0x432
+        {  1979,  13,  32,  16,    1,  -25 },   // 0x433
+        {  2006,  13,  32,  16,    1,  -25 },   // 0x434
+        {  2041,  13,  32,  16,    1,  -25 },   // 0x435
+        {  2068,  13,  32,  16,    1,  -25 },   // 0x436
+        {  2095,  13,  32,  16,    1,  -25 },   // 0x437
+        {  2122,  13,  32,  16,    1,  -25 },   // 0x438
+        {  2149,  13,  32,  16,    1,  -25 },   // 0x439
+        {  2183,  12,  32,  16,    2,  -25 },   // 0x43A
+        {  2208,  13,  32,  16,    1,  -25 },   // 0x43B
+        {  2235,  14,  32,  16,    1,  -25 },   // 0x43C
+        {  2264,  13,  32,  16,    1,  -25 },   // 0x43D
+        {  2291,  13,  32,  16,    1,  -25 },   // 0x43E
+        {  2318,  13,  32,  16,    1,  -25 },   // 0x43F
+        {  2345,  13,  32,  16,    1,  -25 },   // 0x440
+        {  2380,  13,  32,  16,    1,  -25 },   // 0x441
+        {  2407,  13,  32,  16,    1,  -25 },   // 0x442
+        {  2434,  13,  32,  16,    1,  -25 },   // 0x443
+        {  2469,  13,  32,  16,    1,  -25 },   // 0x444
+        {  2506,  13,  32,  16,    1,  -25 },   // 0x445
+        {  2533,  15,  32,  16,    1,  -25 },   // 0x446
+        {  2573,  13,  32,  16,    1,  -25 },   // 0x447
+        {  2600,  13,  32,  16,    1,  -25 },   // 0x448
+        {  2627,  15,  32,  16,    1,  -25 },   // 0x449
+        {  2667,  13,  32,  16,    1,  -25 },   // 0x44A
+        {  2694,  14,  32,  16,    1,  -25 },   // 0x44B
+        {  2723,  11,  32,  16,    2,  -25 },   // 0x44C
+        {  2747,  13,  32,  16,    1,  -25 },   // 0x44D
+        {  2774,  14,  32,  16,    1,  -25 },   // 0x44E
+        {  2803,  13,  32,  16,    1,  -25 },   // 0x44F
+        {  2830,  13,  32,  16,    1,  -25 },   // 0x450
+        {  2864,  13,  32,  16,    1,  -25 },   // 0x451
+        {  2898,  15,  32,  16,    0,  -25 },   // 0x452
+        {  2949,  13,  32,  16,    1,  -25 },   // 0x453
+        {  2983,  13,  32,  16,    1,  -25 },   // 0x454
+        {  3010,  13,  32,  16,    1,  -25 },   // 0x455
+        {  3037,   7,  32,  16,    4,  -25 },   // 0x456
+        {  3057,   9,  32,  16,    3,  -25 },   // 0x457
+        {  3082,  11,  32,  16,    2,  -25 },   // 0x458
+        {  3118,  15,  32,  16,    0,  -25 },   // 0x459
+        {  3149,  15,  32,  16,    0,  -25 },   // 0x45A
+        {  3180,  15,  32,  16,    0,  -25 },   // 0x45B
+        {  3222,  12,  32,  16,    2,  -25 },   // 0x45C
+        {  3253,  13,  32,  16,    1,  -25 },   // 0x45D
+        {  3287,  13,  32,  16,    1,  -25 },   // 0x45E
+        {  3329,  13,  32,  16,    1,  -25 },   // 0x45F
       },  0x00, 0x5f, 0
 
-    }, 0x400, 0x400, 0x45f
+    }, 0x400, 0x400, 0x45f, true
   },
-  // Approx. 6823 bytes
+  // Approx. 4043 bytes
 
 };
+
+const uint8_t ter_x32b_pcf32pt_index[256] = {
+  0x00, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
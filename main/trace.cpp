@@ -0,0 +1,72 @@
+#include "trace.h"
+#include <esp_attr.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <string.h>
+#include <sys/time.h>
+
+static const char* TAG = "trace";
+
+// Kept in RTC memory, so it survives deep sleep
+struct TraceLog {
+  TraceRecord records[TRACE_RECORDS];   // ring
+  uint8_t head;                         // the next one to write
+  uint8_t count;
+  TraceTotal totals[TRACE_PHASES];
+};
+
+RTC_DATA_ATTR static TraceLog trace_log;
+// the timer task traces the vibration
+static portMUX_TYPE trace_lock = portMUX_INITIALIZER_UNLOCKED;
+
+const char* trace_names[TRACE_PHASES] = {
+  "wake", "rtc", "adc", "draw", "refresh", "epd off", "ble", "vibro",
+  "resume"};
+
+int64_t trace_start() {
+  return esp_timer_get_time();
+}
+
+void trace(TracePhase phase, int64_t start) {
+  int64_t duration = esp_timer_get_time() - start;
+  struct timeval now;
+  gettimeofday(&now, 0);
+  int64_t begin = (int64_t)now.tv_sec * 1000000 + now.tv_usec - duration;
+  portENTER_CRITICAL(&trace_lock);
+  TraceRecord &record = trace_log.records[trace_log.head];
+  record.seconds = begin / 1000000;
+  record.millis = begin % 1000000 / 1000;
+  record.duration = duration < UINT32_MAX ? duration : UINT32_MAX;
+  record.phase = phase;
+  trace_log.head = (trace_log.head + 1) % TRACE_RECORDS;
+  if (trace_log.count < TRACE_RECORDS)
+    ++trace_log.count;
+  trace_log.totals[phase].duration += duration;
+  ++trace_log.totals[phase].count;
+  portEXIT_CRITICAL(&trace_lock);
+  ESP_LOGD(TAG, "%s: %lld us", trace_names[phase], duration);
+}
+
+TraceTotal trace_total(TracePhase phase) {
+  portENTER_CRITICAL(&trace_lock);
+  TraceTotal result = trace_log.totals[phase];
+  portEXIT_CRITICAL(&trace_lock);
+  return result;
+}
+
+int trace_records(TraceRecord* out, int limit) {
+  portENTER_CRITICAL(&trace_lock);
+  int count = trace_log.count < limit ? trace_log.count : limit;
+  for (int i = 0; i < count; ++i)
+    out[i] = trace_log.records[(trace_log.head + TRACE_RECORDS - 1 - i) %
+                               TRACE_RECORDS];
+  portEXIT_CRITICAL(&trace_lock);
+  return count;
+}
+
+void trace_reset() {
+  portENTER_CRITICAL(&trace_lock);
+  memset(&trace_log, 0, sizeof(trace_log));
+  portEXIT_CRITICAL(&trace_lock);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <inttypes.h>
+
+// Phases of a wake cycle, see trace()
+enum TracePhase : uint8_t {
+  TRACE_WAKE,          // whole clock_tick() or event_tasks()
+  TRACE_RTC,           // getting the time, now and then an RTC read
+  TRACE_ADC,           // battery voltage
+  TRACE_DRAW,          // rendering a frame into the canvas
+  TRACE_REFRESH,       // panel update or updateWindow
+  TRACE_PANEL_SLEEP,   // display.deepSleep()
+  TRACE_BLE,           // handling a message from the phone
+  TRACE_VIBRATE,
+  TRACE_RESUME,        // from boot to the screen shown after a button wake
+  TRACE_PHASES
+};
+
+struct TraceTotal {
+  uint64_t duration;          // microseconds
+  uint32_t count;
+};
+
+const int TRACE_RECORDS = 32;
+
+// A single phase, the start is the time of the system clock
+struct TraceRecord {
+  uint32_t seconds;
+  uint32_t duration;          // microseconds
+  uint16_t millis;
+  uint8_t phase;
+};
+
+extern const char* trace_names[TRACE_PHASES];
+
+// microseconds since boot, start of a phase for trace()
+int64_t trace_start();
+
+// records a phase which has begun at start and ends now, the timer task
+// may call it too
+void trace(TracePhase phase, int64_t start);
+
+// what has been recorded for the phase since power-on
+TraceTotal trace_total(TracePhase phase);
+
+// copies up to limit of the last TRACE_RECORDS phases, newest first,
+// returns the number of records
+int trace_records(TraceRecord* out, int limit);
+
+// forget everything, on power-on
+void trace_reset();
@@ -4,11 +4,58 @@
 #include "utils.h"
 
 
-#define SET_FONT(t, f) t.SetFont(&f[0], sizeof(f)/ sizeof(f[0]))
+#define SET_FONT(t, f) t.SetFont(&f[0], sizeof(f)/ sizeof(f[0]), f##_index)
 
 struct UnicodeFont {
   GFXfont base_font;
   unsigned page, first, last;
+  bool compressed;   // bitmaps in the GlyphStream compressed format
+};
+
+// Index of the page containing c, -1 if there is none. The index made
+// by fontconvert points to the first page of the 256 codepoint block,
+// without one all the pages are searched.
+inline int find_font_page(const UnicodeFont *font, int page_count,
+                          const uint8_t *index, uint32_t c) {
+  int i = 0;
+  if (index) {
+    i = index[c > 0xffff ? 0xff : c >> 8];
+    if (i == 0xff)
+      return -1;
+  }
+  for (; i < page_count && font[i].first <= c; ++i)
+    if (c <= font[i].last)
+      return i;
+  return -1;
+}
+
+enum class Align { Left, Center, Right, Justify };
+
+const int GLYPH_RUN_LIMIT = 48;
+
+// One line of text laid out by Typography::Layout(), glyph positions
+// are relative to the start of the line. Kept on the stack.
+struct GlyphRun {
+  struct Item {
+    int16_t x;
+    uint8_t page;     // index in the UnicodeFont array
+    uint8_t code;     // in the page, as drawChar() expects it
+    uint8_t height;
+    bool space;
+  };
+  Item glyphs[GLYPH_RUN_LIMIT];
+  int count = 0;
+  int16_t advance = 0;   // cursor after the last glyph
+  uint16_t width = 0;
+  uint16_t height = 0;   // of the highest glyph
+  bool wrapped = false;  // broken to fit the width
+  bool full = false;     // out of items, the line continues in the next run
+};
+
+// Lines of a text which fit the box, see Typography::Paginate()
+struct TextPage {
+  uint16_t offset;    // in the text
+  uint8_t lines;
 };
 
 template<typename T>
@@ -16,6 +63,7 @@ class Typography {
  private:
   const UnicodeFont *font;
   int font_page_count;
+  const uint8_t *font_index = 0;
   T &target;
   const UnicodeFont* current_page = 0;
   int16_t x = 0;
@@ -23,26 +71,28 @@ class Typography {
   uint16_t fg = 0;
   uint16_t bg = 0xFF;
   float interval = 1.1;
+  unsigned lookup_misses = 0;
 
   bool updateFont(uint32_t c) {
     if (current_page && c >= current_page->first && c <= current_page->last)
       return true;
-    for (int i = 0; i < font_page_count; ++i)
-      if (c >= font[i].first && c <= font[i].last) {
-        current_page = &font[i];
-        target.setFont(&current_page->base_font);
-        return true;
-      }
-    return false;
+    ++lookup_misses;
+    int i = find_font_page(font, font_page_count, font_index, c);
+    if (i < 0)
+      return false;
+    current_page = &font[i];
+    return true;
   }
 
  public:
 
   Typography(T& tgt): target(tgt) {}
 
-  void SetFont(const UnicodeFont *subj, int page_count) {
+  void SetFont(const UnicodeFont *subj, int page_count,
+               const uint8_t *index = 0) {
     font = subj;
     font_page_count = page_count;
+    font_index = index;
     current_page = 0;
   }
 
@@ -60,6 +110,118 @@ class Typography {
     interval = subj;
   }
 
+  // symbols which weren't on the page of the previous one
+  unsigned LookupMisses() const {
+    return lookup_misses;
+  }
+
+  // Decodes and measures subj up to the end of the line. When fit is set
+  // the line is wrapped before max_width, after the last space or hyphen
+  // if there is one, otherwise at the glyph. Returns where the next run
+  // starts, spaces at the wrap are skipped, 0 at the end of the text.
+  const char* Layout(const char* subj, GlyphRun &run,
+                     bool fit, uint16_t max_width) {
+    if (!run.full) {
+      run.advance = 0;
+      run.width = 0;
+      run.height = 0;
+    }
+    run.count = 0;
+    run.wrapped = false;
+    run.full = false;
+    // last break opportunity: glyphs and width before it, next line
+    int break_count = 0;
+    int16_t break_width = 0;
+    const char* break_next = 0;
+    const char* c = subj;
+    for (; *c; c = next_ut8_symbol(c)) {
+      uint32_t sym = decode_utf8(c);
+      if (sym == 0xd) {
+        run.advance = 0;
+        continue;
+      }
+      if (sym == 0xa)
+        return next_ut8_symbol(c);
+      if (run.count == GLYPH_RUN_LIMIT) {
+        run.full = true;
+        return c;
+      }
+      if (!updateFont(sym)) {
+        sym = '?';
+        if (!updateFont(sym))
+          continue;
+      }
+      int idx = sym - current_page->page - current_page->base_font.first;
+      GFXglyph *glyph = &current_page->base_font.glyph[idx];
+      if (fit && run.count && run.advance + glyph->xAdvance > max_width) {
+        run.wrapped = true;
+        if (sym != ' ' && break_next) {
+          run.count = break_count;
+          run.advance = break_width;
+          run.width = break_width;
+          run.height = 0;
+          for (int i = 0; i < run.count; ++i)
+            if (run.glyphs[i].height > run.height)
+              run.height = run.glyphs[i].height;
+          c = break_next;
+        }
+        while (*c == ' ')
+          ++c;
+        return *c ? c : 0;
+      }
+      run.glyphs[run.count++] = {
+        run.advance, (uint8_t)(current_page - font),
+        (uint8_t)(sym - current_page->page), glyph->height, sym == ' '};
+      if (sym == ' ' || sym == '-') {
+        break_count = sym == ' ' ? run.count - 1 : run.count;
+        break_width = sym == ' ' ? run.advance : run.advance + glyph->xAdvance;
+        break_next = next_ut8_symbol(c);
+      }
+      run.advance += glyph->xAdvance;
+      if (glyph->height > run.height)
+        run.height = glyph->height;
+      if (run.advance > run.width)
+        run.width = run.advance;
+    }
+    return 0;
+  }
+
+  // Draws a run laid out by Layout() within box_width from x_start.
+  // Justify stretches the spaces of wrapped lines only.
+  void Draw(const GlyphRun &run, int16_t x_start, int16_t y_start,
+            Align align, uint16_t box_width) {
+    int16_t offset = 0;
+    int extra = 0;
+    int spaces = 0;
+    if (align == Align::Center)
+      offset = (box_width - run.width) / 2;
+    else if (align == Align::Right)
+      offset = box_width - run.width;
+    else if (align == Align::Justify && run.wrapped) {
+      int last = run.count - 1;
+      while (last >= 0 && run.glyphs[last].space)
+        --last;
+      for (int i = 0; i < last; ++i)
+        spaces += run.glyphs[i].space;
+      extra = box_width - run.width;
+    }
+    int seen = 0;
+    int page = -1;
+    for (int i = 0; i < run.count; ++i) {
+      const GlyphRun::Item &item = run.glyphs[i];
+      if (item.page != page) {
+        page = item.page;
+        target.setFont(&font[page].base_font, font[page].compressed);
+      }
+      int16_t shift = spaces && extra > 0 ? extra * seen / spaces : 0;
+      target.drawChar(x_start + offset + item.x + shift, y_start + item.height,
+                      item.code, fg, bg, 1);
+      seen += item.space;
+    }
+  }
+
+  // Every line is laid out once and drawn right away. The extents of
+  // the text are returned relative to the origin like the cursor.
   void Print(const char* subj,
              uint16_t &actual_width,
              uint16_t &actual_height,
@@ -68,47 +230,33 @@ class Typography {
              int16_t x_start,
              int16_t y_start,
              uint16_t max_width,
-             uint16_t max_height) {
+             uint16_t max_height,
+             Align align = Align::Left) {
     actual_height = 0;
     actual_width = 0;
     x = x_start;
     y = y_start;
-    int line_height = 0;
-    for (const char* c = subj; *c; c = next_ut8_symbol(c)) {
-      uint32_t sym = decode_utf8(c);
-      if (sym == 0xd) {
-        x = x_start;
-        continue;
+    GlyphRun run;
+    const char* next = subj;
+    while (next) {
+      next = Layout(next, run, fit, max_width);
+      if (fit && run.count && y > (y_start + max_height))
+        return;
+      if (!dry_run)
+        Draw(run, x_start, y, align, max_width);
+      if (run.count) {
+        if (x_start + run.width > actual_width)
+          actual_width = x_start + run.width;
+        if ((y + run.height) > actual_height)
+          actual_height = y + run.height;
       }
-      if (sym == 0xa) {
-        x = x_start;
-        y += line_height * interval + font[0].base_font.yAdvance;
-        line_height = 0;
+      if (run.full)
         continue;
-      }
-      if (!updateFont(sym)) {
-        sym = '?';
-        updateFont(sym);
-      }
-      int idx = sym - current_page->page - current_page->base_font.first;
-      GFXglyph *glyph = &current_page->base_font.glyph[idx];
-      if (fit && (x + glyph->xAdvance) > (x_start + max_width)) {
+      if (next) {
         x = x_start;
-        y += line_height * interval + font[0].base_font.yAdvance;
-        line_height = 0;
-      }
-      if (fit && y > (y_start + max_height))
-        return;
-      if (!dry_run)
-        target.drawChar(x, y + glyph->height,
-                        sym - current_page->page, fg, bg, 1);
-      x += glyph->xAdvance;
-      if (glyph->height > line_height)
-        line_height = glyph->height;
-      if (x > actual_width)
-        actual_width = x;
-      if ((y + line_height) > actual_height)
-        actual_height = y + line_height;
+        y += run.height * interval + font[0].base_font.yAdvance;
+      } else
+        x = x_start + run.advance;
     }
   }
 
@@ -121,10 +269,54 @@ class Typography {
                int16_t x_start,
                int16_t y_start,
                uint16_t max_width,
-               uint16_t max_height) {
+               uint16_t max_height,
+               Align align = Align::Left) {
     uint16_t dummy = 0;
     Print(subj, dummy, dummy, false, true,
-          x_start, y_start, max_width, max_height);
+          x_start, y_start, max_width, max_height, align);
+  }
+
+  // Splits subj into pages of lines wrapped at max_width, a page ends
+  // before the line whose bottom would pass max_height. One pass over
+  // the text, at most limit pages. Returns the number of pages.
+  int Paginate(const char* subj, uint16_t max_width, uint16_t max_height,
+               TextPage* pages, int limit) {
+    int count = 0;
+    int16_t line_y = 0;
+    GlyphRun run;
+    const char* next = subj;
+    while (next) {
+      const char* start = next;
+      do
+        next = Layout(next, run, true, max_width);
+      while (run.full && next);
+      if (!count || (line_y && line_y + run.height > max_height)) {
+        if (count == limit)
+          break;
+        pages[count++] = {(uint16_t)(start - subj), 0};
+        line_y = 0;
+      }
+      ++pages[count - 1].lines;
+      line_y += run.height * interval + font[0].base_font.yAdvance;
+    }
+    return count;
+  }
+
+  // Draws count lines of subj wrapped at max_width, like a page found by
+  // Paginate()
+  void PrintLines(const char* subj, int count,
+                  int16_t x_start, int16_t y_start, uint16_t max_width,
+                  Align align = Align::Left) {
+    int16_t line_y = y_start;
+    GlyphRun run;
+    const char* next = subj;
+    for (int i = 0; i < count && next; ++i) {
+      do {
+        next = Layout(next, run, true, max_width);
+        Draw(run, x_start, line_y, align, max_width);
+      } while (run.full && next);
+      line_y += run.height * interval + font[0].base_font.yAdvance;
+    }
   }
 
   void TextDimensions(const char* subj, uint16_t &width, uint16_t &height) {
@@ -135,13 +327,19 @@ class Typography {
     y = backup_y;
   }
 
-  uint16_t PrintCentered(const char* subj, int16_t y) {
+  // lines are aligned within the target width, returns the text height
+  uint16_t PrintAligned(const char* subj, int16_t y, Align align) {
     uint16_t width;
     uint16_t height;
-    TextDimensions(subj, width, height);
-    x = (target.width() - width) / 2;
-    SetCursor(x, y);
-    Print(subj);
-    return height;
+    Print(subj, width, height, false, false, 0, y, target.width(), 0, align);
+    return height > y ? height - y : 0;
+  }
+
+  uint16_t PrintCentered(const char* subj, int16_t y) {
+    return PrintAligned(subj, y, Align::Center);
+  }
+
+  uint16_t PrintRight(const char* subj, int16_t y) {
+    return PrintAligned(subj, y, Align::Right);
   }
 };
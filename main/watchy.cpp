@@ -12,12 +12,21 @@
 #include <gdeh0154d67.h>
 #include <nvs_flash.h>
 #include <time.h>
+#include <sys/time.h>
+#include <ctype.h>
+#include <string.h>
 
 #include "main_queue.h"
 #include "ble.h"
 #include "misc_hw.h"
 #include "utils.h"
+#include "notifications.h"
+#include "canvas.h"
+#include "clock_face.h"
 #include "typography.h"
+#include "trace.h"
+#include "telemetry.h"
+#include "ter_x20b_pcf20pt.h"
 #include "ter_x28b_pcf28pt.h"
 #include "ter_x32b_pcf32pt.h"
 #include "c509_bold37pt.h"
@@ -28,26 +37,57 @@ static const char* TAG = "main";
 #define MAIN_SCREEN 0
 #define NOTIFICATION_SCREEN 1
 #define INFO_SCREEN 2
-const int minute = 60 * 1000;
+#define TRACE_SCREEN 3
+#define TRACE_LOG_SCREEN 4
+// milliseconds to wait for the next notification of a burst before the
+// refresh, and the longest a burst may delay it
+const int refresh_window = 300;
+const int refresh_window_limit = 2000;
+// seconds the screens shown by a button last in deep sleep, then the
+// clock is back
+const int screen_timeout = 60;
+
+// How the watch waits for the next wake cycle. In deep sleep BLE is off,
+// the RTC timer wakes the watch at every minute change to redraw the
+// clock and it goes straight back to sleep.
+enum SleepPolicy {
+  SLEEP_LIGHT,        // light sleep only, the phone stays connected
+  SLEEP_AT_NIGHT,     // deep sleep during sleeping_hours()
+  SLEEP_DEEP,         // always deep sleep, a clock without BLE
+};
+const SleepPolicy sleep_policy = SLEEP_AT_NIGHT;
 
 EpdSpi io;
 Gdeh0154d67 display(io);
-Typography typography(display);
-NotificationBuffer notifications;
-Battery battery;
+// 5000 bytes don't fit next to the rest of RTC slow memory, RTC fast
+// memory is only accessible to the PRO CPU, where the main task runs
+RTC_FAST_ATTR CanvasShadow panel_shadow;
+Canvas canvas(display, panel_shadow);
+Typography typography(canvas);
+ClockFace clock_face(canvas);
+NotificationBuffer notifications(notification_store);
+RTC_DATA_ATTR BatteryHistory battery_history;
+Battery battery(battery_history);
 int time_sync_day;
 RTC_DATA_ATTR time_t boot_time = 0;
 RTC_DATA_ATTR uint8_t prev_day = 0;
 RTC_DATA_ATTR uint8_t prev_hour = 0;
 RTC_DATA_ATTR uint8_t prev_minute = 0;
-int screen;
+RTC_DATA_ATTR TraceTotal logged_wakes;
+RTC_DATA_ATTR int screen;
+RTC_DATA_ATTR time_t screen_time;     // of the last button press
 bool screen_changed;
-const char* displayed_notification;
+uint32_t displayed_notification;
+RTC_DATA_ATTR uint8_t notification_page;
+uint8_t displayed_page;
 bool connected;
 bool prev_connected;
 unsigned disconnect_count;
 bool ringing;
+enum Alert { ALERT_NONE, ALERT_MESSAGE, ALERT_CALL };
+Alert pending_alert;    // the strongest one of a burst
 bool sleeping;
+bool resuming;     // woken from deep sleep by a button
 const char *wdays[] = {"Вс", "Пн", "Вт", "Ср", "Чт", "Пт", "Сб"};
 const char *months[] = {"Янв", "Фев", "Мар", "Апр", "Мая", "Июня",
                         "Июля", "Авг", "Сен", "Окт", "Ноя", "Дек"};
@@ -56,25 +96,31 @@ const char *months[] = {"Янв", "Фев", "Мар", "Апр", "Мая", "Ию
 void sync_current_time(tm* subj) {
   if (subj->tm_mday != time_sync_day) {
     time_sync_day = subj->tm_mday;
-    set_rtc_time(subj);
+    set_time(subj);
   }
 }
 
-void draw_main_screen(tm* time, bool valid) {
-  display.fillScreen(EPD_WHITE);
-  char hour_min[] = "--:--";
-  if (valid)
-    sprintf(hour_min, "%02d:%02d", time->tm_hour, time->tm_min);
-  SET_FONT(typography, C059_Bold37pt);
+bool draw_main_screen(tm* time, bool valid) {
+  canvas.fillScreen(EPD_WHITE);
   uint16_t y = 40;
-  uint16_t hm_y = y;
-  uint16_t hm_h = typography.PrintCentered(hour_min, y);
-  y += hm_h;
+  uint16_t height = 0;
+  if (valid) {
+    SET_FONT(clock_face, C059_Bold37pt);
+    height = clock_face.PrintCentered(time->tm_hour, time->tm_min, y);
+  }
+  if (!height) {
+    char hour_min[] = "--:--";
+    if (valid)
+      sprintf(hour_min, "%02d:%02d", time->tm_hour, time->tm_min);
+    SET_FONT(typography, C059_Bold37pt);
+    height = typography.PrintCentered(hour_min, y);
+  }
+  y += height;
 
-  display.drawRect(10, 104, 180, 5, EPD_BLACK);
-  display.fillRect(10, 105, 180 * battery.get_level() / 100, 4, EPD_BLACK);
+  canvas.drawRect(10, 104, 180, 5, EPD_BLACK);
+  canvas.fillRect(10, 105, 180 * battery.get_level() / 100, 4, EPD_BLACK);
   
-  char day_month[11] = "---";
+  char day_month[32] = "---";
   if (valid)
     sprintf(day_month, "%s %d %s",
             wdays[time->tm_wday], time->tm_mday, months[time->tm_mon]);
@@ -88,109 +134,168 @@ void draw_main_screen(tm* time, bool valid) {
   else if (!connected)
     typography.PrintCentered("разрыв", y);
 
-  if (valid && prev_day != time->tm_mday)
-    display.update();
-  else {
-    // only last digit by defalt
-    // TODO update only last digit
-    uint32_t upd_x = GDEH0154D67_WIDTH / 2;
-    uint32_t upd_w = GDEH0154D67_WIDTH / 2;
-    uint32_t upd_y = hm_y;
-    // add 15 pixel, for some reason lower part doesn't update
-    uint32_t upd_h = hm_h + 15;
-    if (!valid ||
-        prev_hour != time->tm_hour ||
-        screen_changed ||
-        prev_connected != connected) {
-      // the whole screen each hour
-      upd_x = 0;
-      upd_y = 0;
-      upd_w = GDEH0154D67_WIDTH;
-      upd_h = GDEH0154D67_HEIGHT;
-    } else if (prev_minute / 10 != time->tm_min / 10) {
-      // last two digits every 10 minutes
-      upd_x = GDEH0154D67_WIDTH / 2;
-      upd_w = GDEH0154D67_WIDTH / 2;
-    }
-    ESP_LOGD(TAG, "upd_x: %lu, upd_y: %lu, upd_w: %lu, upd_h: %lu",
-             upd_x, upd_y, upd_w, upd_h);
-    display.updateWindow(upd_x, upd_y, upd_w, upd_h, false);
-  }
+  // full refresh once a day, partial otherwise
+  return canvas.Update(valid && prev_day != time->tm_mday);
 }
 
 // find from 4 up to 6 consequtive digits
 // treat them like 2FA code
-std::string find_code(const char* subj) {
-  std::string result;
-  for (const char* p = subj; *p; ++p) {
-    if (isdigit(*p))
-      result += *p;
-    else {
-      if (result.size() <= 6 && result.size() >= 4)
-        return result;
-      result.clear();
+const char* find_code(const char* subj, uint8_t &length) {
+  const char* start = subj;
+  for (const char* p = subj; ; ++p) {
+    if (*p >= '0' && *p <= '9')
+      continue;
+    if (p - start >= 4 && p - start <= 6) {
+      length = p - start;
+      return start;
     }
+    if (!*p)
+      break;
+    start = p + 1;
   }
-  if (result.size() < 4 || result.size() > 6)
-    result.clear();
-  return result;
+  length = 0;
+  return 0;
 }
 
-void draw_notifications() {
-  display.fillScreen(EPD_WHITE);
-  const char* notification = notifications.get_current();
-  auto code = find_code(notification);
+void layout_notification(Notification* subj) {
+  NotificationLayout &layout = subj->layout;
+  const char* text = subj->text();
+  const char* code = find_code(text, layout.code_length);
+  layout.code_offset = code ? code - text : 0;
   uint16_t y = 5;
-  if (!code.empty()) {
+  if (code) {
+    char buf[8] = {};
+    memcpy(buf, code, layout.code_length);
+    uint16_t width;
+    uint16_t height;
     SET_FONT(typography, C059_Bold29pt);
-    y += typography.PrintCentered(code.c_str(), y);
-    y += 10;
+    typography.TextDimensions(buf, width, height);
+    y += height + 10;
   }
+  layout.text_top = y;
   SET_FONT(typography, ter_x28b_pcf28pt);
-  typography.FitText(notification, 5, y, 190, GDEH0154D67_HEIGHT - y - 5);
-  display.updateWindow(0, 0, GDEH0154D67_WIDTH, GDEH0154D67_HEIGHT, false);
+  layout.page_count = typography.Paginate(
+    text, 190, GDEH0154D67_HEIGHT - y - 5, layout.pages, NOTIFICATION_PAGES);
 }
 
-void preprocess_notification(Notification* subj) {
-  for (int i = 0; i < strlen(subj->text); ++i) {
-    char ch = subj->text[i];
-    if (ch == '\n' || ch == '\r' || ch == '\t') {
-      subj->text[i] = ' ';
-    }
+// only the lines of the page found by layout_notification() are laid
+// out again, a bar on the right shows the position in a longer text
+bool draw_notifications() {
+  canvas.fillScreen(EPD_WHITE);
+  notifications.lock();
+  Notification* notification = notifications.get_current();
+  if (!notification) {
+    notifications.unlock();
+    return canvas.Update(false);
+  }
+  const NotificationLayout &layout = notification->layout;
+  const char* text = notification->text();
+  if (layout.code_length) {
+    char buf[8] = {};
+    memcpy(buf, text + layout.code_offset, layout.code_length);
+    SET_FONT(typography, C059_Bold29pt);
+    typography.PrintCentered(buf, 5);
   }
+  int page = notification_page < layout.page_count ?
+    notification_page : layout.page_count - 1;
+  SET_FONT(typography, ter_x28b_pcf28pt);
+  typography.PrintLines(text + layout.pages[page].offset,
+                        layout.pages[page].lines, 5, layout.text_top, 190);
+  if (layout.page_count > 1) {
+    int bar = (GDEH0154D67_HEIGHT - layout.text_top - 5) / layout.page_count;
+    canvas.fillRect(196, layout.text_top + bar * page, 3, bar, EPD_BLACK);
+  }
+  notifications.unlock();
+  return canvas.Update(false);
+}
+
+void preprocess_notification(Notification* subj) {
+  for (char* p = subj->text(); *p; ++p)
+    if (*p == '\n' || *p == '\r' || *p == '\t')
+      *p = ' ';
 }
 
 bool notification_is_empty(Notification* subj) {
-  for (const char* p = subj->text; *p; ++p)
+  for (const char* p = subj->text(); *p; ++p)
     if (!isspace(*p))
       return false;
   return true;
 }
 
-bool handle_notification(Notification* subj) {
+// false when the record is not to be displayed, the caller drops it
+bool show_notification(Notification* subj) {
   ESP_LOGI(TAG, "New notification, icon: %u, state: %u, %s",
-           subj->icon, subj->state, subj->text);
+           subj->icon, subj->state, subj->text());
   if (subj->icon == 1) {
     ringing = true;
-    notifications.add(subj->text);
-    // TODO find better solution
-    vibrate(100, 10);
+    layout_notification(subj);
+    notifications.show(subj->id);
     return true;
   } else if (subj->icon == 2) {
     ringing = false;
+    stop_vibration();
     return false; // its empty no need to display
   }
   preprocess_notification(subj);
   if (!notification_is_empty(subj)) {
-    notifications.add(subj->text);
-    vibrate(75, 6);
+    layout_notification(subj);
+    notifications.show(subj->id);
     return true;
   }
   return false;
 }
 
-void draw_info() {
-  display.fillScreen(EPD_WHITE);
+// next or previous page, past the ends of a notification to the next
+// or the previous one
+void scroll_notifications(int direction) {
+  notifications.lock();
+  Notification* notification = notifications.get_current();
+  if (notification) {
+    int pages = notification->layout.page_count;
+    if (direction > 0 && notification_page + 1 < pages)
+      ++notification_page;
+    else if (direction < 0 && notification_page > 0)
+      --notification_page;
+    else if (direction > 0) {
+      notifications.next();
+      notification_page = 0;
+    } else {
+      notifications.prev();
+      notification_page = notifications.get_current()->layout.page_count - 1;
+    }
+  }
+  notifications.unlock();
+}
+
+bool handle_notification(uint32_t id) {
+  notifications.lock();
+  Notification* subj = notifications.find(id);
+  bool call = subj && subj->icon == 1;
+  bool shown = subj && show_notification(subj);
+  // call-ended markers and blank texts are never browsed
+  if (subj && !shown)
+    notifications.discard(id);
+  notifications.seal();
+  notifications.unlock();
+  if (call)
+    pending_alert = ALERT_CALL;
+  else if (shown && pending_alert == ALERT_NONE)
+    pending_alert = ALERT_MESSAGE;
+  return shown;
+}
+
+// once per burst of notifications, a call hung up within the burst
+// doesn't ring
+void alert() {
+  if (pending_alert == ALERT_CALL && ringing)
+    vibrate(VIBRATE_CALL);
+  else if (pending_alert == ALERT_MESSAGE)
+    vibrate(VIBRATE_MESSAGE);
+  pending_alert = ALERT_NONE;
+}
+
+bool draw_info() {
+  canvas.fillScreen(EPD_WHITE);
   char buf[22];
   SET_FONT(typography, ter_x28b_pcf28pt);
   typography.SetCursor(5,5);
@@ -206,48 +311,135 @@ void draw_info() {
   typography.Print(buf);
   snprintf(buf, 22, " %u разрывов\n", disconnect_count);
   typography.Print(buf);
-  display.updateWindow(0, 0, GDEH0154D67_WIDTH, GDEH0154D67_HEIGHT, false);
+  return canvas.Update(false);
+}
+
+// average time of every phase of the wake cycles since power-on
+bool draw_trace() {
+  canvas.fillScreen(EPD_WHITE);
+  char buf[16];
+  uint16_t width, height;
+  SET_FONT(typography, ter_x20b_pcf20pt);
+  // a header and TRACE_PHASES rows have to fit
+  const int16_t pitch = 19;
+  int16_t y = 0;
+  typography.Print("count", width, height, false, false, 65, y, 60, 0,
+                   Align::Right);
+  typography.Print("avg ms", width, height, false, false, 125, y, 70, 0,
+                   Align::Right);
+  for (int i = 0; i < TRACE_PHASES; ++i) {
+    y += pitch;
+    TraceTotal total = trace_total((TracePhase)i);
+    double average = total.count ? total.duration / 1000.0 / total.count : 0;
+    typography.Print(trace_names[i], width, height, false, false, 5, y, 0, 0);
+    snprintf(buf, sizeof(buf), "%lu", (unsigned long)total.count);
+    typography.Print(buf, width, height, false, false, 65, y, 60, 0,
+                     Align::Right);
+    snprintf(buf, sizeof(buf), "%.1f", average);
+    typography.Print(buf, width, height, false, false, 125, y, 70, 0,
+                     Align::Right);
+  }
+  return canvas.Update(false);
+}
+
+// the last phases, newest first
+bool draw_trace_log() {
+  canvas.fillScreen(EPD_WHITE);
+  TraceRecord records[9];
+  int count = trace_records(records, 9);
+  char buf[16];
+  uint16_t width, height;
+  SET_FONT(typography, ter_x20b_pcf20pt);
+  const int16_t pitch = 19;
+  int16_t y = 0;
+  typography.Print("m:s", width, height, false, false, 5, y, 0, 0);
+  typography.Print("ms", width, height, false, false, 125, y, 70, 0,
+                   Align::Right);
+  for (int i = 0; i < count; ++i) {
+    y += pitch;
+    time_t start = records[i].seconds;
+    struct tm* t = localtime(&start);
+    snprintf(buf, sizeof(buf), "%02d:%02d", t->tm_min, t->tm_sec);
+    typography.Print(buf, width, height, false, false, 5, y, 0, 0);
+    typography.Print(trace_names[records[i].phase], width, height,
+                     false, false, 60, y, 0, 0);
+    snprintf(buf, sizeof(buf), "%.1f", records[i].duration / 1000.0);
+    typography.Print(buf, width, height, false, false, 125, y, 70, 0,
+                     Align::Right);
+  }
+  return canvas.Update(false);
+}
+
+void sleep_panel() {
+  int64_t start = trace_start();
+  display.deepSleep();
+  trace(TRACE_PANEL_SLEEP, start);
 }
 
 bool sleeping_hours(struct tm& now) {
   return now.tm_hour < 8 || now.tm_hour >= 21;
 }
 
-void deep_sleep() {
-  battery.flush();
+bool deep_sleep_due(struct tm& now) {
+  switch (sleep_policy) {
+  case SLEEP_LIGHT:
+    return false;
+  case SLEEP_AT_NIGHT:
+    return sleeping_hours(now);
+  default:
+    return true;
+  }
+}
+
+// average wake cycle since the previous call
+void log_wake_time() {
+  TraceTotal total = trace_total(TRACE_WAKE);
+  if (total.count > logged_wakes.count)
+    telemetry_append(TELEMETRY_WAKE,
+                     (total.duration - logged_wakes.duration) /
+                     (total.count - logged_wakes.count));
+  logged_wakes = total;
+}
+
+// now is 0 when the RTC time isn't valid
+void deep_sleep(struct tm* now) {
+  // the motor would stay in whatever state it is
+  while (vibrating())
+    vTaskDelay(pdMS_TO_TICKS(100));
+  if (now) {
+    // the wake and the vibration have taken part of the minute, now is
+    // from its start
+    time_t next = mktime(now) - now->tm_sec + 60;
+    time_t left = next - time(0);
+    enable_rtc_wakeup(left < 1 ? 1 : left > 60 ? 60 : left);
+  }
+  // in case the RTC interrupt never comes
   esp_sleep_enable_timer_wakeup(600000000); // 10 mins
-  // esp_sleep_enable_ext1_wakeup(
-  //     BTN_PIN_MASK,
-  //     ESP_EXT1_WAKEUP_ANY_HIGH); // enable deep sleep wake on button press
+  enable_button_wakeup();
+  // keeps panel_shadow
+  esp_sleep_pd_config(ESP_PD_DOMAIN_RTC_FAST_MEM, ESP_PD_OPTION_ON);
   ESP_LOGI(TAG, "Deeply sleeping");
   esp_deep_sleep_start();
 }
 
-void idle_tasks() {
-  struct tm now;
-  bool valid = get_rtc_time(&now);
-  if (valid) {
-    battery.measure(&now);
-    sleeping = sleeping_hours(now);
-    if (now.tm_hour != prev_hour)
-      send_battery(battery.get_level());
-    if (!boot_time) {
-      ESP_LOGI(TAG, "RTC time: %u-%u-%u %u:%u:%u (%d)",
-               now.tm_year, now.tm_mon, now.tm_mday,
-               now.tm_hour, now.tm_min, now.tm_sec, valid);
-      boot_time = mktime(&now);
-    }
-  }
-  else
-    battery.measure(0);
+bool read_time(struct tm& now) {
+  int64_t start = trace_start();
+  bool valid = get_time(&now);
+  trace(TRACE_RTC, start);
+  return valid;
+}
 
+// redraws the current screen if anything on it has changed
+void update_screen(struct tm& now, bool valid) {
   if (screen == NOTIFICATION_SCREEN) {
-    if (screen_changed ||
-        (notifications.get_current() &&
-         notifications.get_current() != displayed_notification))
-    draw_notifications();
-    display.deepSleep();
-    displayed_notification = notifications.get_current();
+    if ((screen_changed ||
+         (notifications.get_current_id() &&
+          (notifications.get_current_id() != displayed_notification ||
+           notification_page != displayed_page))) &&
+        draw_notifications())
+      sleep_panel();
+    displayed_notification = notifications.get_current_id();
+    displayed_page = notification_page;
   }
   else if (screen == MAIN_SCREEN) {
     if (!valid ||
@@ -255,29 +447,164 @@ void idle_tasks() {
         prev_connected != connected ||
         screen_changed) {
       ESP_LOGI(TAG, "Updating main screen");
-      draw_main_screen(&now, valid);
-      display.deepSleep();
+      if (draw_main_screen(&now, valid))
+        sleep_panel();
+      prev_connected = connected;
     }
   }
   else if (screen == INFO_SCREEN && screen_changed) {
-    draw_info();
-    display.deepSleep();
+    if (draw_info())
+      sleep_panel();
+  }
+  else if (screen == TRACE_SCREEN && screen_changed) {
+    if (draw_trace())
+      sleep_panel();
+  }
+  else if (screen == TRACE_LOG_SCREEN && screen_changed) {
+    if (draw_trace_log())
+      sleep_panel();
   }
 
   if (valid) {
     prev_day = now.tm_mday;
-    prev_hour = now.tm_hour;
     prev_minute = now.tm_min;
   }
   screen_changed = false;
+}
 
-  if (ringing) {
-    // TODO find better solution
-    vibrate(100, 20);
-    ringing = false;
+// the work of a minute change
+void clock_tick() {
+  int64_t wake_start = trace_start();
+  struct tm now;
+  bool valid = read_time(now);
+  if (valid) {
+    battery.measure(true);
+    sleeping = deep_sleep_due(now);
+    if (now.tm_hour != prev_hour) {
+      send_battery(battery.get_level());
+      log_wake_time();
+    }
+    if (!boot_time) {
+      ESP_LOGI(TAG, "RTC time: %u-%u-%u %u:%u:%u (%d)",
+               now.tm_year, now.tm_mon, now.tm_mday,
+               now.tm_hour, now.tm_min, now.tm_sec, valid);
+      boot_time = mktime(&now);
+    }
+    prev_hour = now.tm_hour;
+  }
+  else
+    battery.measure(false);
+
+  if (sleeping && screen != MAIN_SCREEN &&
+      time(0) - screen_time >= screen_timeout) {
+    screen = MAIN_SCREEN;
+    screen_changed = true;
   }
+  update_screen(now, valid);
+  if (resuming) {
+    trace(TRACE_RESUME, 0);
+    resuming = false;
+  }
+
+  trace(TRACE_WAKE, wake_start);
   if (sleeping)
-    deep_sleep();
+    deep_sleep(valid ? &now : 0);
+}
+
+// shows what a burst of messages has changed
+void event_tasks() {
+  int64_t wake_start = trace_start();
+  struct tm now;
+  bool valid = read_time(now);
+  update_screen(now, valid);
+  trace(TRACE_WAKE, wake_start);
+}
+
+// ticks to wait for the next minute change, or the probe before it
+TickType_t ticks_to_minute() {
+  const int64_t tick = portTICK_PERIOD_MS * 1000;
+  struct timeval now;
+  gettimeofday(&now, 0);
+  int64_t left = (60 - now.tv_sec % 60) * 1000000LL - now.tv_usec -
+    time_probe_lead();
+  if (left <= 0)
+    return 0;
+  return (left + tick - 1) / tick;
+}
+
+void handle_button(unsigned button) {
+  ESP_LOGI(TAG, "Button %u pressed", button);
+  screen_time = time(0);
+  switch (button) {
+  case BUTTON_BACK:
+    screen = MAIN_SCREEN;
+    screen_changed = true;
+    break;
+  case BUTTON_UP:
+    screen = NOTIFICATION_SCREEN;
+    scroll_notifications(-1);
+    break;
+  case BUTTON_DOWN:
+    screen = NOTIFICATION_SCREEN;
+    scroll_notifications(1);
+    break;
+  case BUTTON_MENU:
+    // further presses show the wake cycle phases, then the last ones
+    screen = screen == INFO_SCREEN ? TRACE_SCREEN :
+      screen == TRACE_SCREEN ? TRACE_LOG_SCREEN : INFO_SCREEN;
+    screen_changed = true;
+    break;
+  }
+}
+
+void handle_message(Message &msg) {
+  int64_t start = trace_start();
+  if (!handle_misc_hw_events(msg)) {
+    switch (msg.type) {
+    case BUTTON_PRESSED:
+      handle_button((unsigned)(uintptr_t)msg.data);
+      break;
+    case BUTTON_RELEASED:
+      ESP_LOGI(TAG, "Button %u released", (unsigned)(uintptr_t)msg.data);
+      break;
+    case CLIENT_SUBSCRIBED:
+      send_info();
+      send_battery(battery.get_level());
+      break;
+    case CLIENT_TIME: {
+      tm* t = (tm *)msg.data;
+      ESP_LOGI(TAG, "Got time: %u-%u-%u %u:%u:%u",
+               t->tm_year, t->tm_mon, t->tm_mday,
+               t->tm_hour, t->tm_min, t->tm_sec);
+      sync_current_time(t);
+      delete t;
+      break;
+    }
+    case CLIENT_NOTIFICATION: {
+      if (handle_notification((uintptr_t)msg.data)) {
+        notification_page = 0;
+        screen = NOTIFICATION_SCREEN;
+        screen_changed = true;
+      }
+      break;
+    }
+    case CLIENT_FIND:
+      vibrate(VIBRATE_FIND);
+      break;
+    case CLIENT_CONNECTED:
+      prev_connected = connected;
+      connected = true;
+      break;
+    case CLIENT_DISCONNECTED:
+      prev_connected = connected;
+      connected = false;
+      ++disconnect_count;
+      telemetry_append(TELEMETRY_DISCONNECT, disconnect_count);
+      break;
+    }
+  }
+  if (msg.type >= CLIENT_SUBSCRIBED && msg.type <= CLIENT_DISCONNECTED)
+    trace(TRACE_BLE, start);
 }
 
 void setup_pm() {
@@ -305,13 +632,14 @@ extern "C" void app_main()
   // esp_deep_sleep_start();
 
   time_sync_day = 0;
-  screen = MAIN_SCREEN;
   screen_changed = true;
   displayed_notification = 0;
+  displayed_page = 0;
   connected = false;
   prev_connected = false;
   disconnect_count = 0;
   ringing = false;
+  pending_alert = ALERT_NONE;
   sleeping = false;
   bool refresh = false;
 
@@ -323,14 +651,27 @@ extern "C" void app_main()
     prev_day = 0;
     prev_hour = 0;
     prev_minute = 0;
+    trace_reset();
+    logged_wakes = {};
+    screen = MAIN_SCREEN;
+    notification_page = 0;
+    canvas.Invalidate();
   }
-  setup_nvs();
+  // NVS and BLE are only set up when the watch stays awake
+  setup_main_queue();
   setup_misc_hw();
+  // a button or the backstop timer leaves the countdown running
+  if (wakeup_reason != ESP_SLEEP_WAKEUP_UNDEFINED)
+    clear_rtc_timer();
+  notifications.Restore();
+  resuming = wakeup_button() >= 0;
+  if (resuming)
+    handle_button(wakeup_button());
   display.init();
   display.setRefresh(refresh);
-  idle_tasks();
+  clock_tick();
   setup_pm();
-  setup_main_queue();
+  setup_nvs();
   setup_ble("Whatcheee2");
 
   // notifications.add("Довольно короткое сообщение №1 123456 code");
@@ -341,74 +682,27 @@ extern "C" void app_main()
   
   while(true) {
     struct Message msg;
-    int interval = minute / portTICK_PERIOD_MS;
-    if (xQueueReceive(main_queue, &msg, interval) == pdTRUE) {
-      if (!handle_misc_hw_events(msg)) {
-        switch (msg.type) {
-        case BUTTON_PRESSED:
-          ESP_LOGI(TAG, "Button %u pressed", (unsigned)msg.data);
-          switch ((unsigned)msg.data) {
-          case BUTTON_BACK:
-            screen = MAIN_SCREEN;
-            screen_changed = true;
-            break;
-          case BUTTON_UP:
-            screen = NOTIFICATION_SCREEN;
-            notifications.prev();
-            break;
-          case BUTTON_DOWN:
-            screen = NOTIFICATION_SCREEN;
-            notifications.next();
-            break;
-          case BUTTON_MENU:
-            screen = INFO_SCREEN;
-            screen_changed = true;
-            break;
-          }
-          break;
-        case BUTTON_RELEASED:
-          ESP_LOGI(TAG, "Button %u released", (unsigned)msg.data);
-          break;
-        case CLIENT_SUBSCRIBED:
-          send_info();
-          send_battery(battery.get_level());
-          break;
-        case CLIENT_TIME: {
-          tm* t = (tm *)msg.data;
-          ESP_LOGI(TAG, "Got time: %u-%u-%u %u:%u:%u",
-                   t->tm_year, t->tm_mon, t->tm_mday,
-                   t->tm_hour, t->tm_min, t->tm_sec);
-          sync_current_time(t);
-          delete t;
-          break;
-        }
-        case CLIENT_NOTIFICATION: {
-          Notification *notif = (Notification *)msg.data;
-          if (handle_notification(notif)) {
-            screen = NOTIFICATION_SCREEN;
-            screen_changed = true;
-          }
-          delete notif;
-          break;
-        }
-        case CLIENT_FIND:
-          vibrate(50, 10);
-          break;
-        case CLIENT_CONNECTED:
-          prev_connected = connected;
-          connected = true;
-          break;
-        case CLIENT_DISCONNECTED:
-          prev_connected = connected;
-          connected = false;
-          ++disconnect_count;
-          break;
-        }
-      }
-      idle_tasks();
+    if (xQueueReceive(main_queue, &msg, ticks_to_minute()) == pdTRUE) {
+      // a burst of messages is handled before a single refresh, after a
+      // notification the next one is awaited for a while
+      TickType_t deadline = xTaskGetTickCount() +
+        pdMS_TO_TICKS(refresh_window_limit);
+      TickType_t wait;
+      do {
+        wait = msg.type == CLIENT_NOTIFICATION ?
+          pdMS_TO_TICKS(refresh_window) : 0;
+        TickType_t left = deadline - xTaskGetTickCount();
+        if ((int32_t)left < 0)
+          left = 0;
+        if (wait > left)
+          wait = left;
+        handle_message(msg);
+      } while (xQueueReceive(main_queue, &msg, wait) == pdTRUE);
+      alert();
+      event_tasks();
     }
-    else 
-      idle_tasks();
+    else if (!time_probe_lead() || probe_time())
+      clock_tick();
     // uart_wait_tx_done(UART_NUM_2, 200 / portTICK_PERIOD_MS);
   }
 }
@@ -0,0 +1,170 @@
+// A notification screen drawn and refreshed through the canvas, glyphs
+// blitted and the changed bytes pushed by Update(), versus the baseline
+// which plotted every set bit with the virtual drawPixel() of the driver
+// (Adafruit-GFX drawChar()) and refreshed the whole screen. Both paths
+// end in a driver stand-in with a real buffer, the panels have to match.
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "canvas.h"
+#include "esp_timer.h"
+#include "glyph.h"
+#include "typography.h"
+#include "c509_bold37pt.h"
+#include "ter_x28b_pcf28pt.h"
+#include "ter_x32b_pcf32pt.h"
+
+extern "C" void sim_log(char level, const char* tag, const char* format, ...) {
+}
+
+int64_t esp_timer_get_time() {
+  return 0;
+}
+
+// the driver buffer as on the device, a refresh copies it to the panel
+Gdeh0154d67::Gdeh0154d67(EpdSpi& io)
+  : Epd(GDEH0154D67_WIDTH, GDEH0154D67_HEIGHT), IO(io) {
+  memset(_buffer, 0xff, sizeof(_buffer));
+  memset(panel, 0xff, sizeof(panel));
+}
+
+void Gdeh0154d67::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= _width || y < 0 || y >= _height)
+    return;
+  uint16_t i = x / 8 + y * (GDEH0154D67_WIDTH / 8);
+  if (color)
+    _buffer[i] |= 1 << (7 - x % 8);
+  else
+    _buffer[i] &= ~(1 << (7 - x % 8));
+}
+
+void Gdeh0154d67::writeRow(int16_t x, int16_t y, const uint8_t* bits,
+                           uint16_t bytes) {
+  memcpy(_buffer + y * (GDEH0154D67_WIDTH / 8) + x / 8, bits, bytes);
+}
+
+void Gdeh0154d67::fillScreen(uint16_t color) {
+  memset(_buffer, color ? 0xff : 0x00, sizeof(_buffer));
+}
+
+void Gdeh0154d67::update() {
+  memcpy(panel, _buffer, sizeof(panel));
+}
+
+void Gdeh0154d67::updateWindow(int16_t x, int16_t y, int16_t w, int16_t h,
+                               bool using_rotation) {
+  int16_t x_end = (x + w + 7) & ~7;
+  x &= ~7;
+  if (x_end > _width)
+    x_end = _width;
+  for (int16_t row = y; row < y + h && row < _height; ++row) {
+    uint16_t offset = row * (GDEH0154D67_WIDTH / 8) + x / 8;
+    memcpy(panel + offset, _buffer + offset, (x_end - x) / 8);
+  }
+}
+
+// plots every set bit through the virtual drawPixel() of the driver
+class PixelTarget {
+ private:
+  Epd &display;
+  const GFXfont *font = 0;
+  bool compressed = false;
+
+ public:
+  PixelTarget(Epd& tgt): display(tgt) {}
+
+  void setFont(const GFXfont *f, bool c = false) {
+    font = f;
+    compressed = c;
+  }
+
+  void fillScreen(uint16_t color) {
+    display.fillScreen(color);
+  }
+
+  void drawChar(int16_t x, int16_t y, unsigned char c,
+                uint16_t color, uint16_t bg, uint8_t size) {
+    const GFXglyph *glyph = &font->glyph[c - font->first];
+    GlyphStream bits(font, glyph, compressed);
+    for (int16_t yy = y + glyph->yOffset; !bits.done(); ++yy) {
+      if (!bits.nextRow())
+        continue;
+      for (uint8_t xx = 0; xx < glyph->width; ++xx)
+        if (bits.pixel())
+          display.drawPixel(x + glyph->xOffset + xx, yy, color);
+    }
+  }
+
+  int16_t width() {
+    return display.width();
+  }
+};
+
+static const char* texts[] = {
+  "Ваш код подтверждения: 482913. Никому не сообщайте его.",
+  "Meeting moved to 15:30, room 4B. Bring the quarterly numbers please!",
+  "Мама: Позвони когда освободишься, нужно обсудить выходные",
+  "Your package 1Z999AA10123456784 is out for delivery today",
+};
+
+EpdSpi io;
+Gdeh0154d67 fast_display(io), slow_display(io);
+CanvasShadow fast_shadow;
+Canvas fast(fast_display, fast_shadow);
+PixelTarget pixels(slow_display);
+Typography<Canvas> fast_typography(fast);
+Typography<PixelTarget> slow_typography(pixels);
+
+template<typename T>
+static void draw(Typography<T>& typography, T& target, const char* text) {
+  target.fillScreen(EPD_WHITE);
+  SET_FONT(typography, C059_Bold37pt);
+  typography.PrintCentered("12:34", 5);
+  SET_FONT(typography, ter_x28b_pcf28pt);
+  typography.FitText(text, 5, 60, 190, 135);
+  SET_FONT(typography, ter_x32b_pcf32pt);
+  typography.PrintCentered("Пн 12 Окт", 160);
+}
+
+static void show_slow(const char* text) {
+  draw(slow_typography, pixels, text);
+  slow_display.updateWindow(0, 0, GDEH0154D67_WIDTH, GDEH0154D67_HEIGHT,
+                            false);
+}
+
+static void show_fast(const char* text) {
+  draw(fast_typography, fast, text);
+  fast.Update(false);
+}
+
+// every round changes the text, so there is something to refresh
+template<typename F>
+static double measure(F show, const char* text, const char* other,
+                      int rounds) {
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; ++i)
+    show(i & 1 ? other : text);
+  show(text);
+  std::chrono::duration<double, std::micro> spent =
+    std::chrono::steady_clock::now() - start;
+  return spent.count() / (rounds + 1);
+}
+
+int main(int argc, char** argv) {
+  const int rounds = 200;
+  const unsigned count = sizeof(texts) / sizeof(texts[0]);
+  int failed = 0;
+  for (unsigned i = 0; i < count; ++i) {
+    const char* text = texts[i];
+    const char* other = texts[(i + 1) % count];
+    double slow_us = measure(show_slow, text, other, rounds);
+    double fast_us = measure(show_fast, text, other, rounds);
+    bool same = !memcmp(fast_display.panel, slow_display.panel,
+                        GDEH0154D67_BUFFER_SIZE);
+    failed += !same;
+    printf("screen %u  drawPixel %7.1f us  canvas %7.1f us  x%.1f%s\n",
+           i, slow_us, fast_us, slow_us / fast_us,
+           same ? "" : "  PANELS DIFFER");
+  }
+  return failed ? 1 : 0;
+}
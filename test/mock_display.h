@@ -0,0 +1,51 @@
+// Typography target for the host tools. Prints glyphs as ASCII art when
+// given a stream and counts what drawing would cost.
+#pragma once
+#include <stdio.h>
+#include "../main/glyph.h"
+
+class MockDisplay {
+private:
+  const GFXfont* font;
+  bool compressed;
+  FILE* out;
+public:
+  unsigned glyphs = 0;
+  unsigned bitmap_bytes = 0;    // font data read
+  unsigned pixels = 0;          // set pixels
+
+  MockDisplay(FILE* stream = stdout): out(stream) {}
+
+  void setFont(const GFXfont *f, bool c = false) {
+    font = f;
+    compressed = c;
+  }
+
+  void drawChar(int16_t x, int16_t y, unsigned char c,
+           uint16_t color, uint16_t bg, uint8_t size) {
+    GFXglyph *glyph = &font->glyph[c - font->first];
+    GlyphStream bits(font, glyph, compressed);
+    unsigned bit_count = 0;
+    ++glyphs;
+    if (compressed && glyph->width)
+      bitmap_bytes += (glyph->height + 7) / 8;
+    while (!bits.done()) {
+      bool ink = bits.nextRow();
+      if (ink)
+        bit_count += glyph->width;
+      for (int x = 0; x < glyph->width; ++x) {
+        bool set = ink && bits.pixel();
+        pixels += set;
+        if (out)
+          fputc(set ? '#' : ' ', out);
+      }
+      if (out)
+        fputc('\n', out);
+    }
+    bitmap_bytes += (bit_count + 7) / 8;
+  }
+
+  int16_t width() {
+    return 200;
+  }
+};
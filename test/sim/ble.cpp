@@ -0,0 +1,132 @@
+// BLE stand-in implementing ble.h. The phone follows the Chronos app:
+// it connects shortly after the watch starts advertising, subscribes and
+// sends the current time, notifications are dropped while disconnected.
+#include "sim.h"
+
+#include <algorithm>
+#include <ctime>
+#include <string>
+
+#include "ble.h"
+#include "chronos.h"
+#include "notifications.h"
+#include "main_queue.h"
+
+using namespace sim;
+
+static bool stack_up = false;
+static bool phone_in_range = false;
+static bool connected = false;
+static bool subscribed = false;
+static unsigned generation = 0;
+static ChronosReceiver receiver(notifications);
+
+static void post(unsigned type, void* data) {
+  struct Message msg = {type, data};
+  xQueueSend(main_queue, &msg, 0);
+}
+
+// The app writes a Chronos packet in chunks of the MTU, continuations
+// are prefixed with a sequence number. The chunks reach the receiver as
+// two segments like chained mbufs.
+static void write_packet(uint8_t code, const uint8_t* payload, size_t len) {
+  const size_t MTU = 20;
+  std::string packet = {(char)0xab, (char)((len + 3) >> 8),
+                        (char)((len + 3) & 0xff), (char)0xff, (char)code,
+                        (char)0x80};
+  packet.append((const char*)payload, len);
+  uint8_t seq = 0;
+  for (size_t pos = 0; pos < packet.size();) {
+    std::string chunk;
+    if (pos)
+      chunk += (char)seq++;
+    size_t n = std::min(MTU - chunk.size(), packet.size() - pos);
+    chunk.append(packet, pos, n);
+    pos += n;
+    const uint8_t* data = (const uint8_t*)chunk.data();
+    size_t split = chunk.size() / 2;
+    receiver.BeginWrite(data, std::min<size_t>(chunk.size(), 4));
+    receiver.Feed(data, split);
+    receiver.Feed(data + split, chunk.size() - split);
+  }
+}
+
+static void send_time() {
+  time_t t = now() / second;
+  tm time;
+  gmtime_r(&t, &time);
+  int year = time.tm_year + 1900;
+  uint8_t payload[] = {0, (uint8_t)(year >> 8), (uint8_t)year,
+                       (uint8_t)(time.tm_mon + 1), (uint8_t)time.tm_mday,
+                       (uint8_t)time.tm_hour, (uint8_t)time.tm_min,
+                       (uint8_t)time.tm_sec};
+  write_packet(0x93, payload, sizeof(payload));
+}
+
+static void connect() {
+  if (!stack_up || !phone_in_range || connected)
+    return;
+  unsigned gen = generation;
+  // advertising interval is 3-4 seconds
+  at(now() + 3 * second, [gen] {
+    if (gen != generation || !stack_up || !phone_in_range || connected)
+      return;
+    connected = true;
+    post(CLIENT_CONNECTED, 0);
+    at(now() + second, [gen] {
+      if (gen != generation || !connected)
+        return;
+      subscribed = true;
+      post(CLIENT_SUBSCRIBED, 0);
+      send_time();
+    });
+  });
+}
+
+void sim::ble_phone(bool in_range) {
+  phone_in_range = in_range;
+  if (in_range)
+    connect();
+  else if (connected) {
+    connected = subscribed = false;
+    ++generation;
+    post(CLIENT_DISCONNECTED, 0);
+  }
+}
+
+void sim::ble_notify(uint8_t icon, uint8_t state, const char* text) {
+  if (!connected) {
+    ++stats.dropped;
+    return;
+  }
+  ++stats.notifications;
+  std::string payload = {(char)icon, (char)state};
+  payload += text;
+  write_packet(0x72, (const uint8_t*)payload.data(), payload.size());
+}
+
+void sim::ble_find() {
+  uint8_t payload[] = {0, 0};
+  if (connected)
+    write_packet(0x71, payload, sizeof(payload));
+}
+
+void sim::ble_reset() {
+  stack_up = connected = subscribed = false;
+  ++generation;
+}
+
+void setup_ble(const char* name) {
+  stack_up = true;
+  connect();
+}
+
+void send_info() {
+  if (subscribed)
+    ++stats.ble_tx;
+}
+
+void send_battery(uint8_t level) {
+  if (subscribed)
+    ++stats.ble_tx;
+}
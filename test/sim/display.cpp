@@ -0,0 +1,123 @@
+// GDEH0154D67 stand-in, refresh timings follow the panel datasheet
+#include "sim.h"
+
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#include "canvas.h"
+#include "gdeh0154d67.h"
+
+using namespace sim;
+
+static const int64_t full_refresh_time = 2000 * 1000;
+static const int64_t partial_refresh_time = 300 * 1000;
+static unsigned frame_no = 0;
+
+// the firmware draws into the canvas, see watchy.cpp
+extern Canvas canvas;
+extern Gdeh0154d67 display;
+extern CanvasShadow panel_shadow;
+
+static void check_frame(const uint8_t* panel) {
+  if (memcmp(panel, canvas.buffer(), GDEH0154D67_BUFFER_SIZE))
+    ++stats.stale_frames;
+}
+
+static void save_frame(const uint8_t* panel) {
+  if (!frames_dir)
+    return;
+  char path[256];
+  snprintf(path, sizeof(path), "%s/frame%04u.pbm", frames_dir, frame_no++);
+  FILE* f = fopen(path, "wb");
+  if (!f)
+    return;
+  fprintf(f, "P4\n%d %d\n", GDEH0154D67_WIDTH, GDEH0154D67_HEIGHT);
+  // PBM uses 1 for black
+  for (uint32_t i = 0; i < GDEH0154D67_BUFFER_SIZE; ++i)
+    fputc(~panel[i], f);
+  fclose(f);
+}
+
+Gdeh0154d67::Gdeh0154d67(EpdSpi& io)
+  : Epd(GDEH0154D67_WIDTH, GDEH0154D67_HEIGHT), IO(io) {
+  memset(_buffer, 0xff, sizeof(_buffer));
+  memset(panel, 0xff, sizeof(panel));
+}
+
+void Gdeh0154d67::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (x < 0 || x >= _width || y < 0 || y >= _height)
+    return;
+  uint16_t i = x / 8 + y * (GDEH0154D67_WIDTH / 8);
+  if (color)
+    _buffer[i] |= 1 << (7 - x % 8);
+  else
+    _buffer[i] &= ~(1 << (7 - x % 8));
+}
+
+void Gdeh0154d67::writeRow(int16_t x, int16_t y, const uint8_t* bits,
+                           uint16_t bytes) {
+  if (y < 0 || y >= _height || x < 0 || x + bytes * 8 > _width)
+    return;
+  memcpy(_buffer + y * (GDEH0154D67_WIDTH / 8) + x / 8, bits, bytes);
+}
+
+void Gdeh0154d67::fillScreen(uint16_t color) {
+  memset(_buffer, color ? 0xff : 0x00, sizeof(_buffer));
+}
+
+void Gdeh0154d67::init(bool debug) {
+  fillScreen(EPD_WHITE);
+}
+
+void Gdeh0154d67::setRefresh(bool refresh) {
+  _refresh = refresh;
+}
+
+void Gdeh0154d67::update() {
+  ++stats.full_updates;
+  stats.spi_bytes += sizeof(_buffer);
+  memcpy(panel, _buffer, sizeof(panel));
+  sim::sleep(full_refresh_time);
+  stats.panel_busy += full_refresh_time;
+  check_frame(panel);
+  save_frame(panel);
+}
+
+void Gdeh0154d67::updateWindow(int16_t x, int16_t y, int16_t w, int16_t h,
+                               bool using_rotation) {
+  // the controller addresses RAM in whole bytes horizontally
+  int16_t x_end = x + w;
+  x = x & ~7;
+  x_end = (x_end + 7) & ~7;
+  if (x < 0)
+    x = 0;
+  if (y < 0)
+    y = 0;
+  if (x_end > _width)
+    x_end = _width;
+  int16_t y_end = y + h > _height ? _height : y + h;
+  if (x_end <= x || y_end <= y)
+    return;
+  ++stats.partial_updates;
+  stats.window_pixels += (x_end - x) * (y_end - y);
+  stats.spi_bytes += (x_end - x) / 8 * (y_end - y);
+  for (int16_t row = y; row < y_end; ++row) {
+    uint16_t offset = row * (GDEH0154D67_WIDTH / 8) + x / 8;
+    memcpy(panel + offset, _buffer + offset, (x_end - x) / 8);
+  }
+  sim::sleep(partial_refresh_time);
+  stats.panel_busy += partial_refresh_time;
+  check_frame(panel);
+  save_frame(panel);
+}
+
+void Gdeh0154d67::deepSleep() {
+  ++stats.panel_sleeps;
+}
+
+void sim::display_reset() {
+  // ordinary RAM is lost in deep sleep, only the shadow is in RTC memory
+  canvas.~Canvas();
+  new (&canvas) Canvas(display, panel_shadow);
+}
@@ -0,0 +1,173 @@
+// FreeRTOS stand-in. Only the main task runs, it blocks on the simulated
+// clock, timers and ISRs are events dispatched while it waits.
+#include "sim.h"
+
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "freertos/timers.h"
+#include "esp_timer.h"
+
+using namespace sim;
+
+struct SimQueue {
+  UBaseType_t length;
+  UBaseType_t item_size;
+  std::deque<std::vector<uint8_t>> items;
+};
+
+struct SimTimer {
+  TickType_t period;
+  bool auto_reload;
+  void* id;
+  TimerCallbackFunction_t callback;
+  bool active = false;
+  unsigned generation = 0;
+};
+
+static std::vector<SimTimer*> timers;
+
+static int64_t ticks_to_us(TickType_t ticks) {
+  return (int64_t)ticks * portTICK_PERIOD_MS * 1000;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+  return new SimQueue{length, item_size, {}};
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t wait) {
+  if (!queue || queue->items.size() >= queue->length)
+    return errQUEUE_FULL;
+  const uint8_t* p = (const uint8_t*)item;
+  queue->items.emplace_back(p, p + queue->item_size);
+  return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item,
+                             BaseType_t* woken) {
+  return xQueueSend(queue, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* buffer, TickType_t wait) {
+  int64_t deadline =
+    wait == portMAX_DELAY ? INT64_MAX : now() + ticks_to_us(wait);
+  if (!sim::wait(deadline, [queue] { return !queue->items.empty(); }))
+    return pdFALSE;
+  memcpy(buffer, queue->items.front().data(), queue->item_size);
+  queue->items.pop_front();
+  ++stats.messages;
+  return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+  return queue->items.size();
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* buffer) {
+  buffer->taken = false;
+  return buffer;
+}
+
+// taking a taken mutex would block the only task forever
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t wait) {
+  if (mutex->taken) {
+    fprintf(stderr, "mutex deadlock\n");
+    abort();
+  }
+  mutex->taken = true;
+  return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex) {
+  mutex->taken = false;
+  return pdTRUE;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name,
+                       uint32_t stack_depth, void* params,
+                       UBaseType_t priority, TaskHandle_t* created) {
+  if (created)
+    *created = 0;
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+}
+
+void vTaskDelay(TickType_t ticks) {
+  sim::sleep(ticks_to_us(ticks));
+}
+
+TickType_t xTaskGetTickCount() {
+  return uptime() / 1000 / portTICK_PERIOD_MS;
+}
+
+int64_t esp_timer_get_time() {
+  return uptime();
+}
+
+static void arm(TimerHandle_t timer) {
+  unsigned generation = ++timer->generation;
+  timer->active = true;
+  at(now() + ticks_to_us(timer->period), [timer, generation] {
+    if (timer->generation != generation || !timer->active)
+      return;
+    timer->active = false;
+    if (timer->auto_reload)
+      arm(timer);
+    timer->callback(timer);
+  });
+}
+
+TimerHandle_t xTimerCreate(const char* name, TickType_t period,
+                           UBaseType_t auto_reload, void* id,
+                           TimerCallbackFunction_t callback) {
+  timers.push_back(new SimTimer{period, auto_reload != 0, id, callback});
+  return timers.back();
+}
+
+void sim::rtos_reset() {
+  for (auto timer : timers) {
+    timer->active = false;
+    ++timer->generation;
+  }
+}
+
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t wait) {
+  arm(timer);
+  return pdPASS;
+}
+
+BaseType_t xTimerReset(TimerHandle_t timer, TickType_t wait) {
+  arm(timer);
+  return pdPASS;
+}
+
+BaseType_t xTimerStop(TimerHandle_t timer, TickType_t wait) {
+  timer->active = false;
+  ++timer->generation;
+  return pdPASS;
+}
+
+BaseType_t xTimerChangePeriod(TimerHandle_t timer, TickType_t period,
+                              TickType_t wait) {
+  timer->period = period;
+  arm(timer);
+  return pdPASS;
+}
+
+BaseType_t xTimerIsTimerActive(TimerHandle_t timer) {
+  return timer->active ? pdTRUE : pdFALSE;
+}
+
+void* pvTimerGetTimerID(TimerHandle_t timer) {
+  return timer->id;
+}
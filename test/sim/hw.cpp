@@ -0,0 +1,510 @@
+// Stand-ins for the GPIO, ADC, I2C/PCF8563, NVS, sleep and power
+// management drivers of the watch
+#include "sim.h"
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "driver/gpio.h"
+#include "driver/i2c_master.h"
+#include "esp_adc/adc_oneshot.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "nvs_flash.h"
+#include "pcf8563.h"
+
+using namespace sim;
+
+static const gpio_num_t button_pins[] = {
+  GPIO_NUM_26, GPIO_NUM_25, GPIO_NUM_35, GPIO_NUM_4
+};
+#define VIB_MOTOR_PIN GPIO_NUM_13
+#define RTC_INT_PIN GPIO_NUM_27
+
+// GPIO
+
+struct Pin {
+  int level = 0;
+  gpio_int_type_t intr_type = GPIO_INTR_DISABLE;
+  bool intr_enabled = false;
+  gpio_isr_t handler = 0;
+  void* arg = 0;
+};
+
+static Pin pins[GPIO_NUM_MAX];
+// the RTC interrupt output is open drain with a pull-up
+static bool rtc_int_released = (pins[RTC_INT_PIN].level = 1);
+static bool isr_service = false;
+static int64_t motor_on_since = -1;
+
+static uint64_t ext1_mask = 0;
+static esp_sleep_ext1_wakeup_mode_t ext1_mode = ESP_EXT1_WAKEUP_ALL_LOW;
+static gpio_num_t ext0_pin = GPIO_NUM_NC;
+static int ext0_level = 0;
+static int64_t wakeup_timer = -1;
+static esp_sleep_wakeup_cause_t wakeup_cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+static uint64_t ext1_status = 0;
+static bool nvs_initialized = false;   // since the boot
+
+static void check_pin(gpio_num_t num) {
+  Pin& pin = pins[num];
+  if (deep_sleeping()) {
+    if (num == ext0_pin && pin.level == ext0_level) {
+      wakeup_cause = ESP_SLEEP_WAKEUP_EXT0;
+      wake_up();
+    } else if ((ext1_mask & (1ULL << num)) &&
+               ext1_mode == ESP_EXT1_WAKEUP_ANY_HIGH && pin.level) {
+      wakeup_cause = ESP_SLEEP_WAKEUP_EXT1;
+      ext1_status = 1ULL << num;
+      wake_up();
+    }
+    return;
+  }
+  if (!isr_service || !pin.handler || !pin.intr_enabled)
+    return;
+  if ((pin.intr_type == GPIO_INTR_HIGH_LEVEL && pin.level) ||
+      (pin.intr_type == GPIO_INTR_LOW_LEVEL && !pin.level))
+    pin.handler(pin.arg);
+}
+
+static void set_input(gpio_num_t num, int level) {
+  pins[num].level = level;
+  check_pin(num);
+}
+
+void sim::press_button(unsigned button, int64_t duration) {
+  ++stats.buttons;
+  gpio_num_t num = button_pins[button];
+  set_input(num, 1);
+  at(now() + duration, [num] { set_input(num, 0); }, false);
+}
+
+esp_err_t gpio_config(const gpio_config_t* config) {
+  for (int i = 0; i < GPIO_NUM_MAX; ++i)
+    if (config->pin_bit_mask & (1ULL << i)) {
+      pins[i].intr_type = config->intr_type;
+      pins[i].intr_enabled = config->intr_type != GPIO_INTR_DISABLE;
+    }
+  return ESP_OK;
+}
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num) {
+  return ESP_OK;
+}
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode) {
+  return ESP_OK;
+}
+
+esp_err_t gpio_pullup_dis(gpio_num_t gpio_num) {
+  return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level) {
+  if (gpio_num == VIB_MOTOR_PIN) {
+    if (level && motor_on_since < 0) {
+      ++stats.vibrations;
+      motor_on_since = now();
+    } else if (!level && motor_on_since >= 0) {
+      stats.vibration_time += now() - motor_on_since;
+      motor_on_since = -1;
+    }
+  }
+  pins[gpio_num].level = level;
+  return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num) {
+  return pins[gpio_num].level;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type) {
+  pins[gpio_num].intr_type = intr_type;
+  return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num) {
+  pins[gpio_num].intr_enabled = true;
+  check_pin(gpio_num);
+  return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num) {
+  pins[gpio_num].intr_enabled = false;
+  return ESP_OK;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags) {
+  isr_service = true;
+  return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler,
+                               void* args) {
+  pins[gpio_num].handler = isr_handler;
+  pins[gpio_num].arg = args;
+  check_pin(gpio_num);
+  return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t gpio_num, gpio_int_type_t intr_type) {
+  return ESP_OK;
+}
+
+// Sleep and power management
+
+esp_err_t esp_pm_configure(const void* config) {
+  return ESP_OK;
+}
+
+// RTC memory is modelled by the globals, which survive deep sleep anyway
+esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain,
+                              esp_sleep_pd_option_t option) {
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+  wakeup_timer = time_in_us;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t gpio_num, int level) {
+  ext0_pin = gpio_num;
+  ext0_level = level;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_ext1_wakeup(uint64_t io_mask,
+                                       esp_sleep_ext1_wakeup_mode_t mode) {
+  ext1_mask = io_mask;
+  ext1_mode = mode;
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup() {
+  return ESP_OK;
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+  return wakeup_cause;
+}
+
+uint64_t esp_sleep_get_ext1_wakeup_status() {
+  return ext1_status;
+}
+
+void esp_deep_sleep_start() {
+  if (motor_on_since >= 0) {
+    stats.vibration_time += now() - motor_on_since;
+    motor_on_since = -1;
+  }
+  wakeup_cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+  ext1_status = 0;
+  throw DeepSleep();
+}
+
+int64_t sim::hw_wakeup_timer() {
+  return wakeup_timer;
+}
+
+void sim::hw_timer_wakeup() {
+  wakeup_cause = ESP_SLEEP_WAKEUP_TIMER;
+}
+
+void sim::hw_reset() {
+  for (int i = 0; i < GPIO_NUM_MAX; ++i) {
+    pins[i].intr_type = GPIO_INTR_DISABLE;
+    pins[i].intr_enabled = false;
+    pins[i].handler = 0;
+  }
+  isr_service = false;
+  ext1_mask = 0;
+  ext0_pin = GPIO_NUM_NC;
+  wakeup_timer = -1;
+  nvs_initialized = false;
+}
+
+// Battery ADC, the battery discharges linearly with a bit of noise
+
+static int battery_mv = 2800;
+static int battery_drain = 40;   // per day
+static int64_t battery_since = -1;
+static uint32_t noise_seed = 12345;
+
+void sim::set_battery(int millivolts, int drain_per_day) {
+  battery_mv = millivolts;
+  battery_drain = drain_per_day;
+  battery_since = now();
+}
+
+esp_err_t adc_oneshot_new_unit(const adc_oneshot_unit_init_cfg_t* init_config,
+                               adc_oneshot_unit_handle_t* ret_unit) {
+  *ret_unit = 0;
+  return ESP_OK;
+}
+
+esp_err_t adc_oneshot_config_channel(adc_oneshot_unit_handle_t handle,
+                                     adc_channel_t channel,
+                                     const adc_oneshot_chan_cfg_t* config) {
+  return ESP_OK;
+}
+
+esp_err_t adc_oneshot_read(adc_oneshot_unit_handle_t handle,
+                           adc_channel_t chan, int* out_raw) {
+  ++stats.adc_reads;
+  if (battery_since < 0)
+    battery_since = now();
+  noise_seed = noise_seed * 1103515245 + 12345;
+  int noise = (int)((noise_seed >> 16) % 25) - 12;
+  int mv = battery_mv + noise -
+    (int)((now() - battery_since) * battery_drain / (24 * 3600 * second));
+  // inverse of the divider and attenuation math in Battery::get_voltage()
+  *out_raw = mv * 4096 / (2 * 2450);
+  return ESP_OK;
+}
+
+// I2C bus, the RTC is simulated at the pcf8563 API level below
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t* bus_config,
+                             i2c_master_bus_handle_t* ret_bus_handle) {
+  *ret_bus_handle = 0;
+  return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus_handle,
+                                    const i2c_device_config_t* dev_config,
+                                    i2c_master_dev_handle_t* ret_handle) {
+  *ret_handle = 0;
+  return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t i2c_dev,
+                              const uint8_t* write_buffer, size_t write_size,
+                              int xfer_timeout_ms) {
+  ++stats.i2c_transactions;
+  return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t i2c_dev,
+                                      const uint8_t* write_buffer,
+                                      size_t write_size,
+                                      uint8_t* read_buffer, size_t read_size,
+                                      int xfer_timeout_ms) {
+  ++stats.i2c_transactions;
+  memset(read_buffer, 0, read_size);
+  return ESP_OK;
+}
+
+// PCF8563, keeps its own time and runs through deep sleep
+
+static bool rtc_valid = true;
+static int64_t rtc_offset = 0;   // RTC time minus simulated time, seconds
+static uint8_t rtc_status2 = 0;
+static uint8_t rtc_timer_control = 0;
+static uint8_t rtc_timer = 0;
+static unsigned rtc_timer_generation = 0;
+
+void sim::set_rtc_valid(bool valid) {
+  rtc_valid = valid;
+}
+
+static void update_rtc_int() {
+  bool asserted = ((rtc_status2 & PCF8563_TF) && (rtc_status2 & PCF8563_TIE)) ||
+    ((rtc_status2 & PCF8563_AF) && (rtc_status2 & PCF8563_AIE));
+  set_input(RTC_INT_PIN, asserted ? 0 : 1);
+}
+
+static void start_rtc_timer() {
+  unsigned generation = ++rtc_timer_generation;
+  if (!(rtc_timer_control & PCF8563_TIMER_ENABLE) || !rtc_timer)
+    return;
+  static const int64_t periods[] = {
+    second / 4096, second / 64, second, minute
+  };
+  int64_t period = periods[rtc_timer_control & 3] * rtc_timer;
+  at(now() + period, [generation] {
+    if (generation != rtc_timer_generation)
+      return;
+    rtc_status2 |= PCF8563_TF;
+    update_rtc_int();
+    start_rtc_timer();
+  }, false);
+}
+
+int32_t pcf8563_init(const pcf8563_t* pcf) {
+  ++stats.i2c_transactions;
+  return PCF8563_OK;
+}
+
+int32_t pcf8563_read(const pcf8563_t* pcf, struct tm* time) {
+  ++stats.i2c_transactions;
+  time_t t = now() / second + rtc_offset;
+  gmtime_r(&t, time);
+  return rtc_valid ? PCF8563_OK : PCF8563_ERR_LOW_VOLTAGE;
+}
+
+int32_t pcf8563_write(const pcf8563_t* pcf, const struct tm* time) {
+  ++stats.i2c_transactions;
+  struct tm copy = *time;
+  rtc_offset = timegm(&copy) - now() / second;
+  rtc_valid = true;
+  return PCF8563_OK;
+}
+
+int32_t pcf8563_ioctl(const pcf8563_t* pcf, int16_t command, void* buffer) {
+  ++stats.i2c_transactions;
+  uint8_t* value = (uint8_t*)buffer;
+  switch (command) {
+  case PCF8563_CONTROL_STATUS2_READ:
+    *value = rtc_status2;
+    break;
+  case PCF8563_CONTROL_STATUS2_WRITE:
+    // flags can only be cleared by software
+    rtc_status2 = (*value & ~(PCF8563_TF | PCF8563_AF)) |
+      (rtc_status2 & *value & (PCF8563_TF | PCF8563_AF));
+    update_rtc_int();
+    break;
+  case PCF8563_TIMER_CONTROL_READ:
+    *value = rtc_timer_control;
+    break;
+  case PCF8563_TIMER_CONTROL_WRITE:
+    rtc_timer_control = *value;
+    start_rtc_timer();
+    break;
+  case PCF8563_TIMER_READ:
+    *value = rtc_timer;
+    break;
+  case PCF8563_TIMER_WRITE:
+    rtc_timer = *value;
+    start_rtc_timer();
+    break;
+  case PCF8563_ALARM_SET:
+  case PCF8563_ALARM_READ:
+    break;
+  default:
+    return PCF8563_ERROR_NOTTY;
+  }
+  return PCF8563_OK;
+}
+
+// NVS, kept in memory for the whole run like flash would be
+
+struct nvs_opaque_iterator_t {
+  std::string ns;
+  std::vector<std::string> keys;
+  size_t pos;
+};
+
+static std::map<std::string, std::map<std::string, std::vector<uint8_t>>> nvs;
+static std::vector<std::string> nvs_handles;
+
+static std::map<std::string, std::vector<uint8_t>>& nvs_space(
+    nvs_handle_t handle) {
+  return nvs[nvs_handles[handle - 1]];
+}
+
+esp_err_t nvs_flash_init() {
+  nvs_initialized = true;
+  return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase() {
+  nvs.clear();
+  return ESP_OK;
+}
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t open_mode,
+                   nvs_handle_t* out_handle) {
+  if (!nvs_initialized)
+    return ESP_ERR_NVS_NOT_INITIALIZED;
+  nvs_handles.push_back(name);
+  *out_handle = nvs_handles.size();
+  return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+  return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key,
+                       const void* value, size_t length) {
+  ++stats.nvs_writes;
+  const uint8_t* p = (const uint8_t*)value;
+  nvs_space(handle)[key] = std::vector<uint8_t>(p, p + length);
+  return ESP_OK;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key,
+                       void* out_value, size_t* length) {
+  auto& space = nvs_space(handle);
+  auto it = space.find(key);
+  if (it == space.end())
+    return ESP_ERR_NVS_NOT_FOUND;
+  if (!out_value) {
+    *length = it->second.size();
+    return ESP_OK;
+  }
+  if (*length < it->second.size())
+    return ESP_ERR_NVS_INVALID_LENGTH;
+  *length = it->second.size();
+  memcpy(out_value, it->second.data(), *length);
+  return ESP_OK;
+}
+
+esp_err_t nvs_set_u8(nvs_handle_t handle, const char* key, uint8_t value) {
+  return nvs_set_blob(handle, key, &value, 1);
+}
+
+esp_err_t nvs_get_u8(nvs_handle_t handle, const char* key,
+                     uint8_t* out_value) {
+  size_t length = 1;
+  return nvs_get_blob(handle, key, out_value, &length);
+}
+
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key) {
+  ++stats.nvs_erases;
+  return nvs_space(handle).erase(key) ? ESP_OK : ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_entry_find_in_handle(nvs_handle_t handle, nvs_type_t type,
+                                   nvs_iterator_t* output_iterator) {
+  auto it = new nvs_opaque_iterator_t{nvs_handles[handle - 1], {}, 0};
+  for (auto& entry : nvs_space(handle))
+    it->keys.push_back(entry.first);
+  if (it->keys.empty()) {
+    delete it;
+    *output_iterator = 0;
+    return ESP_ERR_NVS_NOT_FOUND;
+  }
+  *output_iterator = it;
+  return ESP_OK;
+}
+
+esp_err_t nvs_entry_next(nvs_iterator_t* iterator) {
+  if (++(*iterator)->pos >= (*iterator)->keys.size()) {
+    delete *iterator;
+    *iterator = 0;
+    return ESP_ERR_NVS_NOT_FOUND;
+  }
+  return ESP_OK;
+}
+
+esp_err_t nvs_entry_info(const nvs_iterator_t iterator,
+                         nvs_entry_info_t* out_info) {
+  memset(out_info, 0, sizeof(*out_info));
+  strncpy(out_info->namespace_name, iterator->ns.c_str(),
+          sizeof(out_info->namespace_name) - 1);
+  strncpy(out_info->key, iterator->keys[iterator->pos].c_str(),
+          sizeof(out_info->key) - 1);
+  out_info->type = NVS_TYPE_BLOB;
+  return ESP_OK;
+}
+
+void nvs_release_iterator(nvs_iterator_t iterator) {
+  delete iterator;
+}
@@ -0,0 +1,403 @@
+#include "sim.h"
+
+#include <climits>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <malloc.h>
+#include <map>
+#include <sstream>
+#include <string>
+#include <sys/time.h>
+
+#include "esp_log.h"
+#include "telemetry.h"
+
+extern "C" void app_main();
+
+namespace sim {
+
+Stats stats;
+bool verbose = false;
+bool debug = false;
+const char* frames_dir = 0;
+
+struct Event {
+  std::function<void()> fn;
+  bool is_volatile;
+};
+
+static std::multimap<int64_t, Event> events;
+static int64_t clock_us = 0;
+static int64_t boot_us = 0;
+static int64_t system_offset = 0;   // ESP system time minus simulated time
+static bool finished = false;
+static bool sleeping_deeply = false;
+static bool woken = false;
+static size_t heap_base = 0;
+
+int64_t now() {
+  return clock_us;
+}
+
+int64_t uptime() {
+  return clock_us - boot_us;
+}
+
+void at(int64_t when, std::function<void()> fn, bool is_volatile) {
+  events.emplace(when, Event{std::move(fn), is_volatile});
+}
+
+static void dispatch() {
+  auto it = events.begin();
+  if (it->first > clock_us)
+    clock_us = it->first;
+  auto fn = std::move(it->second.fn);
+  events.erase(it);
+  fn();
+}
+
+void sleep(int64_t duration) {
+  int64_t end = clock_us + duration;
+  while (!events.empty() && events.begin()->first <= end)
+    dispatch();
+  clock_us = end;
+}
+
+bool wait(int64_t deadline, const std::function<bool()>& ready) {
+  if (ready())
+    return true;
+  while (!ready()) {
+    if (finished)
+      throw End();
+    if (events.empty() || events.begin()->first > deadline) {
+      if (deadline == INT64_MAX)
+        throw End();
+      clock_us = deadline;
+      ++stats.wakes;
+      sample_heap();
+      return false;
+    }
+    dispatch();
+  }
+  if (finished)
+    throw End();
+  ++stats.wakes;
+  sample_heap();
+  return true;
+}
+
+void sample_heap() {
+  size_t used = mallinfo2().uordblks;
+  used = used > heap_base ? used - heap_base : 0;
+  if (used > stats.heap_peak)
+    stats.heap_peak = used;
+  stats.heap_final = used;
+}
+
+bool deep_sleeping() {
+  return sleeping_deeply;
+}
+
+void wake_up() {
+  woken = true;
+}
+
+static void deep_sleep() {
+  ++stats.deep_sleeps;
+  for (auto it = events.begin(); it != events.end();)
+    it = it->second.is_volatile ? events.erase(it) : ++it;
+  ble_reset();
+  sleeping_deeply = true;
+  woken = false;
+  int64_t timer = hw_wakeup_timer();
+  int64_t deadline = timer < 0 ? INT64_MAX : clock_us + timer;
+  while (!woken && !finished &&
+         !events.empty() && events.begin()->first <= deadline)
+    dispatch();
+  if (!woken && !finished) {
+    if (deadline == INT64_MAX)
+      finished = true;
+    else {
+      clock_us = deadline;
+      hw_timer_wakeup();
+    }
+  }
+  sleeping_deeply = false;
+}
+
+static void boot() {
+  ++stats.boots;
+  boot_us = clock_us;
+  rtos_reset();
+  hw_reset();
+  display_reset();
+}
+
+static std::string format_time(int64_t us) {
+  time_t t = us / second;
+  struct tm tm;
+  gmtime_r(&t, &tm);
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%02d %02d:%02d:%02d.%03d",
+           tm.tm_mday, tm.tm_hour, tm.tm_min, tm.tm_sec,
+           (int)(us / 1000 % 1000));
+  return buf;
+}
+
+static const char* button_names[] = {"menu", "back", "up", "down"};
+
+static bool parse_time(const std::string& subj, int64_t day, int64_t& result) {
+  int h = 0, m = 0, s = 0;
+  if (sscanf(subj.c_str(), "%d:%d:%d", &h, &m, &s) < 2)
+    return false;
+  result = day + ((int64_t)h * 3600 + m * 60 + s) * second;
+  return true;
+}
+
+static std::string unescape(const std::string& subj) {
+  std::string result;
+  for (size_t i = 0; i < subj.size(); ++i) {
+    if (subj[i] == '\\' && i + 1 < subj.size()) {
+      char c = subj[++i];
+      result += c == 'n' ? '\n' : c == 't' ? '\t' : c;
+    } else
+      result += subj[i];
+  }
+  return result;
+}
+
+// Scenario format, one command per line, '#' starts a comment:
+//   start YYYY-MM-DD HH:MM[:SS]   power-on time, event times are
+//                                 relative to midnight of that day
+//   battery <mV> [<mV per day>]   battery model
+//   rtc invalid                   RTC lost its time before power-on
+//   HH:MM[:SS] phone on|off       phone comes into or leaves BLE range
+//   HH:MM[:SS] notify <icon> <text>
+//   HH:MM[:SS] call <text>        incoming call, ended by hangup
+//   HH:MM[:SS] hangup
+//   HH:MM[:SS] find
+//   HH:MM[:SS] press menu|back|up|down [ms]
+//   HH:MM[:SS] end
+// Hours may exceed 23 to continue into the following days.
+static bool load_scenario(const char* path) {
+  std::ifstream in(path);
+  if (!in) {
+    fprintf(stderr, "Can't open %s\n", path);
+    return false;
+  }
+  int64_t day = 0;
+  bool started = false;
+  std::string line;
+  for (int no = 1; std::getline(in, line); ++no) {
+    size_t hash = line.find('#');
+    if (hash != std::string::npos)
+      line.erase(hash);
+    std::istringstream words(line);
+    std::string first;
+    if (!(words >> first))
+      continue;
+    if (first == "start") {
+      std::string date, time;
+      words >> date >> time;
+      struct tm tm = {};
+      if (sscanf(date.c_str(), "%d-%d-%d",
+                 &tm.tm_year, &tm.tm_mon, &tm.tm_mday) != 3) {
+        fprintf(stderr, "%s:%d: bad date\n", path, no);
+        return false;
+      }
+      tm.tm_year -= 1900;
+      tm.tm_mon -= 1;
+      day = (int64_t)timegm(&tm) * second;
+      if (!parse_time(time, day, clock_us)) {
+        fprintf(stderr, "%s:%d: bad time\n", path, no);
+        return false;
+      }
+      started = true;
+      continue;
+    }
+    if (!started) {
+      fprintf(stderr, "%s:%d: scenario has to begin with start\n", path, no);
+      return false;
+    }
+    if (first == "battery") {
+      int mv = 0, drain = 0;
+      words >> mv >> drain;
+      set_battery(mv, drain);
+      continue;
+    }
+    if (first == "rtc") {
+      std::string state;
+      words >> state;
+      set_rtc_valid(state != "invalid");
+      continue;
+    }
+    int64_t when;
+    std::string command;
+    if (!parse_time(first, day, when) || !(words >> command)) {
+      fprintf(stderr, "%s:%d: bad event\n", path, no);
+      return false;
+    }
+    std::string rest;
+    std::getline(words >> std::ws, rest);
+    if (command == "phone") {
+      bool on = rest == "on";
+      at(when, [on] { ble_phone(on); }, false);
+    } else if (command == "notify") {
+      std::istringstream args(rest);
+      int icon = 0;
+      args >> icon;
+      std::string text;
+      std::getline(args >> std::ws, text);
+      text = unescape(text);
+      at(when, [icon, text] { ble_notify(icon, 0, text.c_str()); }, false);
+    } else if (command == "call") {
+      std::string text = unescape(rest);
+      at(when, [text] { ble_notify(1, 0, text.c_str()); }, false);
+    } else if (command == "hangup") {
+      at(when, [] { ble_notify(2, 0, ""); }, false);
+    } else if (command == "find") {
+      at(when, [] { ble_find(); }, false);
+    } else if (command == "press") {
+      std::istringstream args(rest);
+      std::string name;
+      int ms = 150;
+      args >> name >> ms;
+      unsigned button = 0;
+      while (button < 4 && name != button_names[button])
+        ++button;
+      if (button == 4) {
+        fprintf(stderr, "%s:%d: unknown button %s\n", path, no, name.c_str());
+        return false;
+      }
+      at(when, [button, ms] { press_button(button, ms * 1000); }, false);
+    } else if (command == "end") {
+      at(when, [] { finished = true; }, false);
+    } else {
+      fprintf(stderr, "%s:%d: unknown command %s\n",
+              path, no, command.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+static void report(int64_t start) {
+  double hours = (clock_us - start) / (3600.0 * second);
+  printf("simulated:          %.2f h\n", hours);
+  printf("boots:              %u\n", stats.boots);
+  printf("deep sleeps:        %u\n", stats.deep_sleeps);
+  printf("wake-ups:           %u (%.1f per hour)\n",
+         stats.wakes, hours > 0 ? stats.wakes / hours : 0);
+  printf("queue messages:     %u\n", stats.messages);
+  printf("buttons:            %u\n", stats.buttons);
+  printf("notifications:      %u (%u dropped)\n",
+         stats.notifications, stats.dropped);
+  printf("full updates:       %u\n", stats.full_updates);
+  printf("partial updates:    %u\n", stats.partial_updates);
+  printf("window pixels:      %llu (%.0f per update)\n",
+         (unsigned long long)stats.window_pixels,
+         stats.partial_updates
+         ? (double)stats.window_pixels / stats.partial_updates : 0);
+  printf("spi bytes:          %llu\n", (unsigned long long)stats.spi_bytes);
+  printf("panel busy:         %.1f s\n", (double)stats.panel_busy / second);
+  printf("panel sleeps:       %u\n", stats.panel_sleeps);
+  printf("stale frames:       %u\n", stats.stale_frames);
+  printf("i2c transactions:   %u\n", stats.i2c_transactions);
+  printf("adc reads:          %u\n", stats.adc_reads);
+  printf("nvs writes:         %u (%u erases)\n",
+         stats.nvs_writes, stats.nvs_erases);
+  // read the log back, the reader has no other user yet
+  TelemetryRecord records[TELEMETRY_BATCH];
+  unsigned blocks = 0, logged = 0;
+  for (int count; (count = telemetry_read(blocks, records,
+                                          TELEMETRY_BATCH)) >= 0; ++blocks)
+    logged += count;
+  printf("telemetry:          %u records in %u blocks\n", logged, blocks);
+  printf("vibration:          %u pulses, %.1f s\n",
+         stats.vibrations, (double)stats.vibration_time / second);
+  printf("ble tx:             %u\n", stats.ble_tx);
+  printf("heap peak:          %zu\n", stats.heap_peak);
+  printf("heap final:         %zu\n", stats.heap_final);
+}
+
+}
+
+using namespace sim;
+
+extern "C" void sim_log(char level, const char* tag, const char* format, ...) {
+  bool show = level == 'E' || level == 'W' ||
+    (level == 'I' && verbose) || debug;
+  if (!show)
+    return;
+  fprintf(stderr, "[%s] %c (%s) ", format_time(clock_us).c_str(), level, tag);
+  va_list args;
+  va_start(args, format);
+  vfprintf(stderr, format, args);
+  va_end(args);
+  size_t len = strlen(format);
+  if (!len || format[len - 1] != '\n')
+    fputc('\n', stderr);
+}
+
+// The ESP system clock keeps running through deep sleep and starts
+// from the epoch at power-on, the firmware sees it through these.
+extern "C" time_t time(time_t* result) noexcept {
+  time_t t = (clock_us + system_offset) / second;
+  if (result)
+    *result = t;
+  return t;
+}
+
+extern "C" int gettimeofday(struct timeval* tv, void* tz) noexcept {
+  int64_t t = clock_us + system_offset;
+  tv->tv_sec = t / second;
+  tv->tv_usec = t % second;
+  return 0;
+}
+
+extern "C" int settimeofday(const struct timeval* tv,
+                            const struct timezone* tz) noexcept {
+  system_offset = (int64_t)tv->tv_sec * second + tv->tv_usec - clock_us;
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  const char* scenario = 0;
+  for (int i = 1; i < argc; ++i) {
+    if (!strcmp(argv[i], "-v"))
+      verbose = true;
+    else if (!strcmp(argv[i], "-vv"))
+      verbose = debug = true;
+    else if (!strcmp(argv[i], "-f") && i + 1 < argc)
+      frames_dir = argv[++i];
+    else
+      scenario = argv[i];
+  }
+  if (!scenario) {
+    fprintf(stderr, "Usage: %s [-v|-vv] [-f frames_dir] scenario\n", argv[0]);
+    return 1;
+  }
+  setenv("TZ", "UTC0", 1);
+  tzset();
+  if (!load_scenario(scenario))
+    return 1;
+  int64_t start = clock_us;
+  system_offset = -clock_us;
+  heap_base = mallinfo2().uordblks;
+  while (!finished) {
+    try {
+      boot();
+      app_main();
+    } catch (DeepSleep&) {
+      deep_sleep();
+    } catch (End&) {
+      break;
+    }
+  }
+  report(start);
+  // the panel has to show what was drawn after every refresh
+  return stats.stale_frames ? 2 : 0;
+}
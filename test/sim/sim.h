@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+// Host simulator of the watch. Firmware sources are compiled against the
+// stand-ins in test/stubs, the stand-ins report to this module which owns
+// the simulated clock, the pending hardware events and the statistics.
+namespace sim {
+
+const int64_t second = 1000000;
+const int64_t minute = 60 * second;
+
+// thrown by esp_deep_sleep_start(), the firmware is restarted after wake-up
+struct DeepSleep {};
+// thrown when the scenario is over
+struct End {};
+
+struct Stats {
+  unsigned boots = 0;
+  unsigned deep_sleeps = 0;
+  unsigned wakes = 0;            // light sleep wake-ups of the main task
+  unsigned messages = 0;         // main queue messages received
+  unsigned full_updates = 0;
+  unsigned partial_updates = 0;
+  uint64_t window_pixels = 0;    // area of all partial updates
+  uint64_t spi_bytes = 0;        // framebuffer bytes sent to the panel
+  int64_t panel_busy = 0;        // microseconds spent waiting for the panel
+  unsigned panel_sleeps = 0;
+  unsigned stale_frames = 0;     // refreshes leaving the panel != canvas
+  unsigned i2c_transactions = 0;
+  unsigned adc_reads = 0;
+  unsigned nvs_writes = 0;
+  unsigned nvs_erases = 0;
+  unsigned vibrations = 0;       // motor pulses
+  int64_t vibration_time = 0;
+  unsigned ble_tx = 0;
+  unsigned notifications = 0;    // delivered to the firmware
+  unsigned dropped = 0;          // sent by the phone while not connected
+  unsigned buttons = 0;
+  size_t heap_peak = 0;
+  size_t heap_final = 0;
+};
+
+extern Stats stats;
+extern bool verbose;
+// directory for PBM snapshots of the panel after every refresh
+extern const char* frames_dir;
+
+// simulated wall clock, microseconds since the epoch
+int64_t now();
+// microseconds since the last boot
+int64_t uptime();
+
+// Schedule fn at the given time. Volatile events belong to the running
+// firmware (timers, BLE stack) and are discarded on deep sleep.
+void at(int64_t when, std::function<void()> fn, bool is_volatile = true);
+
+// Let time pass while the main task is blocked or busy, events that
+// come due meanwhile are dispatched.
+void sleep(int64_t duration);
+
+// Block the main task until ready() or the deadline, returns ready()
+bool wait(int64_t deadline, const std::function<bool()>& ready);
+
+void sample_heap();
+
+bool deep_sleeping();
+// an enabled wake-up source has fired during deep sleep
+void wake_up();
+
+// stops all timers, see freertos.cpp
+void rtos_reset();
+
+// hardware stand-ins, see hw.cpp, ble.cpp
+void press_button(unsigned button, int64_t duration);
+void set_battery(int millivolts, int drain_per_day);
+void set_rtc_valid(bool valid);
+// wake-up timer armed before deep sleep, negative when disabled
+int64_t hw_wakeup_timer();
+void hw_timer_wakeup();
+void hw_reset();
+// recreates the canvas, see display.cpp
+void display_reset();
+
+void ble_phone(bool in_range);
+void ble_notify(uint8_t icon, uint8_t state, const char* text);
+void ble_find();
+void ble_reset();
+
+}
@@ -0,0 +1,6 @@
+// Host stand-in for driver/uart.h
+#pragma once
+
+#define UART_NUM_0 0
+#define UART_NUM_1 1
+#define UART_NUM_2 2
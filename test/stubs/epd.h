@@ -0,0 +1,81 @@
+// Host stand-in for CalEPD epd.h together with the Adafruit_GFX
+// subset the firmware uses
+#pragma once
+#include <stdint.h>
+#include <string.h>
+#include "gfxfont.h"
+
+#define EPD_WHITE 0xFFFF
+#define EPD_BLACK 0x0000
+
+class Epd {
+ protected:
+  int16_t _width;
+  int16_t _height;
+  const GFXfont* gfxFont = 0;
+
+ public:
+  Epd(int16_t w, int16_t h): _width(w), _height(h) {}
+  virtual ~Epd() {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                        uint16_t color) {
+    for (int16_t i = x; i < x + w; ++i)
+      for (int16_t j = y; j < y + h; ++j)
+        drawPixel(i, j, color);
+  }
+
+  virtual void fillScreen(uint16_t color) {
+    fillRect(0, 0, _width, _height, color);
+  }
+
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    fillRect(x, y, w, 1, color);
+  }
+
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+    fillRect(x, y, 1, h, color);
+  }
+
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    drawFastHLine(x, y, w, color);
+    drawFastHLine(x, y + h - 1, w, color);
+    drawFastVLine(x, y, h, color);
+    drawFastVLine(x + w - 1, y, h, color);
+  }
+
+  void setFont(const GFXfont* f) {
+    gfxFont = f;
+  }
+
+  // Same as Adafruit_GFX::drawChar() for custom fonts,
+  // background is never painted
+  void drawChar(int16_t x, int16_t y, unsigned char c,
+                uint16_t color, uint16_t bg, uint8_t size) {
+    c -= (uint8_t)gfxFont->first;
+    const GFXglyph* glyph = &gfxFont->glyph[c];
+    const uint8_t* bitmap = gfxFont->bitmap;
+    uint16_t bo = glyph->bitmapOffset;
+    uint8_t bits = 0;
+    uint8_t bit = 0;
+    for (uint8_t yy = 0; yy < glyph->height; ++yy) {
+      for (uint8_t xx = 0; xx < glyph->width; ++xx) {
+        if (!(bit++ & 7))
+          bits = bitmap[bo++];
+        if (bits & 0x80)
+          drawPixel(x + glyph->xOffset + xx, y + glyph->yOffset + yy, color);
+        bits <<= 1;
+      }
+    }
+  }
+
+  int16_t width() const {
+    return _width;
+  }
+
+  int16_t height() const {
+    return _height;
+  }
+};
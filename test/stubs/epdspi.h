@@ -0,0 +1,5 @@
+// Host stand-in for CalEPD epdspi.h
+#pragma once
+
+class EpdSpi {
+};
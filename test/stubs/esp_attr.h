@@ -0,0 +1,8 @@
+// Host stand-in. RTC memory survives simulated deep sleep just like
+// the rest of the process memory, so the attributes are no-ops.
+#pragma once
+
+#define RTC_DATA_ATTR
+#define RTC_FAST_ATTR
+#define RTC_NOINIT_ATTR
+#define IRAM_ATTR
@@ -0,0 +1,19 @@
+// Host stand-in for esp_log.h, messages go to stderr with simulated time
+#pragma once
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void sim_log(char level, const char* tag, const char* format, ...);
+
+#ifdef __cplusplus
+}
+#endif
+
+#define ESP_LOGE(tag, format, ...) sim_log('E', tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) sim_log('W', tag, format, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) sim_log('I', tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) sim_log('D', tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) sim_log('V', tag, format, ##__VA_ARGS__)
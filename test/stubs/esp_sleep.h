@@ -0,0 +1,44 @@
+// Host stand-in for esp_sleep.h
+#pragma once
+#include <stdint.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+
+typedef enum {
+  ESP_SLEEP_WAKEUP_UNDEFINED,
+  ESP_SLEEP_WAKEUP_ALL,
+  ESP_SLEEP_WAKEUP_EXT0,
+  ESP_SLEEP_WAKEUP_EXT1,
+  ESP_SLEEP_WAKEUP_TIMER,
+  ESP_SLEEP_WAKEUP_TOUCHPAD,
+  ESP_SLEEP_WAKEUP_ULP,
+  ESP_SLEEP_WAKEUP_GPIO,
+} esp_sleep_wakeup_cause_t;
+
+typedef enum {
+  ESP_EXT1_WAKEUP_ALL_LOW = 0,
+  ESP_EXT1_WAKEUP_ANY_HIGH = 1,
+} esp_sleep_ext1_wakeup_mode_t;
+
+typedef enum {
+  ESP_PD_DOMAIN_RTC_PERIPH,
+  ESP_PD_DOMAIN_RTC_SLOW_MEM,
+  ESP_PD_DOMAIN_RTC_FAST_MEM,
+} esp_sleep_pd_domain_t;
+
+typedef enum {
+  ESP_PD_OPTION_OFF,
+  ESP_PD_OPTION_ON,
+  ESP_PD_OPTION_AUTO
+} esp_sleep_pd_option_t;
+
+esp_err_t esp_sleep_pd_config(esp_sleep_pd_domain_t domain,
+                              esp_sleep_pd_option_t option);
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t time_in_us);
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t gpio_num, int level);
+esp_err_t esp_sleep_enable_ext1_wakeup(uint64_t io_mask,
+                                       esp_sleep_ext1_wakeup_mode_t mode);
+esp_err_t esp_sleep_enable_gpio_wakeup();
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
+uint64_t esp_sleep_get_ext1_wakeup_status();
+[[noreturn]] void esp_deep_sleep_start();
@@ -0,0 +1,6 @@
+// Host stand-in for esp_timer.h
+#pragma once
+#include <stdint.h>
+
+// microseconds since boot
+int64_t esp_timer_get_time();
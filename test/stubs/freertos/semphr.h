@@ -0,0 +1,12 @@
+// Host stand-in for FreeRTOS mutexes, there is only one task to take them
+#pragma once
+#include "FreeRTOS.h"
+
+typedef struct {
+  bool taken;
+} StaticSemaphore_t;
+typedef StaticSemaphore_t* SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateMutexStatic(StaticSemaphore_t* buffer);
+BaseType_t xSemaphoreTake(SemaphoreHandle_t mutex, TickType_t wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t mutex);
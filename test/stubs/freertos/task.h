@@ -0,0 +1,13 @@
+// Host stand-in for FreeRTOS tasks, only the main task really runs
+#pragma once
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+typedef struct SimTask* TaskHandle_t;
+
+BaseType_t xTaskCreate(TaskFunction_t code, const char* name,
+                       uint32_t stack_depth, void* params,
+                       UBaseType_t priority, TaskHandle_t* created);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+TickType_t xTaskGetTickCount();
@@ -0,0 +1,36 @@
+// Host stand-in for the CalEPD GDEH0154D67 driver. It keeps the same
+// 1bpp buffer as the real driver plus a copy of what the panel shows
+// and reports every refresh to the simulator.
+#pragma once
+#include <stdint.h>
+#include "epd.h"
+#include "epdspi.h"
+
+#define GDEH0154D67_WIDTH 200
+#define GDEH0154D67_HEIGHT 200
+#define GDEH0154D67_BUFFER_SIZE \
+  (uint32_t(GDEH0154D67_WIDTH) * uint32_t(GDEH0154D67_HEIGHT) / 8)
+
+class Gdeh0154d67 : public Epd {
+ private:
+  EpdSpi& IO;
+  uint8_t _buffer[GDEH0154D67_BUFFER_SIZE];
+  bool _refresh = true;
+
+ public:
+  // what the panel currently shows, same layout as the buffer
+  uint8_t panel[GDEH0154D67_BUFFER_SIZE];
+
+  Gdeh0154d67(EpdSpi& io);
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  // copies bytes of the buffer layout into row y from x on, x is a
+  // multiple of 8, no rotation (an addition of the CalEPD fork)
+  void writeRow(int16_t x, int16_t y, const uint8_t* bits, uint16_t bytes);
+  void init(bool debug = false);
+  void setRefresh(bool refresh);
+  void update();
+  void updateWindow(int16_t x, int16_t y, int16_t w, int16_t h,
+                    bool using_rotation = true);
+  void deepSleep();
+};
@@ -0,0 +1,46 @@
+// Host stand-in for nvs.h, an in-memory store that survives deep sleep
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef uint32_t nvs_handle_t;
+
+typedef enum {
+  NVS_READONLY,
+  NVS_READWRITE
+} nvs_open_mode_t;
+
+typedef enum {
+  NVS_TYPE_U8 = 0x01,
+  NVS_TYPE_BLOB = 0x42,
+  NVS_TYPE_ANY = 0xff
+} nvs_type_t;
+
+#define NVS_KEY_NAME_MAX_SIZE 16
+
+typedef struct {
+  char namespace_name[16];
+  char key[NVS_KEY_NAME_MAX_SIZE];
+  nvs_type_t type;
+} nvs_entry_info_t;
+
+typedef struct nvs_opaque_iterator_t *nvs_iterator_t;
+
+esp_err_t nvs_open(const char* name, nvs_open_mode_t open_mode,
+                   nvs_handle_t *out_handle);
+void nvs_close(nvs_handle_t handle);
+esp_err_t nvs_commit(nvs_handle_t handle);
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char* key,
+                       const void* value, size_t length);
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char* key,
+                       void* out_value, size_t* length);
+esp_err_t nvs_set_u8(nvs_handle_t handle, const char* key, uint8_t value);
+esp_err_t nvs_get_u8(nvs_handle_t handle, const char* key, uint8_t* out_value);
+esp_err_t nvs_erase_key(nvs_handle_t handle, const char* key);
+esp_err_t nvs_entry_find_in_handle(nvs_handle_t handle, nvs_type_t type,
+                                   nvs_iterator_t *output_iterator);
+esp_err_t nvs_entry_next(nvs_iterator_t *iterator);
+esp_err_t nvs_entry_info(const nvs_iterator_t iterator,
+                         nvs_entry_info_t *out_info);
+void nvs_release_iterator(nvs_iterator_t iterator);
@@ -0,0 +1,6 @@
+// Host stand-in for nvs_flash.h
+#pragma once
+#include "nvs.h"
+
+esp_err_t nvs_flash_init();
+esp_err_t nvs_flash_erase();
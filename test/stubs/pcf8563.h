@@ -0,0 +1,51 @@
+// Host stand-in for tuupola/pcf8563, the chip is modelled on the
+// simulated clock and every call counts as one I2C transaction
+#pragma once
+#include <stdint.h>
+#include <time.h>
+
+#define PCF8563_TIE (0b00000001)
+#define PCF8563_AIE (0b00000010)
+#define PCF8563_TF (0b00000100)
+#define PCF8563_AF (0b00001000)
+#define PCF8563_TI_TP (0b00010000)
+
+#define PCF8563_ALARM_DISABLE (0b10000000)
+#define PCF8563_ALARM_NONE (0xff)
+
+#define PCF8563_TIMER_ENABLE (0b10000000)
+#define PCF8563_TIMER_4096HZ (0b00000000)
+#define PCF8563_TIMER_64HZ (0b00000001)
+#define PCF8563_TIMER_1HZ (0b00000010)
+#define PCF8563_TIMER_1_60HZ (0b00000011)
+
+#define PCF8563_ALARM_SET (0x0900)
+#define PCF8563_ALARM_READ (0x0901)
+#define PCF8563_CONTROL_STATUS1_READ (0x0000)
+#define PCF8563_CONTROL_STATUS1_WRITE (0x0001)
+#define PCF8563_CONTROL_STATUS2_READ (0x0100)
+#define PCF8563_CONTROL_STATUS2_WRITE (0x0101)
+#define PCF8563_TIMER_CONTROL_READ (0x0e00)
+#define PCF8563_TIMER_CONTROL_WRITE (0x0e01)
+#define PCF8563_TIMER_READ (0x0f00)
+#define PCF8563_TIMER_WRITE (0x0f01)
+
+#define PCF8563_ERROR_NOTTY (-1)
+#define PCF8563_OK (0x00)
+#define PCF8563_ERR_LOW_VOLTAGE (0x80)
+
+typedef int32_t pcf8563_read_t(void* handle, uint8_t address, uint8_t reg,
+                               uint8_t* buffer, uint16_t size);
+typedef int32_t pcf8563_write_t(void* handle, uint8_t address, uint8_t reg,
+                                const uint8_t* buffer, uint16_t size);
+
+typedef struct {
+  pcf8563_read_t* read;
+  pcf8563_write_t* write;
+  void* handle;
+} pcf8563_t;
+
+int32_t pcf8563_init(const pcf8563_t* pcf);
+int32_t pcf8563_read(const pcf8563_t* pcf, struct tm* time);
+int32_t pcf8563_write(const pcf8563_t* pcf, const struct tm* time);
+int32_t pcf8563_ioctl(const pcf8563_t* pcf, int16_t command, void* buffer);
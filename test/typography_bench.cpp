@@ -0,0 +1,105 @@
+// Layout and rendering costs of Typography for every generated font
+// over a corpus of notification texts. Drawing goes to a silent
+// MockDisplay which counts the glyph bitmap bytes read.
+#include <chrono>
+#include <cstdio>
+#include "../main/typography.h"
+#include "../main/c509_bold29pt.h"
+#include "../main/c509_bold37pt.h"
+#include "../main/ter_x20b_pcf20pt.h"
+#include "../main/ter_x28b_pcf28pt.h"
+#include "../main/ter_x32b_pcf32pt.h"
+#include "mock_display.h"
+
+static const char* texts[] = {
+  "Meeting moved to 15:30, room 4B. Bring the quarterly numbers please!",
+  "Мама: Позвони когда освободишься, нужно обсудить выходные",
+  "Код для входа в Сбербанк Онлайн: 482913. Никому его не сообщайте, "
+  "даже сотрудникам банка. Если вы не запрашивали код, позвоните 900.",
+  "Telegram code 55218\nDo not give this code to anyone, even if they "
+  "say they are from Telegram!",
+  "Вт 13 Окт",
+  0
+};
+
+// the clock fonts have digits only
+static const char* digits[] = {"12:34", "482913", "09:58", 0};
+
+struct Font {
+  const char* name;
+  const UnicodeFont* pages;
+  int page_count;
+  const uint8_t* index;
+  const char** corpus;
+};
+
+#define FONT(f, corpus) {#f, f, sizeof(f) / sizeof(f[0]), f##_index, corpus}
+
+static const Font fonts[] = {
+  FONT(ter_x20b_pcf20pt, texts),
+  FONT(ter_x28b_pcf28pt, texts),
+  FONT(ter_x32b_pcf32pt, texts),
+  FONT(C059_Bold29pt, digits),
+  FONT(C059_Bold37pt, digits),
+};
+
+enum Operation { PRINT, FIT_TEXT, TEXT_DIMENSIONS, PRINT_CENTERED };
+static const char* operations[] = {
+  "Print", "FitText", "TextDimensions", "PrintCentered"};
+
+MockDisplay display(0);
+Typography<MockDisplay> typography(display);
+
+static void run(Operation operation, const char* text) {
+  uint16_t width, height;
+  switch (operation) {
+    case PRINT:
+      typography.SetCursor(0, 0);
+      typography.Print(text);
+      break;
+    case FIT_TEXT:
+      typography.FitText(text, 5, 5, 190, 190);
+      break;
+    case TEXT_DIMENSIONS:
+      typography.TextDimensions(text, width, height);
+      break;
+    case PRINT_CENTERED:
+      typography.PrintCentered(text, 5);
+      break;
+  }
+}
+
+static unsigned symbols(const char* text) {
+  unsigned result = 0;
+  for (const char* c = text; *c; c = next_ut8_symbol(c))
+    result += *c != '\n';
+  return result;
+}
+
+int main(int argc, char** argv) {
+  const int rounds = 500;
+  printf("%-18s %-15s %9s %9s %9s\n",
+         "font", "operation", "ns/glyph", "misses", "bytes");
+  printf("%-34s %9s %9s %9s\n", "", "", "/1000", "/glyph");
+  for (const Font& font : fonts) {
+    for (int op = PRINT; op <= PRINT_CENTERED; ++op) {
+      typography.SetFont(font.pages, font.page_count, font.index);
+      unsigned glyphs = 0;
+      unsigned misses = typography.LookupMisses();
+      unsigned bytes = display.bitmap_bytes;
+      auto start = std::chrono::steady_clock::now();
+      for (const char** text = font.corpus; *text; ++text) {
+        for (int i = 0; i < rounds; ++i)
+          run((Operation)op, *text);
+        glyphs += symbols(*text) * rounds;
+      }
+      std::chrono::duration<double, std::nano> spent =
+        std::chrono::steady_clock::now() - start;
+      printf("%-18s %-15s %9.1f %9.1f %9.1f\n",
+             font.name, operations[op], spent.count() / glyphs,
+             (double)(typography.LookupMisses() - misses) * 1000 / glyphs,
+             (double)(display.bitmap_bytes - bytes) / glyphs);
+    }
+  }
+  return 0;
+}